@@ -0,0 +1,29 @@
+#include <stdio.h>
+#include "sortingAlgorithms.h"
+
+int main(void) {
+
+    printf("\n\n============================| SORTING EXAMPLE |============================\n\n");
+
+    int arr[5] = {4,2,7,1,6};
+    int size = sizeof(arr)/sizeof(arr[0]);
+
+    bubble_sort_array(arr, size, ascending);
+    printf("Bubble sort (ascending): ");
+    print_sorted_arr(arr, size);
+
+    int big[10] = {9,3,5,0,8,1,7,2,6,4};
+    quick_sort_array(big, 10, descending);
+    printf("Quick sort (descending): ");
+    print_sorted_arr(big, 10);
+
+    tim_sort_array(big, 10, ascending);
+    printf("Tim sort (ascending): ");
+    print_sorted_arr(big, 10);
+
+    heap_sort_array(big, 10, descending);
+    printf("Heap sort (descending): ");
+    print_sorted_arr(big, 10);
+
+    return 0;
+}
@@ -0,0 +1,384 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "externalSort.h"
+#include "sortingAlgorithms.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+/*
+External Merge Sort:
+--------------------------------------------
+Sorts data that is larger than the available memory by only ever holding a bounded part of it in RAM.
+
+STEPS:
+    1.  Run generation: read `memory_budget` bytes of ints, sort them in memory, write them to a temporary "run" file.
+        Repeat until the input is exhausted. Every run is sorted on its own.
+    2.  Merge: give every run a large read buffer and repeatedly output the smallest head element among all runs.
+        The smallest head is tracked with a loser tree, so each output element costs log2(k) comparisons for k runs.
+    3.  If there are more runs than buffers fit into the budget, merge groups of runs into longer runs first
+        (one extra pass over the data per level).
+
+COMPLEXITY:
+    Time Complexity: O(n log n) comparisons, O(n * passes) sequential I/O where passes = 1 + log_k(runs).
+    Space Complexity: O(memory_budget) RAM, O(n) temporary disk space.
+
+NOTE:
+    If the whole input fits into one run it is sorted in memory and written straight to the output.
+*/
+
+
+// A sorted run being read back during the merge
+typedef struct ext_run_reader {
+    FILE* file;
+    int* buf;
+    size_t len;
+    size_t pos;
+} ext_run_reader;
+
+
+/*
+ * Seconds from a monotonic clock.
+ */
+static double ext_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Allocates memory or exits the program (same policy as the containers in data_structures/).
+ */
+static void* ext_alloc(size_t bytes, const char* what) {
+    void* p = malloc(bytes);
+    if (!p) {
+        printf("Memory allocation failed: couldn't allocate %zu bytes for %s\n", bytes, what);
+        exit(1);
+    }
+    return p;
+}
+
+/*
+ * Creates an anonymous temporary file inside dir. The file is unlinked right away, so it disappears when closed.
+ */
+static FILE* ext_open_temp(const char* dir) {
+    size_t len = strlen(dir) + sizeof("/ext_sort_run_XXXXXX");
+    char* path = (char*) ext_alloc(len, "temp file path");
+    snprintf(path, len, "%s/ext_sort_run_XXXXXX", dir);
+
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        printf("external_sort_file: couldn't create temp file in %s\n", dir);
+        free(path);
+        return NULL;
+    }
+    unlink(path);
+    free(path);
+
+    FILE* f = fdopen(fd, "w+b");
+    if (!f) {
+        close(fd);
+        printf("external_sort_file: couldn't open temp file in %s\n", dir);
+    }
+    return f;
+}
+
+/*
+ * Writes n ints to f. Returns 0 on success else -1.
+ */
+static int ext_write_ints(FILE* f, const int* data, size_t n) {
+    if (n > 0 && fwrite(data, sizeof(int), n, f) != n) {
+        printf("external_sort_file: write failed\n");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Refills a run reader from its file. Leaves len == 0 once the run is exhausted.
+ */
+static void ext_refill(ext_run_reader* r, size_t buf_elems) {
+    r->len = fread(r->buf, sizeof(int), buf_elems, r->file);
+    r->pos = 0;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Loser tree
+//
+// tree[1..k) holds the index of the run that LOST the match at that internal node, tree[0] holds the overall
+// winner. Leaves are implicit: run s sits at node k+s. After the winner emits its head element only the path
+// from its leaf to the root has to be replayed, one comparison per level.
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+/*
+ * Returns 1 if the head of run a should be emitted before the head of run b. Exhausted runs lose every match.
+ */
+static int ext_beats(const ext_run_reader* runs, size_t a, size_t b, int (*cmp)(int, int)) {
+    if (runs[a].len == 0) return 0;
+    if (runs[b].len == 0) return 1;
+    return !cmp(runs[b].buf[runs[b].pos], runs[a].buf[runs[a].pos]);
+}
+
+/*
+ * Plays the matches of the subtree rooted at node and returns its winner.
+ */
+static size_t ext_tree_build(size_t* tree, size_t node, size_t k, const ext_run_reader* runs, int (*cmp)(int, int)) {
+    if (node >= k) return node - k;
+    size_t left = ext_tree_build(tree, 2*node, k, runs, cmp);
+    size_t right = ext_tree_build(tree, 2*node + 1, k, runs, cmp);
+    if (ext_beats(runs, left, right, cmp)) {
+        tree[node] = right;
+        return left;
+    }
+    tree[node] = left;
+    return right;
+}
+
+/*
+ * Replays the path from run s up to the root after the head of s changed.
+ */
+static void ext_tree_replay(size_t* tree, size_t s, size_t k, const ext_run_reader* runs, int (*cmp)(int, int)) {
+    size_t winner = s;
+    for (size_t node = (s + k) / 2; node >= 1; node /= 2) {
+        if (ext_beats(runs, tree[node], winner, cmp)) {
+            size_t t = tree[node];
+            tree[node] = winner;
+            winner = t;
+        }
+    }
+    tree[0] = winner;
+}
+
+/*
+ * Merges k sorted run files into out. Every run gets a buffer of buf_elems ints, the output one more.
+ * Returns 0 on success else -1.
+ */
+static int ext_merge_runs(FILE** files, size_t k, FILE* out, size_t buf_elems, int (*cmp)(int, int)) {
+    ext_run_reader* runs = (ext_run_reader*) ext_alloc(k * sizeof(ext_run_reader), "run readers");
+    size_t* tree = (size_t*) ext_alloc(k * sizeof(size_t), "loser tree");
+    int* out_buf = (int*) ext_alloc(buf_elems * sizeof(int), "merge output buffer");
+    int status = 0;
+
+    // Prime every run with its first buffer
+    for (size_t s = 0; s < k; s++) {
+        runs[s].file = files[s];
+        runs[s].buf = (int*) ext_alloc(buf_elems * sizeof(int), "run buffer");
+        rewind(files[s]);
+        ext_refill(&runs[s], buf_elems);
+    }
+    tree[0] = ext_tree_build(tree, 1, k, runs, cmp);
+
+    size_t out_len = 0;
+    for (;;) {
+        size_t w = tree[0];
+        ext_run_reader* r = &runs[w];
+        if (r->len == 0) break;   // The winner is exhausted: so is every other run
+
+        out_buf[out_len++] = r->buf[r->pos++];
+        if (out_len == buf_elems) {
+            if (ext_write_ints(out, out_buf, out_len) != 0) { status = -1; break; }
+            out_len = 0;
+        }
+        if (r->pos == r->len) ext_refill(r, buf_elems);
+        ext_tree_replay(tree, w, k, runs, cmp);
+    }
+    if (status == 0) status = ext_write_ints(out, out_buf, out_len);
+
+    for (size_t s = 0; s < k; s++) {
+        if (ferror(runs[s].file)) {
+            printf("external_sort_file: read failed on run %zu\n", s);
+            status = -1;
+        }
+        free(runs[s].buf);
+    }
+    free(out_buf);
+    free(tree);
+    free(runs);
+    return status;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+
+void ext_sort_default_config(ext_sort_config* config) {
+    if (!config) return;
+    config->memory_budget = EXT_SORT_DEFAULT_BUDGET;
+    config->io_buffer_size = EXT_SORT_DEFAULT_IO_BUFFER;
+    config->temp_dir = NULL;
+}
+
+
+int external_sort_file(const char* input_path, const char* output_path, int (*cmp)(int, int),
+                       const ext_sort_config* config, ext_sort_stats* stats) {
+    // Validate input parameters
+    if (!input_path || !output_path || !cmp) {
+        printf("external_sort_file: NULL argument\n");
+        return -1;
+    }
+
+    // Resolve the configuration
+    ext_sort_config cfg;
+    ext_sort_default_config(&cfg);
+    if (config) {
+        if (config->memory_budget) cfg.memory_budget = config->memory_budget;
+        if (config->io_buffer_size) cfg.io_buffer_size = config->io_buffer_size;
+        cfg.temp_dir = config->temp_dir;
+    }
+    if (!cfg.temp_dir) cfg.temp_dir = getenv("TMPDIR");
+    if (!cfg.temp_dir) cfg.temp_dir = "/tmp";
+    if (cfg.memory_budget < 4 * sizeof(int)) {
+        printf("external_sort_file: memory budget too small (%zu bytes)\n", cfg.memory_budget);
+        return -1;
+    }
+
+    ext_sort_stats st;
+    memset(&st, 0, sizeof(st));
+
+    // The input must hold a whole number of ints
+    struct stat info;
+    if (stat(input_path, &info) != 0) {
+        printf("external_sort_file: couldn't stat %s\n", input_path);
+        return -1;
+    }
+    if ((size_t)info.st_size % sizeof(int) != 0) {
+        printf("external_sort_file: %s is not a whole number of ints (%lld bytes)\n", input_path, (long long)info.st_size);
+        return -1;
+    }
+    st.elements = (size_t)info.st_size / sizeof(int);
+
+    // Opening the output truncates it, so it can't be the input (also through a link)
+    struct stat out_info;
+    if (stat(output_path, &out_info) == 0 && out_info.st_dev == info.st_dev && out_info.st_ino == info.st_ino) {
+        printf("external_sort_file: %s and %s are the same file\n", input_path, output_path);
+        return -1;
+    }
+
+    FILE* in = fopen(input_path, "rb");
+    if (!in) {
+        printf("external_sort_file: couldn't open %s\n", input_path);
+        return -1;
+    }
+    FILE* out = fopen(output_path, "wb");
+    if (!out) {
+        printf("external_sort_file: couldn't create %s\n", output_path);
+        fclose(in);
+        return -1;
+    }
+
+    int status = 0;
+    size_t run_cap = 16;
+    FILE** runs = (FILE**) ext_alloc(run_cap * sizeof(FILE*), "run list");
+    size_t nruns = 0;
+
+    // ---- Phase 1: run generation ----
+    double t0 = ext_now();
+    size_t chunk_elems = cfg.memory_budget / sizeof(int);
+    if (chunk_elems > st.elements) chunk_elems = st.elements > 0 ? st.elements : 1;
+    int* chunk = (int*) ext_alloc(chunk_elems * sizeof(int), "sort chunk");
+
+    size_t total = 0;
+    for (;;) {
+        size_t n = fread(chunk, sizeof(int), chunk_elems, in);
+        if (n == 0) break;
+        total += n;
+        quick_sort_array(chunk, n, cmp);
+
+        // Everything fit in a single chunk: write the result directly
+        if (nruns == 0 && n == st.elements) {
+            status = ext_write_ints(out, chunk, n);
+            st.runs = 1;
+            break;
+        }
+
+        FILE* run = ext_open_temp(cfg.temp_dir);
+        if (!run || ext_write_ints(run, chunk, n) != 0) {
+            if (run) fclose(run);
+            status = -1;
+            break;
+        }
+        if (nruns == run_cap) {
+            run_cap *= 2;
+            FILE** grown = (FILE**) realloc(runs, run_cap * sizeof(FILE*));
+            if (!grown) {
+                printf("Memory allocation failed: couldn't grow run list to %zu entries\n", run_cap);
+                exit(1);
+            }
+            runs = grown;
+        }
+        runs[nruns++] = run;
+    }
+    if (ferror(in)) {
+        printf("external_sort_file: read failed on %s\n", input_path);
+        status = -1;
+    } else if (status == 0 && (total != st.elements || fgetc(in) != EOF)) {
+        // The file changed size after the stat: don't report a sort of something else
+        printf("external_sort_file: %s changed while being read (expected %zu ints)\n", input_path, st.elements);
+        status = -1;
+    }
+    free(chunk);
+    fclose(in);
+    if (nruns > 0) st.runs = nruns;
+    st.run_seconds = ext_now() - t0;
+
+    // ---- Phase 2: k-way merge ----
+    t0 = ext_now();
+    if (status == 0 && nruns > 0) {
+        // One buffer per run plus one for the output must fit into the budget
+        size_t io_bytes = cfg.io_buffer_size;
+        size_t fan_in = cfg.memory_budget / io_bytes;
+        fan_in = fan_in > 1 ? fan_in - 1 : 1;
+        if (fan_in < 2) fan_in = 2;
+        if (fan_in > nruns) fan_in = nruns;
+        if (io_bytes * (fan_in + 1) > cfg.memory_budget) io_bytes = cfg.memory_budget / (fan_in + 1);
+        size_t buf_elems = io_bytes / sizeof(int);
+        if (buf_elems == 0) buf_elems = 1;
+
+        // Too many runs for one merge: merge groups of fan_in runs into longer runs until one pass suffices
+        while (status == 0 && nruns > fan_in) {
+            size_t merged = 0;
+            for (size_t first = 0; first < nruns; first += fan_in) {
+                size_t k = nruns - first < fan_in ? nruns - first : fan_in;
+                FILE* dst = ext_open_temp(cfg.temp_dir);
+                if (!dst) { status = -1; break; }
+                if (ext_merge_runs(runs + first, k, dst, buf_elems, cmp) != 0) {
+                    fclose(dst);
+                    status = -1;
+                    break;
+                }
+                for (size_t s = first; s < first + k; s++) {
+                    fclose(runs[s]);
+                    runs[s] = NULL;
+                }
+                runs[merged++] = dst;
+            }
+            if (status != 0) break;
+            nruns = merged;
+            st.merge_passes++;
+        }
+
+        if (status == 0) {
+            status = ext_merge_runs(runs, nruns, out, buf_elems, cmp);
+            st.merge_passes++;
+        }
+    }
+    st.merge_seconds = ext_now() - t0;
+
+    // Closing the run files also deletes them (they were unlinked on creation)
+    for (size_t s = 0; s < nruns; s++) {
+        if (runs[s]) fclose(runs[s]);
+    }
+    free(runs);
+    if (fclose(out) != 0) {
+        printf("external_sort_file: couldn't finish writing %s\n", output_path);
+        status = -1;
+    }
+
+    if (stats) *stats = st;
+    return status;
+}
@@ -0,0 +1,40 @@
+#ifndef DSA_EXTERNAL_SORT_H
+#define DSA_EXTERNAL_SORT_H
+
+#include <stddef.h>
+
+
+/*
+* External merge sort for binary files of native-endian ints that do not fit in RAM.
+* The input is read in chunks of at most `memory_budget` bytes, every chunk is sorted
+* with quick_sort_array and written to a temporary run file, then the runs are k-way
+* merged through a loser tree with large sequential buffers.
+*/
+
+typedef struct ext_sort_config {
+    size_t memory_budget;     // Bytes of RAM the sort may use (0 -> EXT_SORT_DEFAULT_BUDGET)
+    size_t io_buffer_size;    // Bytes per run buffer while merging (0 -> EXT_SORT_DEFAULT_IO_BUFFER)
+    const char* temp_dir;     // Directory for run files (NULL -> $TMPDIR, else "/tmp")
+} ext_sort_config;
+
+typedef struct ext_sort_stats {
+    size_t elements;          // Number of ints sorted
+    size_t runs;              // Number of initial sorted runs
+    size_t merge_passes;      // Number of merge passes over the data (0 when everything fit in one run)
+    double run_seconds;       // Wall time spent reading, sorting and writing runs
+    double merge_seconds;     // Wall time spent merging
+} ext_sort_stats;
+
+#define EXT_SORT_DEFAULT_BUDGET    ((size_t)256 << 20)
+#define EXT_SORT_DEFAULT_IO_BUFFER ((size_t)4 << 20)
+
+// Fill a config with the defaults above
+void ext_sort_default_config(ext_sort_config* config);
+
+// Sort the ints in input_path into output_path, which must be a different file. config and stats may be NULL.
+// Returns 0 on success else -1 (also when the input changes size while it is read)
+int external_sort_file(const char* input_path, const char* output_path, int (*cmp)(int, int),
+                       const ext_sort_config* config, ext_sort_stats* stats);
+
+
+#endif /* DSA_EXTERNAL_SORT_H */
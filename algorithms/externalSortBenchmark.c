@@ -0,0 +1,130 @@
+/*
+External sort throughput benchmark.
+
+    Build: gcc -O2 externalSortBenchmark.c externalSort.c sortingAlgorithms.c -o ext_sort_bench
+    Usage: ./ext_sort_bench <elements> [memory_budget_MB] [temp_dir]
+
+Writes <elements> random ints to a file in temp_dir, sorts it with external_sort_file, verifies the output
+by streaming it back and reports MB/s for run generation, merging and the whole sort. To measure the
+out-of-core path pick <elements> so the file is several times the machine's RAM (e.g. 4 GiB of RAM ->
+elements = 4e9 for a 16 GB file) and keep the budget well below RAM.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "externalSort.h"
+#include "sortingAlgorithms.h"
+
+#define BENCH_IO_ELEMS ((size_t)1 << 20)
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// xorshift64* - fast deterministic input generator
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static int next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (int)((rng_state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+static int write_random_file(const char* path, size_t elements) {
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        printf("couldn't create %s\n", path);
+        return -1;
+    }
+    int* buf = (int*) malloc(BENCH_IO_ELEMS * sizeof(int));
+    if (!buf) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t done = 0; done < elements; ) {
+        size_t n = elements - done < BENCH_IO_ELEMS ? elements - done : BENCH_IO_ELEMS;
+        for (size_t i = 0; i < n; i++) buf[i] = next_random();
+        fwrite(buf, sizeof(int), n, f);
+        done += n;
+    }
+    free(buf);
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+// Streams the output back and checks it is ordered and has the right length
+static int verify_sorted_file(const char* path, size_t elements) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    int* buf = (int*) malloc(BENCH_IO_ELEMS * sizeof(int));
+    if (!buf) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    size_t total = 0, n;
+    int prev = 0, ok = 1;
+    while (ok && (n = fread(buf, sizeof(int), BENCH_IO_ELEMS, f)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            if (total + i > 0 && buf[i] < prev) { ok = 0; break; }
+            prev = buf[i];
+        }
+        total += n;
+    }
+    free(buf);
+    fclose(f);
+    return ok && total == elements ? 0 : -1;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printf("Usage: %s <elements> [memory_budget_MB] [temp_dir]\n", argv[0]);
+        return 1;
+    }
+    size_t elements = strtoull(argv[1], NULL, 10);
+
+    ext_sort_config cfg;
+    ext_sort_default_config(&cfg);
+    if (argc > 2) cfg.memory_budget = strtoull(argv[2], NULL, 10) << 20;
+    if (argc > 3) cfg.temp_dir = argv[3];
+    const char* dir = cfg.temp_dir ? cfg.temp_dir : (getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp");
+
+    char in_path[4096], out_path[4096];
+    snprintf(in_path, sizeof(in_path), "%s/ext_sort_bench_input.bin", dir);
+    snprintf(out_path, sizeof(out_path), "%s/ext_sort_bench_output.bin", dir);
+
+    double mb = (double)elements * sizeof(int) / (1024.0 * 1024.0);
+    printf("Generating %zu ints (%.1f MB) in %s ...\n", elements, mb, in_path);
+    if (write_random_file(in_path, elements) != 0) return 1;
+
+    ext_sort_stats stats;
+    double t0 = now_seconds();
+    int rc = external_sort_file(in_path, out_path, ascending, &cfg, &stats);
+    double total = now_seconds() - t0;
+    if (rc != 0) {
+        printf("external_sort_file failed\n");
+        remove(in_path);
+        remove(out_path);
+        return 1;
+    }
+
+    int ok = verify_sorted_file(out_path, elements) == 0;
+    printf("budget          : %zu MB\n", cfg.memory_budget >> 20);
+    printf("runs            : %zu\n", stats.runs);
+    printf("merge passes    : %zu\n", stats.merge_passes);
+    printf("run generation  : %8.2f s  %8.1f MB/s\n", stats.run_seconds, mb / stats.run_seconds);
+    if (stats.merge_passes > 0)
+        printf("merge           : %8.2f s  %8.1f MB/s\n", stats.merge_seconds, mb * stats.merge_passes / stats.merge_seconds);
+    printf("total           : %8.2f s  %8.1f MB/s\n", total, mb / total);
+    printf("verification    : %s\n", ok ? "OK" : "FAILED");
+
+    remove(in_path);
+    remove(out_path);
+    return ok ? 0 : 1;
+}
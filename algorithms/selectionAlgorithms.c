@@ -0,0 +1,245 @@
+#include "selectionAlgorithms.h"
+#include "sortingAlgorithms.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Quick Select Algorithm (introselect):
+--------------------------------------------
+Quick select partitions the array exactly like quick sort, but only keeps working on the part that contains the wanted position.
+
+STEPS:
+    1.  Choose the median of the first, middle and last element of the range as the pivot.
+    2.  Partition the range around the pivot (Hoare partition).
+    3.  Continue with the part that contains position nth; the other part is already on the correct side.
+    4.  Ranges shorter than SELECT_INSERTION_THRESHOLD are finished by insertion sort.
+    5.  If more than 2*log2(n) partitioning steps were needed the pivots are bad: heap sort the remaining range.
+
+COMPLEXITY:
+    Time Complexity: O(n) expected (n + n/2 + n/4 + ...), O(n log n) worst case thanks to the fallback.
+    Space Complexity: O(1).
+*/
+#define SELECT_INSERTION_THRESHOLD 16
+
+
+
+// ------------------------------------
+
+
+/*
+ * Orders arr[a], arr[b], arr[c] and returns the median value.
+ */
+static int select_median_of_three(int* arr, size_t a, size_t b, size_t c, int (*cmp)(int, int)) {
+    if(cmp(arr[b], arr[a])) swap_values(arr+a, arr+b);
+    if(cmp(arr[c], arr[b])) {
+        swap_values(arr+b, arr+c);
+        if(cmp(arr[b], arr[a])) swap_values(arr+a, arr+b);
+    }
+    return arr[b];
+}
+
+/*
+ * Hoare partition of arr[0..size) around the median of three.
+ * Returns i such that arr[0..i) belong before-or-equal and arr[i..size) after-or-equal the pivot, 0 < i < size.
+ */
+static size_t select_partition(int* arr, size_t size, int (*cmp)(int, int)) {
+    int pivot = select_median_of_three(arr, 0, size/2, size-1, cmp);
+    size_t i = 0, j = size-1;
+    for(;;) {
+        while(cmp(arr[++i], pivot));
+        while(cmp(pivot, arr[--j]));
+        if(i >= j) return i;
+        swap_values(arr+i, arr+j);
+    }
+}
+
+/*
+ * Places the nth element of arr in its sorted position (see selectionAlgorithms.h).
+ * @param arr: Pointer to the array
+ * @param size: Number of elements in the array
+ * @param nth: Position (0-based) to place
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void int_nth_element(int* arr, size_t size, size_t nth, int (*cmp)(int, int)) {
+    if(!arr || !cmp || nth >= size) return;
+
+    int depth_limit = 0;
+    for(size_t n=size; n>1; n>>=1) depth_limit += 2;
+
+    // Narrow [lo, hi) down to a short range that contains nth
+    size_t lo = 0, hi = size;
+    while(hi - lo > SELECT_INSERTION_THRESHOLD) {
+        if(depth_limit-- == 0) {
+            heap_sort_array(arr+lo, hi-lo, cmp);
+            return;
+        }
+        size_t split = lo + select_partition(arr+lo, hi-lo, cmp);
+        if(nth < split) hi = split;
+        else lo = split;
+    }
+    insertion_sort_array(arr+lo, hi-lo, cmp);
+}
+
+/*
+ * Sorts only the first k elements of arr (see selectionAlgorithms.h).
+ * Selects the k-th element first so the sort only has to look at the k elements before it.
+ * @param arr: Pointer to the array
+ * @param size: Number of elements in the array
+ * @param k: Number of leading elements to sort
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void int_partial_sort(int* arr, size_t size, size_t k, int (*cmp)(int, int)) {
+    if(!arr || !cmp || k == 0) return;
+    if(k >= size) {
+        quick_sort_array(arr, size, cmp);
+        return;
+    }
+    int_nth_element(arr, size, k-1, cmp);
+    quick_sort_array(arr, k-1, cmp);
+}
+
+
+
+// ------------------------------------
+
+
+/*
+Streaming Top-K (bounded heap):
+--------------------------------------------
+Keeps the k values that come first in sorted order out of a stream of unknown length, using O(k) memory.
+
+STEPS:
+    1.  Keep the values in a binary heap whose root is the kept value that comes LAST in sorted order (the "worst" one).
+    2.  While fewer than k values are kept, insert every value.
+    3.  Afterwards a new value is only inserted if it comes before the root: it replaces the root, which is sifted down.
+
+COMPLEXITY:
+    Time Complexity: O(n log k) worst case; O(n) for the common case where most values are rejected by one comparison.
+    Space Complexity: O(k).
+*/
+
+typedef struct int_topk {
+    int* heap;
+    size_t k;
+    size_t size;
+    int (*cmp)(int, int);
+} int_topk;
+
+
+int_topk* topk_create(size_t k, int (*cmp)(int, int)) {
+    // Validate input parameters
+    if (k == 0 || !cmp) {
+        printf("topk_create: k must be > 0 and cmp non-NULL\n");
+        return NULL;
+    }
+
+    // Memory allocation: int_topk struct
+    int_topk* topk = (int_topk*) malloc(sizeof(int_topk));
+    if (!topk) {
+        printf("Memory allocation failed: couldn't allocate memory for the struct int_topk!\n");
+        exit(1);
+    }
+
+    // Memory allocation: topk->heap
+    topk->heap = (int*) malloc(sizeof(int) * k);
+    if (!topk->heap) {
+        printf("Memory allocation failed: couldn't allocate memory for %zu integers in the heap\n", k);
+        free(topk);
+        exit(1);
+    }
+
+    topk->k = k;
+    topk->size = 0;
+    topk->cmp = cmp;
+    return topk;
+}
+
+/*
+ * Moves heap[i] up while it comes later in sorted order than its parent.
+ */
+static void topk_sift_up(int_topk* topk, size_t i) {
+    int* heap = topk->heap;
+    int val = heap[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!topk->cmp(heap[parent], val)) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = val;
+}
+
+/*
+ * Moves heap[0] down while one of its children comes later in sorted order.
+ */
+static void topk_sift_down(int_topk* topk) {
+    int* heap = topk->heap;
+    size_t size = topk->size, i = 0;
+    int val = heap[0];
+    while (2*i + 1 < size) {
+        size_t child = 2*i + 1;
+        if (child + 1 < size && topk->cmp(heap[child], heap[child+1])) child++;
+        if (!topk->cmp(val, heap[child])) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = val;
+}
+
+void topk_push(int_topk* topk, int val) {
+    // Validate input parameter: topk
+    if (!topk) {
+        printf("topk_push: NULL topk pointer\n");
+        return;
+    }
+
+    // Not full yet: keep everything
+    if (topk->size < topk->k) {
+        topk->heap[topk->size] = val;
+        topk_sift_up(topk, topk->size++);
+        return;
+    }
+
+    // Full: only values that beat the current worst kept value get in
+    if (topk->cmp(val, topk->heap[0])) {
+        topk->heap[0] = val;
+        topk_sift_down(topk);
+    }
+}
+
+void topk_push_many(int_topk* topk, const int* vals, size_t n) {
+    // Validate input parameters
+    if (!topk || (!vals && n > 0)) {
+        printf("topk_push_many: NULL argument\n");
+        return;
+    }
+    for (size_t i = 0; i < n; i++) topk_push(topk, vals[i]);
+}
+
+size_t topk_size(const int_topk* topk) {
+    return topk ? topk->size : 0;
+}
+
+size_t topk_result(const int_topk* topk, int* out) {
+    // Validate input parameters
+    if (!topk || !out) {
+        printf("topk_result: NULL argument\n");
+        return 0;
+    }
+    memcpy(out, topk->heap, topk->size * sizeof(int));
+    quick_sort_array(out, topk->size, topk->cmp);
+    return topk->size;
+}
+
+void topk_clear(int_topk* topk) {
+    if (topk) topk->size = 0;
+}
+
+void topk_free(int_topk* topk) {
+    // Validate input parameter: topk
+    if (!topk) return;
+    free(topk->heap);
+    free(topk);
+}
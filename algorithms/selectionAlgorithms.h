@@ -0,0 +1,47 @@
+#ifndef DSA_SELECTION_ALGORITHMS_H
+#define DSA_SELECTION_ALGORITHMS_H
+
+#include <stddef.h>
+
+
+/*
+* Selection routines for int arrays: find the k-th element or the first k elements in
+* sorted order without paying for a full sort. The `cmp` callbacks follow the convention
+* of sortingAlgorithms.h (`ascending` / `descending`: return 1 if the arguments are in order).
+*/
+
+typedef struct int_topk int_topk;
+
+// Reorder arr so arr[nth] holds the element a full sort would put there, with everything before it
+// in order-before-or-equal and everything after it order-after-or-equal. O(n) expected (introselect)
+void int_nth_element(int* arr, size_t size, size_t nth, int (*cmp)(int, int));
+
+// Reorder arr so arr[0..k) holds the first k elements in sorted order; the rest is left unordered. O(n + k log k)
+void int_partial_sort(int* arr, size_t size, size_t k, int (*cmp)(int, int));
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Create a streaming top-k selector that keeps the k values coming first in cmp order
+// (cmp = descending keeps the k largest). Returns NULL if k == 0 or cmp is NULL
+int_topk* topk_create(size_t k, int (*cmp)(int, int));
+
+// Offer one value to the selector. O(log k) worst case, O(1) when it is rejected
+void topk_push(int_topk* topk, int val);
+
+// Offer n values to the selector
+void topk_push_many(int_topk* topk, const int* vals, size_t n);
+
+// Number of values currently kept (at most k)
+size_t topk_size(const int_topk* topk);
+
+// Copy the kept values in sorted order into out (room for topk_size values). Returns the number written
+size_t topk_result(const int_topk* topk, int* out);
+
+// Drop every kept value
+void topk_clear(int_topk* topk);
+
+// Delete the selector
+void topk_free(int_topk* topk);
+
+
+#endif /* DSA_SELECTION_ALGORITHMS_H */
@@ -0,0 +1,96 @@
+/*
+Selection vs full sort benchmark.
+
+    Build: gcc -O2 selectionBenchmark.c selectionAlgorithms.c sortingAlgorithms.c -o selection_bench
+    Usage: ./selection_bench [elements=50000000] [k=100]
+
+Times a full quick_sort_array against int_nth_element (median), int_partial_sort (first k) and the
+streaming top-k selector on the same random input, and checks every result against the full sort.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "selectionAlgorithms.h"
+#include "sortingAlgorithms.h"
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static int next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (int)((rng_state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+static int* alloc_ints(size_t n) {
+    int* p = (int*) malloc((n ? n : 1) * sizeof(int));
+    if (!p) {
+        printf("Memory allocation failed: couldn't allocate %zu integers\n", n);
+        exit(1);
+    }
+    return p;
+}
+
+static void report(const char* name, double seconds, size_t n, int ok) {
+    printf("%-28s %10.3f ms  %8.2f ns/elem  %s\n", name, seconds * 1e3, seconds * 1e9 / (double)n, ok ? "OK" : "MISMATCH");
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 50000000;
+    size_t k = argc > 2 ? strtoull(argv[2], NULL, 10) : 100;
+    if (n == 0) n = 1;
+    if (k == 0 || k > n) k = n;
+
+    int* input = alloc_ints(n);
+    int* work = alloc_ints(n);
+    int* sorted = alloc_ints(n);
+    int* top = alloc_ints(k);
+    for (size_t i = 0; i < n; i++) input[i] = next_random();
+
+    printf("n = %zu, k = %zu\n\n", n, k);
+
+    // Reference: full sort (descending so the first k are the k largest)
+    memcpy(sorted, input, n * sizeof(int));
+    double t0 = now_seconds();
+    quick_sort_array(sorted, n, descending);
+    report("quick_sort_array (full)", now_seconds() - t0, n, 1);
+
+    // Median
+    memcpy(work, input, n * sizeof(int));
+    t0 = now_seconds();
+    int_nth_element(work, n, n / 2, descending);
+    report("int_nth_element (median)", now_seconds() - t0, n, work[n / 2] == sorted[n / 2]);
+
+    // First k in order
+    memcpy(work, input, n * sizeof(int));
+    t0 = now_seconds();
+    int_partial_sort(work, n, k, descending);
+    double elapsed = now_seconds() - t0;
+    report("int_partial_sort (top k)", elapsed, n, memcmp(work, sorted, k * sizeof(int)) == 0);
+
+    // Streaming: the input is only read once and never modified
+    int_topk* topk = topk_create(k, descending);
+    t0 = now_seconds();
+    topk_push_many(topk, input, n);
+    size_t got = topk_result(topk, top);
+    elapsed = now_seconds() - t0;
+    report("topk_push_many (stream)", elapsed, n, got == k && memcmp(top, sorted, k * sizeof(int)) == 0);
+    topk_free(topk);
+
+    free(top);
+    free(sorted);
+    free(work);
+    free(input);
+    return 0;
+}
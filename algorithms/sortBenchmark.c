@@ -0,0 +1,364 @@
+/*
+Sorting benchmark harness.
+
+    Build: gcc -O2 sortBenchmark.c sortingAlgorithms.c -o sort_bench
+           (add -DSORT_COUNT_SWAPS to both files' build to also count swap_values calls)
+    Usage: ./sort_bench [--min N] [--max N] [--sorts a,b,...] [--dists a,b,...] [--count] [--csv FILE]
+
+Runs every registered sort on every input distribution at sizes min, 4*min, 16*min, ... up to max
+(default 16 .. 1048576; the harness accepts up to 100M). Each result is verified (ascending order and
+an order-independent checksum of the values). Timing is reported as ns/element; with --count the
+comparison callback is wrapped to count comparisons, and with -DSORT_COUNT_SWAPS swap_values calls
+are counted too. One CSV line is written per (sort, distribution, size) to FILE or stdout.
+
+The perturbed_<p> distributions are sorted inputs with p% of the positions overwritten by random
+values, the case the adaptive tim sort is built for.
+
+The argsort entry sorts through int_argsort + gather_by_permutation, the key_payload_<B> entries through
+int_sort_key_payload with B-byte payload records; for both the verified run also checks that every key
+kept its payload and that equal keys kept their input order (stability).
+
+Sorts with quadratic cost are skipped above their max_n so a full sweep stays practical, and payload
+sorts above the size where their payload column would exceed 2 GB.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "sortingAlgorithms.h"
+
+#define BENCH_MIN_TIME_SEC 0.05          // Repeat small sizes until at least this much time was measured
+#define BENCH_MAX_N        ((size_t)100000000)
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Registered sorts
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+typedef struct bench_sort {
+    const char* name;
+    void (*sort)(int* arr, size_t size, int (*cmp)(int, int));
+    size_t max_n;                      // Largest size worth running (quadratic sorts get a small cap)
+    size_t payload_size;               // Bytes of payload moved with every key (payload-carrying sorts only)
+} bench_sort;
+
+static void run_bubble_sort(int* arr, size_t size, int (*cmp)(int, int)) {
+    bubble_sort_array(arr, (int)size, cmp);
+}
+
+// State shared with the argsort / key-payload wrappers, set by main before every call
+static const int* bench_input;         // Unsorted keys the work array was copied from
+static char* bench_payloads;           // Payload column (at most BENCH_MAX_PAYLOAD_BYTES bytes)
+static size_t bench_payload_size;
+static int bench_verifying;            // 1 on the verified run: fill payloads before and check them after
+static int bench_payload_ok;
+static size_t* bench_perm;
+
+#define BENCH_MAX_PAYLOAD_BYTES ((size_t)2 << 30)
+
+// Checks that equal keys kept their input order, given the original index of every output position
+static int bench_check_stable(const int* arr, size_t size, size_t (*orig)(size_t i)) {
+    for (size_t i = 0; i < size; i++) {
+        if (bench_input[orig(i)] != arr[i]) return 0;
+        if (i > 0 && arr[i] == arr[i - 1] && orig(i) < orig(i - 1)) return 0;
+    }
+    return 1;
+}
+
+static size_t perm_orig(size_t i) { return bench_perm[i]; }
+
+static size_t payload_orig(size_t i) {
+    uint32_t idx;
+    memcpy(&idx, bench_payloads + i * bench_payload_size, sizeof(idx));
+    return idx;
+}
+
+// Argsort followed by a gather of the keys themselves
+static void run_argsort(int* arr, size_t size, int (*cmp)(int, int)) {
+    int_argsort(arr, size, bench_perm, cmp);
+    gather_by_permutation(bench_input, sizeof(int), bench_perm, size, arr);
+    if (bench_verifying) bench_payload_ok = bench_check_stable(arr, size, perm_orig);
+}
+
+// Key-payload sort; every payload record starts with the original index of its key
+static void run_key_payload(int* arr, size_t size, int (*cmp)(int, int)) {
+    if (bench_verifying) {
+        for (size_t i = 0; i < size; i++) {
+            uint32_t idx = (uint32_t)i;
+            memcpy(bench_payloads + i * bench_payload_size, &idx, sizeof(idx));
+        }
+    }
+    int_sort_key_payload(arr, bench_payloads, bench_payload_size, size, cmp);
+    if (bench_verifying) bench_payload_ok = bench_check_stable(arr, size, payload_orig);
+}
+
+static const bench_sort SORTS[] = {
+    {"bubble",          run_bubble_sort,      (size_t)1 << 14, 0},
+    {"insertion",       insertion_sort_array, (size_t)1 << 16, 0},
+    {"heap",            heap_sort_array,      BENCH_MAX_N,     0},
+    {"quick",           quick_sort_array,     BENCH_MAX_N,     0},
+    {"tim",             tim_sort_array,       BENCH_MAX_N,     0},
+    {"argsort",         run_argsort,          BENCH_MAX_N,     0},
+    {"key_payload_4",   run_key_payload,      BENCH_MAX_N,     4},
+    {"key_payload_16",  run_key_payload,      BENCH_MAX_PAYLOAD_BYTES / 16,  16},
+    {"key_payload_64",  run_key_payload,      BENCH_MAX_PAYLOAD_BYTES / 64,  64},
+    {"key_payload_256", run_key_payload,      BENCH_MAX_PAYLOAD_BYTES / 256, 256},
+};
+#define NUM_SORTS (sizeof(SORTS) / sizeof(SORTS[0]))
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Input distributions
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+static uint64_t rng_state;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static void gen_sorted(int* a, size_t n) { for (size_t i = 0; i < n; i++) a[i] = (int)i; }
+static void gen_reversed(int* a, size_t n) { for (size_t i = 0; i < n; i++) a[i] = (int)(n - i); }
+static void gen_random(int* a, size_t n) { for (size_t i = 0; i < n; i++) a[i] = (int)(next_random() >> 32); }
+static void gen_few_unique(int* a, size_t n) { for (size_t i = 0; i < n; i++) a[i] = (int)(next_random() % 16); }
+
+// 16 ascending teeth
+static void gen_sawtooth(int* a, size_t n) {
+    size_t period = n / 16 + 1;
+    for (size_t i = 0; i < n; i++) a[i] = (int)(i % period);
+}
+
+// Ascending first half, descending second half
+static void gen_organ_pipe(int* a, size_t n) {
+    for (size_t i = 0; i < n; i++) a[i] = (int)(i < n / 2 ? i : n - i);
+}
+
+// Sorted with 1% of the elements swapped with a random partner
+static void gen_nearly_sorted(int* a, size_t n) {
+    gen_sorted(a, n);
+    if (n < 2) return;
+    size_t swaps = n / 100 + 1;
+    for (size_t s = 0; s < swaps; s++) swap_values(a + next_random() % n, a + next_random() % n);
+}
+
+// Sorted with a fraction of the positions overwritten by random values (out-of-order appends to a sorted feed)
+static void gen_perturbed(int* a, size_t n, size_t per_mille) {
+    gen_sorted(a, n);
+    size_t count = n * per_mille / 1000;
+    for (size_t s = 0; s < count; s++) a[next_random() % n] = (int)(next_random() % n);
+}
+static void gen_perturbed_0_1(int* a, size_t n) { gen_perturbed(a, n, 1); }
+static void gen_perturbed_1(int* a, size_t n) { gen_perturbed(a, n, 10); }
+static void gen_perturbed_10(int* a, size_t n) { gen_perturbed(a, n, 100); }
+
+typedef struct bench_dist {
+    const char* name;
+    void (*generate)(int* arr, size_t n);
+} bench_dist;
+
+static const bench_dist DISTS[] = {
+    {"sorted",        gen_sorted},
+    {"reversed",      gen_reversed},
+    {"random",        gen_random},
+    {"few_unique",    gen_few_unique},
+    {"sawtooth",      gen_sawtooth},
+    {"organ_pipe",    gen_organ_pipe},
+    {"nearly_sorted", gen_nearly_sorted},
+    {"perturbed_0.1", gen_perturbed_0_1},
+    {"perturbed_1",   gen_perturbed_1},
+    {"perturbed_10",  gen_perturbed_10},
+};
+#define NUM_DISTS (sizeof(DISTS) / sizeof(DISTS[0]))
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Instrumentation and verification
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+static unsigned long long cmp_count = 0;
+
+// ascending with a counter: passed as the cmp callback when --count is given
+static int counting_ascending(int a, int b) {
+    cmp_count++;
+    return a < b;
+}
+
+static unsigned long long read_swap_count(void) {
+#ifdef SORT_COUNT_SWAPS
+    return sort_swap_count;
+#else
+    return 0;
+#endif
+}
+
+// Order-independent fingerprint of the values, so a sort that loses or duplicates elements is caught
+static uint64_t multiset_checksum(const int* a, size_t n) {
+    uint64_t sum = 0, mix = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t v = (uint64_t)(uint32_t)a[i];
+        sum += v;
+        mix += (v + 0x9E3779B97F4A7C15ull) * 0xBF58476D1CE4E5B9ull ^ (v >> 7);
+    }
+    return sum ^ (mix << 1);
+}
+
+static int verify_sorted(const int* a, size_t n, uint64_t expected_checksum) {
+    for (size_t i = 1; i < n; i++) {
+        if (a[i] < a[i - 1]) return 0;
+    }
+    return multiset_checksum(a, n) == expected_checksum;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Returns 1 if name appears in the comma separated list (a NULL list selects everything)
+static int selected(const char* list, const char* name) {
+    if (!list) return 1;
+    size_t len = strlen(name);
+    for (const char* p = list; *p; ) {
+        const char* end = strchr(p, ',');
+        size_t item = end ? (size_t)(end - p) : strlen(p);
+        if (item == len && strncmp(p, name, len) == 0) return 1;
+        if (!end) break;
+        p = end + 1;
+    }
+    return 0;
+}
+
+static int* alloc_ints(size_t n) {
+    int* p = (int*) malloc(n * sizeof(int));
+    if (!p) {
+        printf("Memory allocation failed: couldn't allocate %zu integers\n", n);
+        exit(1);
+    }
+    return p;
+}
+
+int main(int argc, char** argv) {
+    size_t min_n = 16, max_n = (size_t)1 << 20;
+    const char* sort_list = NULL;
+    const char* dist_list = NULL;
+    const char* csv_path = NULL;
+    int count_ops = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) min_n = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--max") && i + 1 < argc) max_n = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--sorts") && i + 1 < argc) sort_list = argv[++i];
+        else if (!strcmp(argv[i], "--dists") && i + 1 < argc) dist_list = argv[++i];
+        else if (!strcmp(argv[i], "--csv") && i + 1 < argc) csv_path = argv[++i];
+        else if (!strcmp(argv[i], "--count")) count_ops = 1;
+        else {
+            printf("Usage: %s [--min N] [--max N] [--sorts a,b] [--dists a,b] [--count] [--csv FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (min_n == 0) min_n = 1;
+    if (max_n > BENCH_MAX_N) max_n = BENCH_MAX_N;
+    if (max_n < min_n) max_n = min_n;
+
+    FILE* csv = csv_path ? fopen(csv_path, "w") : stdout;
+    if (!csv) {
+        printf("couldn't create %s\n", csv_path);
+        return 1;
+    }
+    fprintf(csv, "sort,distribution,n,reps,ns_per_elem,comparisons_per_elem,swaps_per_elem,verified\n");
+
+    int* input = alloc_ints(max_n);
+    int* work = alloc_ints(max_n);
+    int all_ok = 1;
+
+    // Columns for the argsort / key-payload sorts, sized for the largest run they take part in
+    size_t payload_bytes = 0;
+    for (size_t s = 0; s < NUM_SORTS; s++) {
+        if (!selected(sort_list, SORTS[s].name)) continue;
+        size_t n = max_n < SORTS[s].max_n ? max_n : SORTS[s].max_n;
+        if (n * SORTS[s].payload_size > payload_bytes) payload_bytes = n * SORTS[s].payload_size;
+    }
+    bench_input = input;
+    bench_perm = (size_t*) malloc(selected(sort_list, "argsort") ? max_n * sizeof(size_t) : 1);
+    bench_payloads = (char*) malloc(payload_bytes ? payload_bytes : 1);
+    if (!bench_perm || !bench_payloads) {
+        printf("Memory allocation failed: couldn't allocate the payload columns\n");
+        exit(1);
+    }
+
+    for (size_t d = 0; d < NUM_DISTS; d++) {
+        if (!selected(dist_list, DISTS[d].name)) continue;
+
+        for (size_t n = min_n; n <= max_n; n = n * 4 > n ? n * 4 : max_n + 1) {
+            rng_state = 0x9E3779B97F4A7C15ull ^ n;
+            DISTS[d].generate(input, n);
+            uint64_t checksum = multiset_checksum(input, n);
+
+            for (size_t s = 0; s < NUM_SORTS; s++) {
+                if (!selected(sort_list, SORTS[s].name) || n > SORTS[s].max_n) continue;
+
+                // Verified (and, if requested, counted) run
+                memcpy(work, input, n * sizeof(int));
+                bench_payload_size = SORTS[s].payload_size;
+                bench_verifying = 1;
+                bench_payload_ok = 1;
+                cmp_count = 0;
+                unsigned long long swaps_before = read_swap_count();
+                SORTS[s].sort(work, n, count_ops ? counting_ascending : ascending);
+                unsigned long long comparisons = cmp_count;
+                unsigned long long swaps = read_swap_count() - swaps_before;
+                bench_verifying = 0;
+                int ok = verify_sorted(work, n, checksum) && bench_payload_ok;
+                all_ok &= ok;
+
+                // Timed runs: repeat copy+sort until BENCH_MIN_TIME_SEC, then subtract the time of the copies alone
+                size_t reps = 0;
+                double start = now_seconds(), elapsed;
+                do {
+                    memcpy(work, input, n * sizeof(int));
+                    SORTS[s].sort(work, n, ascending);
+                    reps++;
+                    elapsed = now_seconds() - start;
+                } while (elapsed < BENCH_MIN_TIME_SEC);
+
+                start = now_seconds();
+                for (size_t r = 0; r < reps; r++) {
+                    memcpy(work, input, n * sizeof(int));
+                    __asm__ volatile("" : : "r"(work) : "memory");
+                }
+                double copy_time = now_seconds() - start;
+                double sort_time = elapsed > copy_time ? elapsed - copy_time : elapsed;
+
+                fprintf(csv, "%s,%s,%zu,%zu,%.3f,", SORTS[s].name, DISTS[d].name, n, reps, sort_time * 1e9 / ((double)n * reps));
+                if (count_ops) fprintf(csv, "%.3f,", (double)comparisons / n);
+                else fprintf(csv, ",");
+#ifdef SORT_COUNT_SWAPS
+                fprintf(csv, "%.3f,", (double)swaps / n);
+#else
+                (void)swaps;
+                fprintf(csv, ",");
+#endif
+                fprintf(csv, "%s\n", ok ? "yes" : "NO");
+                fflush(csv);
+            }
+        }
+    }
+
+    free(bench_payloads);
+    free(bench_perm);
+    free(work);
+    free(input);
+    if (csv != stdout) fclose(csv);
+    if (!all_ok) printf("Some sorts produced wrong output!\n");
+    return all_ok ? 0 : 1;
+}
@@ -1,4 +1,9 @@
+#include "sortingAlgorithms.h"
+#include "../data_structures/fast_io/fast_io.h"
+
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 /*
 Bubble Sort Algorithm:
@@ -14,7 +19,7 @@ STEPS:
     6.  Continue until no swaps are needed, or until all passes are complete.
 
 COMPLEXITY:
-    Time Complexity: O(n^2) in the worst and average case.
+    Time Complexity: O(n^2) in the worst and average case, O(n) when the input is already sorted (one pass without swaps).
     Space Complexity: O(1) (in-place sorting).
 
 NOTE:
@@ -32,8 +37,11 @@ NOTE:
  * @param size: Number of elements in the array
  */
 void print_sorted_arr(int* arr, int size) {
-    for(int i=0; i<size; i++) {printf("%d ", arr[i]);}
-    printf("\n");
+    fio_writer w;
+    fio_writer_init(&w, stdout, NULL, 0);
+    for(int i=0; i<size; i++) {fio_put_int(&w, arr[i]); fio_put_char(&w, ' ');}
+    fio_put_char(&w, '\n');
+    fio_writer_flush(&w);
 }
 
 
@@ -55,10 +63,18 @@ int descending(int a, int b) {return a > b;}
 
 /*
  * Swaps the values of two integer variables.
+ * Built with -DSORT_COUNT_SWAPS every call is counted in sort_swap_count (used by sortBenchmark.c).
  * @param a: Pointer to the first integer
  * @param b: Pointer to the second integer
  */
+#ifdef SORT_COUNT_SWAPS
+unsigned long long sort_swap_count = 0;
+#endif
+
 void swap_values(int* a, int* b) {
+#ifdef SORT_COUNT_SWAPS
+    sort_swap_count++;
+#endif
     int temp = *a;
     *a = *b;
     *b = temp;
@@ -74,30 +90,798 @@ void swap_values(int* a, int* b) {
  * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
  */
 void bubble_sort_array(int* arr, int size, int (*cmp)(int, int)) {
-    // Outer loop: controls the number of passes (size-1 passes needed)
+    // Outer loop: controls the number of passes (at most size-1 passes needed)
     for(int i=0; i<size-1; i++) {
+        int swapped = 0;
         // Inner loop: compares adjacent elements in the unsorted part
         for(int j=0; j<(size-1)-i; j++) {
-            // If the current pair is NOT in the correct order, swap them
-            // cmp(arr[j], arr[j+1]) returns 1 if in order, 0 if not
-            if(!(cmp(arr[j], arr[j+1]))) {
+            // If the current pair is out of order, swap them
+            // cmp(arr[j+1], arr[j]) returns 1 only if arr[j+1] must come first (equal elements stay put)
+            if(cmp(arr[j+1], arr[j])) {
                 swap_values(arr+j, arr+(j+1)); // Swap the elements
+                swapped = 1;
             }
         }
         // After each pass, the largest/smallest element is at the end
+        // A pass without swaps means every adjacent pair is in order: the array is sorted
+        if(!swapped) break;
     }
     // Array is sorted after all passes
 }
 
 
+
+// ------------------------------------
+
+
+/*
+Insertion Sort Algorithm:
+--------------------------------------------
+Insertion sort grows a sorted prefix one element at a time: each new element is shifted left past every element it should precede.
+
+COMPLEXITY:
+    Time Complexity: O(n^2) in the worst case, O(n) when the input is already sorted.
+    Space Complexity: O(1) (in-place sorting).
+
+NOTE:
+    It has almost no overhead, so the O(n log n) sorts below hand it every range shorter than SORT_INSERTION_THRESHOLD.
+*/
+#define SORT_INSERTION_THRESHOLD 16
+
+/*
+ * Sorts an integer array using the insertion sort algorithm.
+ * @param arr: Pointer to the array to sort
+ * @param size: Number of elements in the array
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void insertion_sort_array(int* arr, size_t size, int (*cmp)(int, int)) {
+    for(size_t i=1; i<size; i++) {
+        int val = arr[i];
+        size_t j = i;
+        // Shift every element that should come after val one step right
+        while(j > 0 && cmp(val, arr[j-1])) {
+            arr[j] = arr[j-1];
+            j--;
+        }
+        arr[j] = val;
+    }
+}
+
+
+
+// ------------------------------------
+
+
+/*
+Heap Sort Algorithm:
+--------------------------------------------
+Heap sort arranges the array as a binary heap whose root is the element that belongs LAST, then repeatedly swaps the root to the end of the array and restores the heap over the remaining prefix.
+
+COMPLEXITY:
+    Time Complexity: O(n log n) in every case.
+    Space Complexity: O(1) (in-place sorting).
+*/
+
 /*
- * Main function
+ * Moves arr[root] down until both of its children are in order with it.
+ * @param arr: Pointer to the heap
+ * @param root: Index of the element to sift down
+ * @param size: Number of elements in the heap
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
  */
-int main() {
-    int arr[5] = {4,2,7,1,6};
-    int size = sizeof(arr)/4;
-    sort_array(arr, 5, ascending);
-    for(int i=0; i<5; i++) {
-        printf("%d ", arr[i]);
+static void heap_sift_down(int* arr, size_t root, size_t size, int (*cmp)(int, int)) {
+    while(2*root + 1 < size) {
+        size_t child = 2*root + 1;
+        // Pick the child that belongs later in sorted order
+        if(child + 1 < size && cmp(arr[child], arr[child+1])) child++;
+        if(!cmp(arr[root], arr[child])) return;
+        swap_values(arr+root, arr+child);
+        root = child;
     }
-}
\ No newline at end of file
+}
+
+/*
+ * Sorts an integer array using the heap sort algorithm.
+ * @param arr: Pointer to the array to sort
+ * @param size: Number of elements in the array
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void heap_sort_array(int* arr, size_t size, int (*cmp)(int, int)) {
+    if(size < 2) return;
+
+    // Build the heap bottom-up: O(n)
+    for(size_t i=size/2; i-- > 0; ) {
+        heap_sift_down(arr, i, size, cmp);
+    }
+
+    // Move the root (last element in sorted order) behind the heap, shrink the heap by one
+    for(size_t end=size-1; end>0; end--) {
+        swap_values(arr, arr+end);
+        heap_sift_down(arr, 0, end, cmp);
+    }
+}
+
+
+
+// ------------------------------------
+
+
+/*
+Quick Sort Algorithm (introsort):
+--------------------------------------------
+Quick sort picks a pivot, partitions the array into elements that belong before the pivot and elements that belong after it, and sorts both parts.
+
+STEPS:
+    1.  Choose the median of the first, middle and last element as the pivot.
+    2.  Partition the range around the pivot (Hoare partition: two indices walk towards each other swapping misplaced pairs).
+    3.  Recurse into the smaller part and loop on the larger one, so the stack depth stays O(log n).
+    4.  Ranges shorter than SORT_INSERTION_THRESHOLD are finished by insertion sort.
+    5.  If the recursion gets deeper than 2*log2(n) the pivots are bad: fall back to heap sort for that range.
+
+COMPLEXITY:
+    Time Complexity: O(n log n) in the worst case (thanks to the heap sort fallback), with quick sort's speed on average.
+    Space Complexity: O(log n) stack.
+
+NOTE:
+    Not stable: equal elements may change their relative order.
+*/
+
+/*
+ * Orders arr[a], arr[b], arr[c] and returns the median value.
+ */
+static int median_of_three(int* arr, size_t a, size_t b, size_t c, int (*cmp)(int, int)) {
+    if(cmp(arr[b], arr[a])) swap_values(arr+a, arr+b);
+    if(cmp(arr[c], arr[b])) {
+        swap_values(arr+b, arr+c);
+        if(cmp(arr[b], arr[a])) swap_values(arr+a, arr+b);
+    }
+    return arr[b];
+}
+
+/*
+ * Introsort loop over arr[0..size).
+ * @param depth_limit: Number of partitioning levels left before switching to heap sort
+ */
+static void quick_sort_range(int* arr, size_t size, int depth_limit, int (*cmp)(int, int)) {
+    while(size > SORT_INSERTION_THRESHOLD) {
+        if(depth_limit-- == 0) {
+            heap_sort_array(arr, size, cmp);
+            return;
+        }
+
+        int pivot = median_of_three(arr, 0, size/2, size-1, cmp);
+
+        // Hoare partition: arr[0] <= pivot <= arr[size-1] act as sentinels
+        size_t i = 0, j = size-1;
+        for(;;) {
+            while(cmp(arr[++i], pivot));
+            while(cmp(pivot, arr[--j]));
+            if(i >= j) break;
+            swap_values(arr+i, arr+j);
+        }
+
+        // arr[0..i) and arr[i..size) are now the two parts
+        if(i < size - i) {
+            quick_sort_range(arr, i, depth_limit, cmp);
+            arr += i;
+            size -= i;
+        } else {
+            quick_sort_range(arr+i, size-i, depth_limit, cmp);
+            size = i;
+        }
+    }
+    insertion_sort_array(arr, size, cmp);
+}
+
+/*
+ * Sorts an integer array using quick sort with median-of-three pivots,
+ * insertion sort for short ranges and a heap sort fallback (introsort).
+ * @param arr: Pointer to the array to sort
+ * @param size: Number of elements in the array
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void quick_sort_array(int* arr, size_t size, int (*cmp)(int, int)) {
+    int depth_limit = 0;
+    for(size_t n=size; n>1; n>>=1) depth_limit += 2;
+    quick_sort_range(arr, size, depth_limit, cmp);
+}
+
+
+
+// ------------------------------------
+
+
+/*
+Argsort / Key-Payload Sort (stable merge sort):
+--------------------------------------------
+Sorts (key, original index) pairs instead of bare keys, so the result says WHERE every key came from.
+That index order (the permutation) can then be applied to any number of other columns, or used to move
+fixed-size payload records along with their keys.
+
+STEPS:
+    1.  Build the pair array (keys[i], i).
+    2.  Sort runs of ARGSORT_RUN pairs with (stable) insertion sort.
+    3.  Merge neighbouring runs bottom-up, doubling the run length each pass, ping-ponging between two buffers.
+        A merge takes from the right run only if its key is strictly before the left one, which keeps equal
+        keys in their original order (stable). Runs that are already in order are copied without merging.
+    4.  Read the indices (and for the key-payload sort, gather the payloads) out of the sorted pairs.
+
+COMPLEXITY:
+    Time Complexity: O(n log n); payload records are moved exactly once, in the final gather.
+    Space Complexity: O(n) for the pair buffers, plus O(n * payload_size) for the gather buffer.
+*/
+#define ARGSORT_RUN 32
+
+typedef struct sort_pair {
+    int key;
+    size_t idx;
+} sort_pair;
+
+/*
+ * Allocates memory or exits the program (same policy as the containers in data_structures/).
+ */
+static void* sort_alloc(size_t bytes) {
+    void* p = malloc(bytes ? bytes : 1);
+    if(!p) {
+        printf("Memory allocation failed: couldn't allocate %zu bytes for sorting\n", bytes);
+        exit(1);
+    }
+    return p;
+}
+
+/*
+ * Merges the sorted ranges src[lo..mid) and src[mid..hi) into dst[lo..hi). Ties are taken from the left (stable).
+ */
+static void pair_merge(const sort_pair* src, size_t lo, size_t mid, size_t hi, sort_pair* dst, int (*cmp)(int, int)) {
+    size_t i = lo, j = mid, out = lo;
+
+    // Already in order: nothing to interleave
+    if(!cmp(src[mid].key, src[mid-1].key)) {
+        memcpy(dst+lo, src+lo, (hi-lo) * sizeof(sort_pair));
+        return;
+    }
+
+    while(i < mid && j < hi) {
+        if(cmp(src[j].key, src[i].key)) dst[out++] = src[j++];
+        else dst[out++] = src[i++];
+    }
+    while(i < mid) dst[out++] = src[i++];
+    while(j < hi) dst[out++] = src[j++];
+}
+
+/*
+ * Returns a malloc'ed array of the (key, index) pairs of keys in stable sorted order.
+ */
+static sort_pair* argsort_pairs(const int* keys, size_t size, int (*cmp)(int, int)) {
+    sort_pair* src = (sort_pair*) sort_alloc(size * sizeof(sort_pair));
+    sort_pair* dst = (sort_pair*) sort_alloc(size * sizeof(sort_pair));
+
+    // Stable insertion sort on every run of ARGSORT_RUN pairs
+    for(size_t lo=0; lo<size; lo+=ARGSORT_RUN) {
+        size_t hi = lo + ARGSORT_RUN < size ? lo + ARGSORT_RUN : size;
+        for(size_t i=lo; i<hi; i++) {
+            sort_pair val = {keys[i], i};
+            size_t j = i;
+            while(j > lo && cmp(val.key, src[j-1].key)) {
+                src[j] = src[j-1];
+                j--;
+            }
+            src[j] = val;
+        }
+    }
+
+    // Bottom-up merge passes
+    for(size_t width=ARGSORT_RUN; width<size; width*=2) {
+        for(size_t lo=0; lo<size; lo+=2*width) {
+            size_t mid = lo + width < size ? lo + width : size;
+            size_t hi = lo + 2*width < size ? lo + 2*width : size;
+            if(mid == hi) memcpy(dst+lo, src+lo, (hi-lo) * sizeof(sort_pair));
+            else pair_merge(src, lo, mid, hi, dst, cmp);
+        }
+        sort_pair* t = src;
+        src = dst;
+        dst = t;
+    }
+
+    free(dst);
+    return src;
+}
+
+/*
+ * Computes the stable sorting permutation of keys.
+ * @param keys: Pointer to the keys (not modified)
+ * @param size: Number of keys
+ * @param perm: Output, size entries: perm[i] is the index of the key that belongs at position i
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void int_argsort(const int* keys, size_t size, size_t* perm, int (*cmp)(int, int)) {
+    if(!keys || !perm || !cmp || size == 0) return;
+
+    sort_pair* pairs = argsort_pairs(keys, size, cmp);
+    for(size_t i=0; i<size; i++) perm[i] = pairs[i].idx;
+    free(pairs);
+}
+
+/*
+ * Stable sort of keys with a fixed-size payload record per key.
+ * @param keys: Pointer to the keys, sorted in place
+ * @param payloads: Pointer to size records of payload_size bytes, reordered together with the keys
+ * @param payload_size: Size of one payload record in bytes
+ * @param size: Number of keys
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void int_sort_key_payload(int* keys, void* payloads, size_t payload_size, size_t size, int (*cmp)(int, int)) {
+    if(!keys || !cmp || size == 0) return;
+
+    sort_pair* pairs = argsort_pairs(keys, size, cmp);
+    for(size_t i=0; i<size; i++) keys[i] = pairs[i].key;
+
+    // Move every payload once: gather into a scratch buffer, copy back
+    if(payloads && payload_size > 0) {
+        size_t* perm = (size_t*) sort_alloc(size * sizeof(size_t));
+        for(size_t i=0; i<size; i++) perm[i] = pairs[i].idx;
+
+        char* scratch = (char*) sort_alloc(size * payload_size);
+        gather_by_permutation(payloads, payload_size, perm, size, scratch);
+        memcpy(payloads, scratch, size * payload_size);
+        free(scratch);
+        free(perm);
+    }
+    free(pairs);
+}
+
+/*
+ * Gathers elements of another column by a permutation (e.g. the output of int_argsort).
+ * @param src: Pointer to the source column (any alignment, e.g. records inside a packed buffer)
+ * @param elem_size: Size of one element in bytes
+ * @param perm: Permutation: dst[i] = src[perm[i]]
+ * @param size: Number of elements
+ * @param dst: Pointer to the destination column (must not overlap src)
+ */
+void gather_by_permutation(const void* src, size_t elem_size, const size_t* perm, size_t size, void* dst) {
+    if(!src || !perm || !dst) return;
+
+    // Fixed-size memcpy for the common widths (one load and store each, with no alignment
+    // assumption about the records), variable-size memcpy for everything else
+    const char* s = (const char*) src;
+    char* d = (char*) dst;
+    switch(elem_size) {
+        case 4:
+            for(size_t i=0; i<size; i++) memcpy(d + i*4, s + perm[i]*4, 4);
+            return;
+        case 8:
+            for(size_t i=0; i<size; i++) memcpy(d + i*8, s + perm[i]*8, 8);
+            return;
+        default:
+            for(size_t i=0; i<size; i++) memcpy(d + i*elem_size, s + perm[i]*elem_size, elem_size);
+            return;
+    }
+}
+
+
+
+// ------------------------------------
+
+
+/*
+Adaptive Merge Sort Algorithm (Timsort-style):
+--------------------------------------------
+A stable merge sort that exploits order already present in the input instead of starting from single elements.
+
+STEPS:
+    1.  Scan the array for natural runs: maximal non-descending stretches, or strictly descending stretches
+        (those are reversed in place; strictness keeps the sort stable).
+    2.  Runs shorter than minrun (32..64, chosen so n/minrun is close to a power of two) are extended to minrun
+        elements with binary insertion sort.
+    3.  Push every run on a stack and merge neighbouring runs whenever the run lengths stop shrinking fast enough
+        (len[i-2] > len[i-1] + len[i] and len[i-1] > len[i]). This keeps merges balanced and the stack O(log n) deep.
+    4.  Before merging two runs, gallop to skip the prefix of the left run that is already before the right run and
+        the suffix of the right run that is already after the left run - those elements never move.
+    5.  While merging, if one run wins ADAPTIVE_MIN_GALLOP times in a row, switch to galloping (exponential search
+        for where the other run's head goes, then bulk copy). The threshold adapts to how well galloping pays off.
+
+COMPLEXITY:
+    Time Complexity: O(n) on sorted or reverse-sorted input, O(n log r) for input made of r runs, O(n log n) worst case.
+    Space Complexity: O(n/2) merge buffer (only the shorter of the two runs is copied aside).
+*/
+#define ADAPTIVE_MIN_GALLOP 7
+#define ADAPTIVE_MAX_PENDING 85   // Enough run-stack entries for 2^64 elements
+
+typedef struct adaptive_sort_state {
+    int (*cmp)(int, int);
+    int* tmp;                         // Merge buffer
+    size_t tmp_size;
+    ptrdiff_t min_gallop;
+    size_t npending;
+    int* run_base[ADAPTIVE_MAX_PENDING];
+    size_t run_len[ADAPTIVE_MAX_PENDING];
+} adaptive_sort_state;
+
+/*
+ * Smallest run length worth building for n elements: n/minrun is a power of two or slightly below.
+ */
+static size_t adaptive_min_run(size_t n) {
+    size_t r = 0;
+    while(n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/*
+ * Length of the natural run starting at lo. Strictly descending runs are reversed, so the run is always in order.
+ */
+static size_t adaptive_count_run(int* lo, int* hi, int (*cmp)(int, int)) {
+    if(lo + 1 == hi) return 1;
+
+    size_t n = 2;
+    if(cmp(lo[1], lo[0])) {
+        for(int* p=lo+2; p<hi && cmp(*p, p[-1]); p++) n++;
+        for(int *a=lo, *b=lo+n-1; a<b; a++, b--) swap_values(a, b);
+    } else {
+        for(int* p=lo+2; p<hi && !cmp(*p, p[-1]); p++) n++;
+    }
+    return n;
+}
+
+/*
+ * Binary insertion sort of lo[0..n), where lo[0..start) is already sorted. Stable: equal keys go right.
+ */
+static void adaptive_binary_insertion(int* lo, size_t n, size_t start, int (*cmp)(int, int)) {
+    for(size_t i=start; i<n; i++) {
+        int pivot = lo[i];
+        size_t l = 0, r = i;
+        while(l < r) {
+            size_t m = l + (r-l)/2;
+            if(cmp(pivot, lo[m])) r = m;
+            else l = m + 1;
+        }
+        memmove(lo+l+1, lo+l, (i-l) * sizeof(int));
+        lo[l] = pivot;
+    }
+}
+
+/*
+ * Leftmost position k in sorted a[0..n) with a[k-1] < key <= a[k]. Starts galloping at a[hint].
+ */
+static size_t adaptive_gallop_left(int key, const int* a, ptrdiff_t n, ptrdiff_t hint, int (*cmp)(int, int)) {
+    ptrdiff_t lastofs = 0, ofs = 1;
+    if(cmp(a[hint], key)) {
+        // a[hint] < key: gallop right until a[hint+lastofs] < key <= a[hint+ofs]
+        ptrdiff_t maxofs = n - hint;
+        while(ofs < maxofs && cmp(a[hint+ofs], key)) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if(ofs > maxofs) ofs = maxofs;
+        lastofs += hint;
+        ofs += hint;
+    } else {
+        // key <= a[hint]: gallop left until a[hint-ofs] < key <= a[hint-lastofs]
+        ptrdiff_t maxofs = hint + 1;
+        while(ofs < maxofs && !cmp(a[hint-ofs], key)) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if(ofs > maxofs) ofs = maxofs;
+        ptrdiff_t k = lastofs;
+        lastofs = hint - ofs;
+        ofs = hint - k;
+    }
+
+    // Binary search in (lastofs, ofs]
+    lastofs++;
+    while(lastofs < ofs) {
+        ptrdiff_t m = lastofs + ((ofs - lastofs) >> 1);
+        if(cmp(a[m], key)) lastofs = m + 1;
+        else ofs = m;
+    }
+    return (size_t)ofs;
+}
+
+/*
+ * Rightmost position k in sorted a[0..n) with a[k-1] <= key < a[k]. Starts galloping at a[hint].
+ */
+static size_t adaptive_gallop_right(int key, const int* a, ptrdiff_t n, ptrdiff_t hint, int (*cmp)(int, int)) {
+    ptrdiff_t lastofs = 0, ofs = 1;
+    if(cmp(key, a[hint])) {
+        // key < a[hint]: gallop left until a[hint-ofs] <= key < a[hint-lastofs]
+        ptrdiff_t maxofs = hint + 1;
+        while(ofs < maxofs && cmp(key, a[hint-ofs])) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if(ofs > maxofs) ofs = maxofs;
+        ptrdiff_t k = lastofs;
+        lastofs = hint - ofs;
+        ofs = hint - k;
+    } else {
+        // a[hint] <= key: gallop right until a[hint+lastofs] <= key < a[hint+ofs]
+        ptrdiff_t maxofs = n - hint;
+        while(ofs < maxofs && !cmp(key, a[hint+ofs])) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if(ofs > maxofs) ofs = maxofs;
+        lastofs += hint;
+        ofs += hint;
+    }
+
+    // Binary search in (lastofs, ofs]
+    lastofs++;
+    while(lastofs < ofs) {
+        ptrdiff_t m = lastofs + ((ofs - lastofs) >> 1);
+        if(cmp(key, a[m])) ofs = m;
+        else lastofs = m + 1;
+    }
+    return (size_t)ofs;
+}
+
+/*
+ * Makes sure the merge buffer holds at least need ints.
+ */
+static void adaptive_reserve(adaptive_sort_state* st, size_t need) {
+    if(need <= st->tmp_size) return;
+    free(st->tmp);
+    st->tmp = (int*) sort_alloc(need * sizeof(int));
+    st->tmp_size = need;
+}
+
+/*
+ * Merges the adjacent runs a[0..na) and b[0..nb) (b == a+na) left to right, na <= nb.
+ * Requires b[0] < a[0] and a[na-1] to be after every b element (established by merge_at's gallops).
+ */
+static void adaptive_merge_lo(adaptive_sort_state* st, int* a, ptrdiff_t na, int* b, ptrdiff_t nb) {
+    int (*cmp)(int, int) = st->cmp;
+    adaptive_reserve(st, (size_t)na);
+    memcpy(st->tmp, a, na * sizeof(int));
+    int* dest = a;
+    a = st->tmp;
+    ptrdiff_t min_gallop = st->min_gallop;
+
+    *dest++ = *b++;
+    if(--nb == 0) goto succeed;
+    if(na == 1) goto copy_b;
+
+    for(;;) {
+        ptrdiff_t acount = 0, bcount = 0;
+
+        // One element at a time until one run keeps winning
+        for(;;) {
+            if(cmp(*b, *a)) {
+                *dest++ = *b++;
+                bcount++;
+                acount = 0;
+                if(--nb == 0) goto succeed;
+                if(bcount >= min_gallop) break;
+            } else {
+                *dest++ = *a++;
+                acount++;
+                bcount = 0;
+                if(--na == 1) goto copy_b;
+                if(acount >= min_gallop) break;
+            }
+        }
+
+        // Galloping mode: copy whole stretches while it pays off
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            st->min_gallop = min_gallop;
+
+            ptrdiff_t k = (ptrdiff_t)adaptive_gallop_right(*b, a, na, 0, cmp);
+            acount = k;
+            if(k) {
+                memcpy(dest, a, k * sizeof(int));
+                dest += k;
+                a += k;
+                na -= k;
+                if(na == 1) goto copy_b;
+                if(na == 0) goto succeed;   // Only possible with an inconsistent cmp
+            }
+            *dest++ = *b++;
+            if(--nb == 0) goto succeed;
+
+            k = (ptrdiff_t)adaptive_gallop_left(*a, b, nb, 0, cmp);
+            bcount = k;
+            if(k) {
+                memmove(dest, b, k * sizeof(int));
+                dest += k;
+                b += k;
+                nb -= k;
+                if(nb == 0) goto succeed;
+            }
+            *dest++ = *a++;
+            if(--na == 1) goto copy_b;
+        } while(acount >= ADAPTIVE_MIN_GALLOP || bcount >= ADAPTIVE_MIN_GALLOP);
+        min_gallop++;
+        st->min_gallop = min_gallop;
+    }
+
+succeed:
+    if(na) memcpy(dest, a, na * sizeof(int));
+    return;
+copy_b:
+    // The last element of a belongs after everything left in b
+    memmove(dest, b, nb * sizeof(int));
+    dest[nb] = *a;
+}
+
+/*
+ * Merges the adjacent runs a[0..na) and b[0..nb) (b == a+na) right to left, na >= nb.
+ * Same preconditions as adaptive_merge_lo.
+ */
+static void adaptive_merge_hi(adaptive_sort_state* st, int* a, ptrdiff_t na, int* b, ptrdiff_t nb) {
+    int (*cmp)(int, int) = st->cmp;
+    adaptive_reserve(st, (size_t)nb);
+    memcpy(st->tmp, b, nb * sizeof(int));
+    int* dest = b + nb - 1;
+    int* basea = a;
+    int* baseb = st->tmp;
+    b = st->tmp + nb - 1;
+    a += na - 1;
+    ptrdiff_t min_gallop = st->min_gallop;
+
+    *dest-- = *a--;
+    if(--na == 0) goto succeed;
+    if(nb == 1) goto copy_a;
+
+    for(;;) {
+        ptrdiff_t acount = 0, bcount = 0;
+
+        // One element at a time until one run keeps winning
+        for(;;) {
+            if(cmp(*b, *a)) {
+                *dest-- = *a--;
+                acount++;
+                bcount = 0;
+                if(--na == 0) goto succeed;
+                if(acount >= min_gallop) break;
+            } else {
+                *dest-- = *b--;
+                bcount++;
+                acount = 0;
+                if(--nb == 1) goto copy_a;
+                if(bcount >= min_gallop) break;
+            }
+        }
+
+        // Galloping mode: copy whole stretches while it pays off
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            st->min_gallop = min_gallop;
+
+            ptrdiff_t k = na - (ptrdiff_t)adaptive_gallop_right(*b, basea, na, na-1, cmp);
+            acount = k;
+            if(k) {
+                dest -= k;
+                a -= k;
+                memmove(dest+1, a+1, k * sizeof(int));
+                na -= k;
+                if(na == 0) goto succeed;
+            }
+            *dest-- = *b--;
+            if(--nb == 1) goto copy_a;
+
+            k = nb - (ptrdiff_t)adaptive_gallop_left(*a, baseb, nb, nb-1, cmp);
+            bcount = k;
+            if(k) {
+                dest -= k;
+                b -= k;
+                memcpy(dest+1, b+1, k * sizeof(int));
+                nb -= k;
+                if(nb == 1) goto copy_a;
+                if(nb == 0) goto succeed;   // Only possible with an inconsistent cmp
+            }
+            *dest-- = *a--;
+            if(--na == 0) goto succeed;
+        } while(acount >= ADAPTIVE_MIN_GALLOP || bcount >= ADAPTIVE_MIN_GALLOP);
+        min_gallop++;
+        st->min_gallop = min_gallop;
+    }
+
+succeed:
+    if(nb) memcpy(dest-(nb-1), baseb, nb * sizeof(int));
+    return;
+copy_a:
+    // The first element of b belongs before everything left in a
+    dest -= na;
+    a -= na;
+    memmove(dest+1, a+1, na * sizeof(int));
+    *dest = *b;
+}
+
+/*
+ * Merges the pending runs i and i+1 and replaces them by the merged run on the stack.
+ */
+static void adaptive_merge_at(adaptive_sort_state* st, size_t i) {
+    int (*cmp)(int, int) = st->cmp;
+    int* a = st->run_base[i];
+    int* b = st->run_base[i+1];
+    ptrdiff_t na = (ptrdiff_t)st->run_len[i];
+    ptrdiff_t nb = (ptrdiff_t)st->run_len[i+1];
+
+    st->run_len[i] = (size_t)(na + nb);
+    if(i + 3 == st->npending) {
+        st->run_base[i+1] = st->run_base[i+2];
+        st->run_len[i+1] = st->run_len[i+2];
+    }
+    st->npending--;
+
+    // Elements of a that are already before b[0] stay where they are
+    size_t k = adaptive_gallop_right(*b, a, na, 0, cmp);
+    a += k;
+    na -= (ptrdiff_t)k;
+    if(na == 0) return;
+
+    // Elements of b that are already after a's last element stay where they are
+    nb = (ptrdiff_t)adaptive_gallop_left(a[na-1], b, nb, nb-1, cmp);
+    if(nb == 0) return;
+
+    if(na <= nb) adaptive_merge_lo(st, a, na, b, nb);
+    else adaptive_merge_hi(st, a, na, b, nb);
+}
+
+/*
+ * Merges pending runs until the stack invariants hold again.
+ */
+static void adaptive_merge_collapse(adaptive_sort_state* st) {
+    size_t* len = st->run_len;
+    while(st->npending > 1) {
+        size_t i = st->npending - 2;
+        if((i > 0 && len[i-1] <= len[i] + len[i+1]) || (i > 1 && len[i-2] <= len[i-1] + len[i])) {
+            if(len[i-1] < len[i+1]) i--;
+            adaptive_merge_at(st, i);
+        } else if(len[i] <= len[i+1]) {
+            adaptive_merge_at(st, i);
+        } else {
+            break;
+        }
+    }
+}
+
+/*
+ * Sorts an integer array with a stable, run-adaptive merge sort (Timsort-style).
+ * @param arr: Pointer to the array to sort
+ * @param size: Number of elements in the array
+ * @param cmp: Pointer to comparison function (returns 1 if in order, 0 if not)
+ */
+void tim_sort_array(int* arr, size_t size, int (*cmp)(int, int)) {
+    if(!arr || !cmp || size < 2) return;
+
+    adaptive_sort_state st;
+    st.cmp = cmp;
+    st.tmp = NULL;
+    st.tmp_size = 0;
+    st.min_gallop = ADAPTIVE_MIN_GALLOP;
+    st.npending = 0;
+
+    size_t min_run = adaptive_min_run(size);
+    int* lo = arr;
+    int* hi = arr + size;
+    while(lo < hi) {
+        // Find the next natural run, extend it to min_run if it is short
+        size_t n = adaptive_count_run(lo, hi, cmp);
+        if(n < min_run) {
+            size_t forced = (size_t)(hi - lo) < min_run ? (size_t)(hi - lo) : min_run;
+            adaptive_binary_insertion(lo, forced, n, cmp);
+            n = forced;
+        }
+
+        st.run_base[st.npending] = lo;
+        st.run_len[st.npending] = n;
+        st.npending++;
+        adaptive_merge_collapse(&st);
+        lo += n;
+    }
+
+    // Merge whatever is left on the stack
+    while(st.npending > 1) {
+        size_t i = st.npending - 2;
+        if(i > 0 && st.run_len[i-1] < st.run_len[i+1]) i--;
+        adaptive_merge_at(&st, i);
+    }
+    free(st.tmp);
+}
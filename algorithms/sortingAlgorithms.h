@@ -0,0 +1,59 @@
+#ifndef DSA_SORTING_ALGORITHMS_H
+#define DSA_SORTING_ALGORITHMS_H
+
+#include <stddef.h>
+
+
+/*
+* Comparison-based sorting routines for int arrays.
+* Every sort takes a `cmp` callback that returns 1 if its two arguments are
+* already in order (`ascending` / `descending` below), 0 otherwise.
+*/
+
+// Print the elements of an integer array on one line
+void print_sorted_arr(int* arr, int size);
+
+// Comparison callback for ascending order - returns 1 if a < b, else 0
+int ascending(int a, int b);
+
+// Comparison callback for descending order - returns 1 if a > b, else 0
+int descending(int a, int b);
+
+// Swap the values of two integer variables
+void swap_values(int* a, int* b);
+
+#ifdef SORT_COUNT_SWAPS
+// Number of swap_values calls so far - only available when built with -DSORT_COUNT_SWAPS
+extern unsigned long long sort_swap_count;
+#endif
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Bubble sort - O(n^2), in place, stops early once a pass makes no swaps
+void bubble_sort_array(int* arr, int size, int (*cmp)(int, int));
+
+// Insertion sort - O(n^2) worst case, O(n) on sorted input. Used for short ranges by the faster sorts
+void insertion_sort_array(int* arr, size_t size, int (*cmp)(int, int));
+
+// Heap sort - O(n log n) worst case, in place
+void heap_sort_array(int* arr, size_t size, int (*cmp)(int, int));
+
+// Quick sort (introsort variant) - O(n log n) worst case, in place, not stable
+void quick_sort_array(int* arr, size_t size, int (*cmp)(int, int));
+
+// Adaptive merge sort (Timsort-style) - stable, O(n) on sorted input, O(n log r) for r natural runs
+void tim_sort_array(int* arr, size_t size, int (*cmp)(int, int));
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Stable argsort: fills perm[0..size) so that keys[perm[0]], keys[perm[1]], ... is in sorted order. keys is not modified
+void int_argsort(const int* keys, size_t size, size_t* perm, int (*cmp)(int, int));
+
+// Stable sort of keys that moves the payload record (payload_size bytes) of every key along with it
+void int_sort_key_payload(int* keys, void* payloads, size_t payload_size, size_t size, int (*cmp)(int, int));
+
+// Apply a permutation to another column: dst[i] = src[perm[i]] for elements of elem_size bytes (src != dst)
+void gather_by_permutation(const void* src, size_t elem_size, const size_t* perm, size_t size, void* dst);
+
+
+#endif /* DSA_SORTING_ALGORITHMS_H */
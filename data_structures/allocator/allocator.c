@@ -0,0 +1,291 @@
+#include "allocator.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define ARENA_DEFAULT_CHUNK ((size_t)1 << 20)
+#define DSA_MALLOC_ALIGN 16                         // Alignment malloc guarantees on 64-bit targets
+
+#define TCACHE_STEP 16                              // Size classes: 16, 32, 48, ... TCACHE_MAX_SIZE bytes
+#define TCACHE_CLASSES (TCACHE_MAX_SIZE / TCACHE_STEP)
+#define TCACHE_MAX_CACHED 65536                     // Blocks kept per class and thread; the rest go back to libc
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Bump-pointer arena
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+typedef struct arena_chunk {
+	struct arena_chunk* next;
+	size_t size;             // Usable bytes after the header
+	size_t used;
+} arena_chunk;
+
+typedef struct arena {
+	dsa_allocator allocator; // ctx points back to the arena
+	arena_chunk* first;
+	arena_chunk* current;    // Chunk allocations are taken from; later chunks are empty
+	void* last;              // Most recent allocation, the only one free / realloc can undo in place
+	size_t chunk_bytes;
+	size_t used;
+} arena;
+
+
+// Chunk header rounded up, so chunk data starts on a DSA_MALLOC_ALIGN boundary
+#define ARENA_HEADER ((sizeof(arena_chunk) + DSA_MALLOC_ALIGN - 1) / DSA_MALLOC_ALIGN * DSA_MALLOC_ALIGN)
+
+static inline char* arena_chunk_data(arena_chunk* c) {
+	return (char*)c + ARENA_HEADER;
+}
+
+// Offset inside c where a block with this alignment can start, or SIZE_MAX if size doesn't fit
+static size_t arena_fit(arena_chunk* c, size_t size, size_t alignment) {
+	uintptr_t base = (uintptr_t)arena_chunk_data(c);
+	uintptr_t start = (base + c->used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	size_t offset = (size_t)(start - base);
+	return offset + size <= c->size ? offset : SIZE_MAX;
+}
+
+static void* arena_alloc(void* ctx, size_t size, size_t alignment) {
+	arena* a = (arena*) ctx;
+	if (alignment < DSA_MALLOC_ALIGN) alignment = DSA_MALLOC_ALIGN;
+
+	// Current chunk, then the chunks kept by arena_reset, then a new chunk
+	size_t offset = SIZE_MAX;
+	while (a->current && (offset = arena_fit(a->current, size, alignment)) == SIZE_MAX && a->current->next) {
+		a->current = a->current->next;
+	}
+	if (offset == SIZE_MAX) {
+		size_t bytes = size + alignment > a->chunk_bytes ? size + alignment : a->chunk_bytes;
+		arena_chunk* c = (arena_chunk*) malloc(ARENA_HEADER + bytes);
+		if (!c) return NULL;
+		c->next = NULL;
+		c->size = bytes;
+		c->used = 0;
+		if (a->current) a->current->next = c;
+		else a->first = c;
+		a->current = c;
+		offset = arena_fit(c, size, alignment);
+	}
+
+	char* ptr = arena_chunk_data(a->current) + offset;
+	a->used += offset + size - a->current->used;
+	a->current->used = offset + size;
+	a->last = ptr;
+	return ptr;
+}
+
+static void* arena_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size) {
+	arena* a = (arena*) ctx;
+	if (!ptr) return arena_alloc(ctx, new_size, 0);
+
+	// The last allocation grows or shrinks in place while it fits in its chunk
+	if (ptr == a->last) {
+		size_t offset = (size_t)((char*)ptr - arena_chunk_data(a->current));
+		if (offset + new_size <= a->current->size) {
+			a->used = a->used - old_size + new_size;
+			a->current->used = offset + new_size;
+			return ptr;
+		}
+	}
+
+	void* moved = arena_alloc(ctx, new_size, 0);
+	if (moved) memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+	return moved;
+}
+
+static void arena_release(void* ctx, void* ptr, size_t size) {
+	arena* a = (arena*) ctx;
+
+	// Only the last allocation can be given back; everything else waits for arena_reset
+	if (ptr && ptr == a->last) {
+		a->current->used = (size_t)((char*)ptr - arena_chunk_data(a->current));
+		a->used -= size;
+		a->last = NULL;
+	}
+}
+
+
+arena* arena_create(size_t chunk_bytes) {
+	// Memory allocation: arena struct
+	arena* a = (arena*) malloc(sizeof(arena));
+	if (!a) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct arena!\n");
+		exit(1);
+	}
+
+	a->allocator.alloc = arena_alloc;
+	a->allocator.realloc = arena_realloc;
+	a->allocator.free = arena_release;
+	a->allocator.ctx = a;
+	a->first = NULL;
+	a->current = NULL;
+	a->last = NULL;
+	a->chunk_bytes = chunk_bytes ? chunk_bytes : ARENA_DEFAULT_CHUNK;
+	a->used = 0;
+	return a;
+}
+
+
+const dsa_allocator* arena_allocator(arena* a) {
+	// Validate input parameter: a
+	if (!a) {
+		printf("arena_allocator: NULL arena pointer\n");
+		return NULL;
+	}
+
+	return &a->allocator;
+}
+
+
+void arena_reset(arena* a) {
+	// Validate input parameter: a
+	if (!a) return;
+
+	for (arena_chunk* c = a->first; c; c = c->next) c->used = 0;
+	a->current = a->first;
+	a->last = NULL;
+	a->used = 0;
+}
+
+
+size_t arena_used(const arena* a) {
+	return a ? a->used : 0;
+}
+
+
+void arena_free(arena* a) {
+	// Validate input parameter: a
+	if (!a) return;
+
+	arena_chunk* c = a->first;
+	while (c) {
+		arena_chunk* next = c->next;
+		free(c);
+		c = next;
+	}
+	free(a);
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Thread-local cache allocator
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+/*
+* Every thread keeps a singly linked free list per size class, threaded through the free blocks.
+* Blocks come from malloc rounded up to their class size, so a block freed by another thread (or
+* past the per-class limit) can always go back to libc. Requests with an alignment above malloc's
+* bypass the cache on allocation; their blocks may still be cached on free, as they fit the class.
+* The state is released by tcache_flush or automatically when the thread exits.
+*/
+
+typedef struct tcache_block {
+	struct tcache_block* next;
+} tcache_block;
+
+typedef struct tcache_state {
+	tcache_block* lists[TCACHE_CLASSES];
+	size_t counts[TCACHE_CLASSES];
+} tcache_state;
+
+static _Thread_local tcache_state* tcache_local = NULL;
+static pthread_key_t tcache_key;
+static pthread_once_t tcache_key_once = PTHREAD_ONCE_INIT;
+
+
+static void tcache_release_state(void* state) {
+	tcache_state* s = (tcache_state*) state;
+	for (size_t c = 0; c < TCACHE_CLASSES; c++) {
+		tcache_block* b = s->lists[c];
+		while (b) {
+			tcache_block* next = b->next;
+			free(b);
+			b = next;
+		}
+	}
+	free(s);
+}
+
+static void tcache_make_key(void) {
+	pthread_key_create(&tcache_key, tcache_release_state);
+}
+
+// The calling thread's state, created on first use (NULL if it can't be allocated)
+static tcache_state* tcache_get_state(void) {
+	if (tcache_local) return tcache_local;
+	pthread_once(&tcache_key_once, tcache_make_key);
+	tcache_state* s = (tcache_state*) calloc(1, sizeof(tcache_state));
+	if (!s) return NULL;
+	pthread_setspecific(tcache_key, s);
+	tcache_local = s;
+	return s;
+}
+
+static inline size_t tcache_class(size_t size) {
+	return size == 0 ? 0 : (size - 1) / TCACHE_STEP;
+}
+
+static void* tcache_alloc(void* ctx, size_t size, size_t alignment) {
+	(void)ctx;
+	if (size > TCACHE_MAX_SIZE || alignment > DSA_MALLOC_ALIGN) return dsa_libc_alloc(NULL, size, alignment);
+
+	size_t c = tcache_class(size);
+	tcache_state* s = tcache_get_state();
+	if (s && s->lists[c]) {
+		tcache_block* b = s->lists[c];
+		s->lists[c] = b->next;
+		s->counts[c]--;
+		return b;
+	}
+	return malloc((c + 1) * TCACHE_STEP);
+}
+
+static void tcache_release(void* ctx, void* ptr, size_t size) {
+	(void)ctx;
+	if (!ptr) return;
+	if (size > TCACHE_MAX_SIZE) {
+		free(ptr);
+		return;
+	}
+
+	size_t c = tcache_class(size);
+	tcache_state* s = tcache_get_state();
+	if (!s || s->counts[c] >= TCACHE_MAX_CACHED) {
+		free(ptr);
+		return;
+	}
+	tcache_block* b = (tcache_block*) ptr;
+	b->next = s->lists[c];
+	s->lists[c] = b;
+	s->counts[c]++;
+}
+
+static void* tcache_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size) {
+	if (!ptr) return tcache_alloc(ctx, new_size, 0);
+
+	// Same class: the block already has room
+	if (old_size <= TCACHE_MAX_SIZE && new_size <= TCACHE_MAX_SIZE && new_size != 0
+	    && tcache_class(old_size) == tcache_class(new_size)) return ptr;
+	// Both large: plain libc realloc
+	if (old_size > TCACHE_MAX_SIZE && new_size > TCACHE_MAX_SIZE) return realloc(ptr, new_size);
+
+	void* moved = tcache_alloc(ctx, new_size, 0);
+	if (!moved) return NULL;
+	memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+	tcache_release(ctx, ptr, old_size);
+	return moved;
+}
+
+
+const dsa_allocator* tcache_allocator(void) {
+	static const dsa_allocator allocator = { tcache_alloc, tcache_realloc, tcache_release, NULL };
+	return &allocator;
+}
+
+
+void tcache_flush(void) {
+	if (!tcache_local) return;
+	pthread_setspecific(tcache_key, NULL);
+	tcache_release_state(tcache_local);
+	tcache_local = NULL;
+}
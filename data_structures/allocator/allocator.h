@@ -0,0 +1,104 @@
+#ifndef DSA_ALLOCATOR_H
+#define DSA_ALLOCATOR_H
+
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*
+* Allocator interface for the containers: a table of alloc / realloc / free functions plus a context
+* pointer handed back to every call. Containers take a `const dsa_allocator*` at creation time
+* (NULL = dsa_default_allocator) and release everything through the same allocator.
+*
+* free and realloc receive the size of the block, so allocators need no per-block header.
+* alignment is 0 for the natural malloc alignment, otherwise a power of two.
+*
+* Shipped allocators:
+*   dsa_default_allocator  - malloc / aligned_alloc / realloc / free (header-only)
+*   arena                  - bump pointer over large chunks; free is a no-op, arena_reset releases
+*                            everything at once. Not thread-safe: one arena per thread
+*   tcache_allocator       - per-thread free lists of small blocks (<= TCACHE_MAX_SIZE bytes) in front
+*                            of malloc; blocks may be freed by any thread
+*
+* Allocation failure returns NULL; the containers then print a message and exit, as before.
+*/
+
+typedef struct dsa_allocator {
+	void* (*alloc)(void* ctx, size_t size, size_t alignment);
+	void* (*realloc)(void* ctx, void* ptr, size_t old_size, size_t new_size);
+	void (*free)(void* ctx, void* ptr, size_t size);
+	void* ctx;
+} dsa_allocator;
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Default allocator (libc)
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+static inline void* dsa_libc_alloc(void* ctx, size_t size, size_t alignment) {
+	(void)ctx;
+	if (alignment == 0) return malloc(size);
+	// aligned_alloc wants a size that is a multiple of the alignment
+	return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+static inline void* dsa_libc_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size) {
+	(void)ctx;
+	(void)old_size;
+	return realloc(ptr, new_size);
+}
+
+static inline void dsa_libc_free(void* ctx, void* ptr, size_t size) {
+	(void)ctx;
+	(void)size;
+	free(ptr);
+}
+
+// The libc allocator (what containers use when given NULL)
+static inline const dsa_allocator* dsa_default_allocator(void) {
+	static const dsa_allocator libc_allocator = { dsa_libc_alloc, dsa_libc_realloc, dsa_libc_free, NULL };
+	return &libc_allocator;
+}
+
+// Resolve NULL to the default allocator
+static inline const dsa_allocator* dsa_allocator_or_default(const dsa_allocator* allocator) {
+	return allocator ? allocator : dsa_default_allocator();
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Bump-pointer arena
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+typedef struct arena arena;
+
+// Create an arena that takes memory from libc in chunks of chunk_bytes (0 -> 1 MB). Larger requests get their own chunk
+arena* arena_create(size_t chunk_bytes);
+
+// The arena as an allocator (valid until arena_free)
+const dsa_allocator* arena_allocator(arena* a);
+
+// Release every allocation at once; the chunks are kept for reuse
+void arena_reset(arena* a);
+
+// Bytes handed out since creation or the last reset
+size_t arena_used(const arena* a);
+
+// Delete the arena and all memory allocated from it
+void arena_free(arena* a);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Thread-local cache allocator
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Largest block kept in the per-thread free lists; larger blocks go straight to libc
+#define TCACHE_MAX_SIZE 512
+
+// The thread-local cache allocator (one shared table, per-thread state)
+const dsa_allocator* tcache_allocator(void);
+
+// Return the calling thread's cached blocks to libc (call before a thread exits to avoid keeping them)
+void tcache_flush(void);
+
+
+#endif /* DSA_ALLOCATOR_H */
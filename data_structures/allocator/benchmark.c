@@ -0,0 +1,120 @@
+/*
+Allocator benchmark: static_array and linked_list workloads on the libc, arena and thread-cache allocators.
+
+    Build: gcc -O2 -pthread benchmark.c allocator.c ../arrays/static_array.c ../linked_list/linked_list.c -o alloc_bench
+    Usage: ./alloc_bench [list_nodes=1000000]
+
+Workloads (each run with every allocator, ns per operation):
+  sa create/free   : create a small static_array (capacity 16), fill it, free it
+  ll build         : ll_push_front_with_allocator for list_nodes nodes
+  ll traverse      : walk the list just built (node locality)
+  ll free          : free every node (arena: one arena_reset)
+  ll churn         : after the build, pop and push at the front list_nodes times (a freed node is reused)
+With the arena, frees are no-ops and every round ends with arena_reset.
+Every allocator must produce the same checksums, which the last column reports.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "allocator.h"
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+#define SMALL_ARRAYS 1000000
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+
+int main(int argc, char** argv) {
+    size_t nodes = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    const char* names[3] = { "libc", "arena", "thread cache" };
+    arena* ar = arena_create(0);
+    const dsa_allocator* allocators[3] = { dsa_default_allocator(), arena_allocator(ar), tcache_allocator() };
+    long long reference[3] = { 0, 0, 0 };
+
+    printf("%zu list nodes, %d small arrays\n", nodes, SMALL_ARRAYS);
+    printf("%-13s %16s %10s %13s %9s %10s %8s\n", "allocator", "sa create/free", "ll build", "ll traverse",
+           "ll free", "ll churn", "check");
+    for (int a = 0; a < 3; a++) {
+        const dsa_allocator* alloc = allocators[a];
+        int is_arena = a == 1;
+        long long sums[3] = { 0, 0, 0 };
+
+        // Small arrays
+        double t0 = now_seconds();
+        for (int i = 0; i < SMALL_ARRAYS; i++) {
+            static_array* arr = sa_create_array_with_allocator(16, alloc);
+            for (int k = 0; k < 16; k++) sa_insert_last(arr, i + k);
+            sums[0] += sa_get_last(arr);
+            sa_free(arr);
+            if (is_arena && (i & 1023) == 1023) arena_reset(ar);
+        }
+        double sa_ns = (now_seconds() - t0) * 1e9 / SMALL_ARRAYS;
+        if (is_arena) arena_reset(ar);
+
+        // List build, traverse, free
+        rng_state = 12345;
+        ll_node* head = NULL;
+        t0 = now_seconds();
+        for (size_t i = 0; i < nodes; i++) ll_push_front_with_allocator(&head, (int)(next_random() >> 40), alloc);
+        double build_ns = (now_seconds() - t0) * 1e9 / (double)nodes;
+
+        t0 = now_seconds();
+        for (ll_node* n = head; n; n = ll_next(n)) sums[1] += ll_get_data(n);
+        double walk_ns = (now_seconds() - t0) * 1e9 / (double)nodes;
+
+        t0 = now_seconds();
+        if (is_arena) {
+            head = NULL;
+            arena_reset(ar);
+        } else {
+            ll_free_list_with_allocator(&head, alloc);
+        }
+        double free_ns = (now_seconds() - t0) * 1e9 / (double)nodes;
+
+        // Churn: steady-state pop + push on a full list
+        for (size_t i = 0; i < nodes; i++) ll_push_front_with_allocator(&head, (int)i, alloc);
+        t0 = now_seconds();
+        for (size_t i = 0; i < nodes; i++) {
+            ll_pop_front_with_allocator(&head, alloc);
+            ll_push_front_with_allocator(&head, (int)(i & 0xFFFF), alloc);
+        }
+        double churn_ns = (now_seconds() - t0) * 1e9 / (double)nodes;
+        for (ll_node* n = head; n; n = ll_next(n)) sums[2] += ll_get_data(n);
+        if (is_arena) {
+            head = NULL;
+            arena_reset(ar);
+        } else {
+            ll_free_list_with_allocator(&head, alloc);
+        }
+
+        int ok = 1;
+        for (int k = 0; k < 3; k++) {
+            if (a == 0) reference[k] = sums[k];
+            else if (sums[k] != reference[k]) ok = 0;
+        }
+        printf("%-13s %16.1f %10.1f %13.1f %9.1f %10.1f %8s\n", names[a], sa_ns, build_ns, walk_ns, free_ns,
+               churn_ns, ok ? "ok" : "MISMATCH");
+    }
+
+    tcache_flush();
+    arena_free(ar);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include "allocator.h"
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+int main(void) {
+
+    printf("\n\n============================| ALLOCATOR EXAMPLE |============================\n\n");
+
+    // Arena: containers allocate by bumping a pointer, one reset frees everything
+    arena* a = arena_create(0);
+    const dsa_allocator* arena_alloc = arena_allocator(a);
+
+    static_array* arr = sa_create_array_with_allocator(8, arena_alloc);
+    sa_insert_last(arr, 1);
+    sa_insert_last(arr, 2);
+    printf("Array from the arena: ");
+    sa_display(arr);
+
+    ll_node* head = NULL;
+    for (int i = 1; i <= 5; i++) ll_push_back_with_allocator(&head, i * 10, arena_alloc);
+    printf("List from the arena: ");
+    ll_display(head);
+    printf("Arena bytes in use: %zu\n", arena_used(a));
+
+    // No per-node frees needed: reset releases the array and the list together
+    arena_reset(a);
+    printf("Arena bytes in use after reset: %zu\n", arena_used(a));
+
+    // Thread-local cache: freed nodes are reused by the next allocations of the same thread
+    const dsa_allocator* cache = tcache_allocator();
+    ll_node* cached = NULL;
+    for (int i = 0; i < 4; i++) ll_push_front_with_allocator(&cached, i, cache);
+    ll_pop_front_with_allocator(&cached, cache);
+    ll_push_front_with_allocator(&cached, 99, cache);
+    printf("List from the thread cache: ");
+    ll_display(cached);
+    ll_free_list_with_allocator(&cached, cache);
+    tcache_flush();
+
+    // The default allocator is plain libc (what sa_create_array and ll_push_back use)
+    static_array* plain = sa_create_array_with_allocator(4, dsa_default_allocator());
+    sa_insert_last(plain, 7);
+    printf("Array from libc: ");
+    sa_display(plain);
+    sa_free(plain);
+
+    arena_free(a);
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+static_array benchmark: copy-on-write forks and buffer placement.
+
+    Build: gcc -O2 -pthread benchmark.c static_array.c -o sa_bench
+    Usage: ./sa_bench [max_elements=10000000] [max_access_mb=1024]
+
+Part 1 - forks: sa_clone (copy-on-write) vs copying the whole array for what-if computations.
+         For n = 10K, 100K, ... up to max_elements, FORKS forks of one array are kept alive at the
+         same time. Every fork reads READS random elements; a given share of the forks (0%, 10%, 50%,
+         100%) also modifies WRITES elements. Reports us for the first fork (for sa_clone: the one
+         copying the array into its image), ns per further fork, ms for the whole round
+         (fork + work + free) and the MB the live forks added (anonymous memory of the process plus
+         system shared memory, which holds the images; "-1" if /proc doesn't report it). Every
+         fork's elements must match the original except the ones it modified, which the last
+         column reports.
+Part 2 - random access: for arrays of 64 MB, 256 MB, ... up to max_access_mb, a dependent chain of
+         sa_get_element calls follows one random cycle through the array (every load misses the
+         caches). Compared layouts: sa_create_array, 64-byte aligned, page aligned + prefault, and
+         huge pages + prefault (sa_create_array_ex). Reports creation ms, ns per access and the
+         MB backed by transparent huge pages (from /proc/self/smaps_rollup, "-" if unavailable).
+         Every layout must end the chain on the same element, which the last column reports.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "static_array.h"
+
+#define FORKS   64
+#define READS   1000
+#define WRITES  16
+#define CHASE   (1 << 23)      // Dependent accesses per random-access measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Manual copy with the public API, as done before sa_clone existed
+static static_array* copy_array(static_array* src) {
+    static_array* copy = sa_create_array(sa_capacity(src));
+    const int* d = sa_const_data(src);
+    size_t n = sa_size(src);
+    for (size_t i = 0; i < n; i++) sa_insert_last(copy, d[i]);
+    return copy;
+}
+
+// Resident memory that forks can add, in kB: anonymous pages of this process (copies, and pages a clone
+// wrote) plus shared memory (clone images) - -1 if the kernel doesn't report it
+static long resident_kb(void) {
+    long anon = -1, shmem = -1;
+    char line[256];
+    FILE* f = fopen("/proc/self/smaps_rollup", "r");
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "Anonymous: %ld kB", &anon) == 1) break;
+        }
+        fclose(f);
+    }
+    f = fopen("/proc/meminfo", "r");
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "Shmem: %ld kB", &shmem) == 1) break;
+        }
+        fclose(f);
+    }
+    return anon < 0 || shmem < 0 ? -1 : anon + shmem;
+}
+
+// One round: FORKS forks alive together, write_pct percent of them modified. Returns 1 if all checks pass.
+// first_us is the first fork (for clones: the one that copies the array into its image), fork_ns the
+// average of the others, mb the memory the live forks added (-1 if unknown)
+static int run_round(static_array* arr, int use_clone, int write_pct, double* first_us, double* fork_ns,
+                     double* round_ms, double* mb) {
+    static_array* forks[FORKS];
+    size_t n = sa_size(arr);
+    const int* orig = sa_const_data(arr);
+    long long sink = 0;
+    int ok = 1;
+    uint64_t seed = next_random();
+    rng_state = seed;
+
+    // A write to the original, so this round's first clone takes a new image
+    sa_modify_at(arr, 0, sa_get_element(arr, 0));
+    long kb_before = resident_kb();
+
+    double t0 = now_seconds();
+    forks[0] = use_clone ? sa_clone(arr) : copy_array(arr);
+    double t1 = now_seconds();
+    for (int f = 1; f < FORKS; f++) forks[f] = use_clone ? sa_clone(arr) : copy_array(arr);
+    double t2 = now_seconds();
+
+    for (int f = 0; f < FORKS; f++) {
+        for (int r = 0; r < READS; r++) sink += sa_get_element(forks[f], (size_t)(next_random() % n));
+        if ((int)(next_random() % 100) < write_pct) {
+            for (int w = 0; w < WRITES; w++) sa_modify_at(forks[f], (size_t)(next_random() % n), -1);
+        }
+    }
+
+    long kb_after = resident_kb();
+    *mb = kb_before < 0 || kb_after < 0 ? -1 : (double)(kb_after - kb_before) / 1024;
+
+    for (int f = 0; f < FORKS; f++) sa_free(forks[f]);
+    double t3 = now_seconds();
+
+    // Check outside the timed region: replay the same writes on fresh forks
+    rng_state = seed;
+    for (int f = 0; f < FORKS && ok; f++) {
+        static_array* fork = use_clone ? sa_clone(arr) : copy_array(arr);
+        for (int r = 0; r < READS; r++) next_random();
+        if ((int)(next_random() % 100) < write_pct) {
+            for (int w = 0; w < WRITES; w++) sa_modify_at(fork, (size_t)(next_random() % n), -1);
+        }
+        const int* d = sa_const_data(fork);
+        for (size_t i = 0; i < n; i++) {
+            if (d[i] != orig[i] && d[i] != -1) { ok = 0; break; }
+        }
+        sa_free(fork);
+    }
+    for (size_t i = 0; i < n; i++) if (orig[i] == -1) ok = 0;
+
+    *first_us = (t1 - t0) * 1e6;
+    *fork_ns = (t2 - t1) * 1e9 / (FORKS - 1);
+    *round_ms = (t3 - t0) * 1e3;
+    if (sink == 42) printf(" ");
+    return ok;
+}
+
+
+// Transparent huge page memory of the process in MB, -1 if the kernel doesn't report it
+static long thp_mb(void) {
+    FILE* f = fopen("/proc/self/smaps_rollup", "r");
+    if (!f) return -1;
+    char line[256];
+    long kb = -1;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "AnonHugePages: %ld kB", &kb) == 1) break;
+    }
+    fclose(f);
+    return kb < 0 ? -1 : kb / 1024;
+}
+
+static void random_access(size_t max_mb) {
+    const char* names[4] = { "malloc", "64-byte aligned", "page + prefault", "huge pages + prefault" };
+    sa_options layouts[4] = {
+        { 0, 0, 0, 0, NULL },
+        { 64, 0, 0, 0, NULL },
+        { SA_ALIGN_PAGE, 0, 1, 0, NULL },
+        { SA_ALIGN_PAGE, 1, 1, 0, NULL },
+    };
+
+    printf("\nPart 2 - random access, %d dependent sa_get_element calls along one random cycle\n", CHASE);
+    printf("%8s %-22s %12s %10s %8s %8s\n", "MB", "layout", "create ms", "ns/access", "THP MB", "check");
+    for (size_t mb = 64; mb <= max_mb; mb *= 4) {
+        size_t n = mb * (1 << 20) / sizeof(int);
+
+        // One random cycle (Sattolo), copied into every layout
+        int* cycle = (int*) malloc(sizeof(int) * n);
+        if (!cycle) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        for (size_t i = 0; i < n; i++) cycle[i] = (int)i;
+        for (size_t i = n - 1; i > 0; i--) {
+            size_t j = (size_t)(next_random() % i);
+            int t = cycle[i]; cycle[i] = cycle[j]; cycle[j] = t;
+        }
+
+        int first_end = -1;
+        for (int l = 0; l < 4; l++) {
+            long thp_before = thp_mb();
+            double t0 = now_seconds();
+            static_array* arr = sa_create_array_ex(n, &layouts[l]);
+            double create_ms = (now_seconds() - t0) * 1e3;
+            for (size_t i = 0; i < n; i++) sa_insert_last(arr, 0);
+            memcpy(sa_data(arr), cycle, sizeof(int) * n);
+
+            size_t idx = 0;
+            t0 = now_seconds();
+            for (int s = 0; s < CHASE; s++) idx = (size_t)sa_get_element(arr, idx);
+            double ns = (now_seconds() - t0) * 1e9 / CHASE;
+            if (l == 0) first_end = (int)idx;
+
+            long thp = thp_mb();
+            char thp_text[32] = "-";
+            if (thp >= 0 && thp_before >= 0) snprintf(thp_text, sizeof(thp_text), "%ld", thp - thp_before);
+            printf("%8zu %-22s %12.1f %10.1f %8s %8s\n", mb, names[l], create_ms, ns, thp_text,
+                   (int)idx == first_end ? "ok" : "MISMATCH");
+            sa_free(arr);
+        }
+        free(cycle);
+    }
+}
+
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    size_t max_mb = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1024;
+    const int write_pcts[4] = { 0, 10, 50, 100 };
+
+    printf("Part 1 - forks\n");
+    printf("%d forks alive at once, %d reads each, %d writes in the modified ones\n", FORKS, READS, WRITES);
+    printf("%10s %8s | %12s %12s %10s %10s | %12s %12s %10s %10s | %8s\n", "n", "written",
+           "1st clone us", "clone ns", "clone ms", "clone MB", "1st copy us", "copy ns", "copy ms", "copy MB", "check");
+    for (size_t n = 10000; n <= max_n; n *= 10) {
+        static_array* arr = sa_create_array(n);
+        for (size_t i = 0; i < n; i++) sa_insert_last(arr, (int)(next_random() >> 34));
+
+        for (int p = 0; p < 4; p++) {
+            double c_first, c_ns, c_ms, c_mb, m_first, m_ns, m_ms, m_mb;
+            int ok = run_round(arr, 1, write_pcts[p], &c_first, &c_ns, &c_ms, &c_mb);
+            ok &= run_round(arr, 0, write_pcts[p], &m_first, &m_ns, &m_ms, &m_mb);
+            printf("%10zu %7d%% | %12.1f %12.0f %10.2f %10.1f | %12.1f %12.0f %10.2f %10.1f | %8s\n", n, write_pcts[p],
+                   c_first, c_ns, c_ms, c_mb, m_first, m_ns, m_ms, m_mb, ok ? "ok" : "MISMATCH");
+        }
+        sa_free(arr);
+    }
+
+    random_access(max_mb);
+    return 0;
+}
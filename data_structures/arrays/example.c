@@ -39,7 +39,35 @@ int main() {
 	printf("Array after removing last value: ");
 	sa_display(arr);
 
+	// Copy-on-write clone: shares the pages of the original's image until one side writes
+	static_array* fork = sa_clone(arr);
+	printf("Clone shares its pages: %s\n", sa_is_shared(fork) ? "yes" : "no");
+	sa_modify_at(fork, 0, 99);
+	printf("Clone after setting index 0 to 99: ");
+	sa_display(fork);
+	printf("Original is unchanged: ");
+	sa_display(arr);
+	printf("Clone unmodified since cloning after the write: %s\n", sa_is_shared(fork) ? "yes" : "no");
+
+	// A pointer from sa_data stays writable after cloning; clones taken after a write through it still match
+	int* raw = sa_data(arr);
+	static_array* early = sa_clone(arr);
+	raw[0] = 42;
+	static_array* late = sa_clone(arr);
+	printf("Index 0 of the original / earlier clone / later clone after raw[0] = 42: %d / %d / %d\n",
+	       sa_get_element(arr, 0), sa_get_element(early, 0), sa_get_element(late, 0));
+
+	// Cache-line aligned, pre-faulted buffer (add huge_pages = 1 for multi-MB arrays)
+	sa_options opts = { 64, 0, 1, 0, NULL };
+	static_array* aligned = sa_create_array_ex(1024, &opts);
+	sa_insert_last(aligned, 7);
+	printf("Aligned array buffer is 64-byte aligned: %s\n", ((size_t)sa_const_data(aligned) % 64 == 0) ? "yes" : "no");
+
 	// Free resources
+	sa_free(aligned);
+	sa_free(late);
+	sa_free(early);
+	sa_free(fork);
 	sa_free(arr);
 	return 0;
 }
\ No newline at end of file
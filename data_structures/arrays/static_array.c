@@ -1,51 +1,335 @@
+#define _GNU_SOURCE         // madvise, sysconf, memfd_create
+
 #include "static_array.h"
+#include "../fast_io/fast_io.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/*
+* Copy-on-write: sa_clone copies the array's elements once into an image - an unlinked in-memory file -
+* and every clone maps that image MAP_PRIVATE, so clones share its pages and the kernel copies a page
+* only when a clone first writes to it. The source keeps its own buffer. `image` is set while the
+* array's elements are still those of its image; every function that writes into data calls
+* sa_leave_image first, so the next clone takes a fresh image instead of a stale one. Writes through a
+* pointer handed out earlier (sa_data, a caller-kept buffer) can't be seen, so such an array is marked
+* `data_exposed` and every clone of it takes a fresh image.
+*/
+typedef struct sa_image {
+	int fd;
+	size_t bytes;              // Whole pages
+	_Atomic size_t users;      // Arrays whose elements are still the image's
+} sa_image;
 
 typedef struct static_array {
 	int* data;
 	size_t capacity;
 	size_t size;
 	int owns_buffer;
+	size_t mapped_bytes;     // > 0: data is a private mapping of an image (a clone), unmapped by sa_free
+	sa_image* image;         // Image the elements still match, shared with clones - NULL once written
+	int data_exposed;        // A writable pointer to data is out there: never reuse the image for a clone
+	size_t alignment;        // 0 = natural alignment of the allocator
+	int huge_pages;          // Buffer was advised for transparent huge pages
+	const dsa_allocator* allocator;   // Struct, buffer and image struct all come from here
 } static_array;
 
 
+// Bytes of a buffer for capacity ints (a multiple of the alignment, so madvise covers whole pages)
+static inline size_t sa_buffer_bytes(size_t capacity, size_t alignment) {
+	size_t bytes = sizeof(int) * capacity;
+	return alignment ? (bytes + alignment - 1) / alignment * alignment : bytes;
+}
+
+// Allocate a buffer for capacity ints with the given alignment and huge page hint. Exits on failure
+static int* sa_alloc_buffer(const dsa_allocator* allocator, size_t capacity, size_t alignment, int huge_pages) {
+	size_t bytes = sa_buffer_bytes(capacity, alignment);
+	int* data = (int*) allocator->alloc(allocator->ctx, bytes, alignment);
+	if (!data) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu integers in the array\n", capacity);
+		exit(1);
+	}
+
+#ifdef MADV_HUGEPAGE
+	// Only a hint: without THP support the buffer simply stays on small pages
+	if (huge_pages) madvise(data, bytes, MADV_HUGEPAGE);
+#else
+	(void)huge_pages;
+#endif
+	return data;
+}
+
+typedef struct sa_touch_slice {
+	char* start;
+	size_t bytes;
+} sa_touch_slice;
+
+// Zero one slice, so its pages are first touched (and placed) by the calling thread
+static void* sa_touch(void* arg) {
+	sa_touch_slice* slice = (sa_touch_slice*) arg;
+	memset(slice->start, 0, slice->bytes);
+	return NULL;
+}
+
+// Fault in every page of the buffer, split over nthreads threads (1 = calling thread only)
+static void sa_prefault(int* data, size_t capacity, int nthreads) {
+	size_t bytes = sizeof(int) * capacity;
+	if (nthreads <= 1) {
+		sa_touch_slice whole = { (char*)data, bytes };
+		sa_touch(&whole);
+		return;
+	}
+
+	pthread_t* threads = (pthread_t*) malloc(sizeof(pthread_t) * (size_t)nthreads);
+	sa_touch_slice* slices = (sa_touch_slice*) malloc(sizeof(sa_touch_slice) * (size_t)nthreads);
+	if (!threads || !slices) {
+		printf("Memory allocation failed: couldn't allocate %d first-touch threads\n", nthreads);
+		exit(1);
+	}
+	for (int t = 0; t < nthreads; t++) {
+		size_t lo = bytes / (size_t)nthreads * (size_t)t;
+		size_t hi = t + 1 == nthreads ? bytes : bytes / (size_t)nthreads * (size_t)(t + 1);
+		slices[t].start = (char*)data + lo;
+		slices[t].bytes = hi - lo;
+		// A thread that can't be started leaves its slice to the calling thread
+		if (pthread_create(&threads[t], NULL, sa_touch, &slices[t]) != 0) {
+			sa_touch(&slices[t]);
+			slices[t].bytes = 0;
+		}
+	}
+	for (int t = 0; t < nthreads; t++) {
+		if (slices[t].bytes) pthread_join(threads[t], NULL);
+	}
+	free(threads);
+	free(slices);
+}
+
+
+// Give the array's buffer back to its allocator (if the array owns it), or unmap a clone's image mapping
+static void sa_free_buffer(static_array* arr) {
+	if (arr->mapped_bytes) munmap(arr->data, arr->mapped_bytes);
+	else if (arr->owns_buffer && arr->data)
+		arr->allocator->free(arr->allocator->ctx, arr->data, sa_buffer_bytes(arr->capacity, arr->alignment));
+}
+
+// Bytes of an image for capacity ints (whole pages)
+static size_t sa_image_bytes(size_t capacity) {
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	return (sizeof(int) * capacity + page - 1) / page * page;
+}
+
+// Copy the array's elements into a new image file, used by the array. Exits on failure
+static sa_image* sa_create_image(static_array* arr) {
+	sa_image* image = (sa_image*) arr->allocator->alloc(arr->allocator->ctx, sizeof(sa_image), 0);
+	if (!image) {
+		printf("Memory allocation failed: couldn't allocate the clone image\n");
+		exit(1);
+	}
+	image->bytes = sa_image_bytes(arr->capacity);
+#ifdef MFD_CLOEXEC
+	image->fd = memfd_create("static_array", MFD_CLOEXEC);
+#else
+	// Without memfd: an unlinked temporary file
+	FILE* tmp = tmpfile();
+	image->fd = tmp ? dup(fileno(tmp)) : -1;
+	if (tmp) fclose(tmp);
+#endif
+	if (image->fd < 0 || ftruncate(image->fd, (off_t)image->bytes) != 0) {
+		printf("Memory allocation failed: couldn't create a %zu-byte clone image\n", image->bytes);
+		exit(1);
+	}
+
+	// Elements past size stay zero (a hole in the file)
+	const char* src = (const char*)arr->data;
+	size_t bytes = sizeof(int) * arr->size;
+	for (size_t done = 0; done < bytes; ) {
+		ssize_t n = pwrite(image->fd, src + done, bytes - done, (off_t)done);
+		if (n <= 0) {
+			printf("Memory allocation failed: couldn't fill the clone image\n");
+			exit(1);
+		}
+		done += (size_t)n;
+	}
+	atomic_init(&image->users, 1);
+	return image;
+}
+
+// Drop this array's use of its image; the last user closes and frees it
+static void sa_release_image(static_array* arr) {
+	sa_image* image = arr->image;
+	arr->image = NULL;
+	if (atomic_fetch_sub_explicit(&image->users, 1, memory_order_acq_rel) == 1) {
+		close(image->fd);
+		arr->allocator->free(arr->allocator->ctx, image, sizeof(sa_image));
+	}
+}
+
+// Before a write: the elements will no longer match the image (a clone keeps its mapping; the kernel
+// copies the pages it writes)
+static inline void sa_leave_image(static_array* arr) {
+	if (arr->image) sa_release_image(arr);
+}
+
+
+// Allocate the struct from the allocator. Exits on failure
+static static_array* sa_alloc_struct(const dsa_allocator* allocator) {
+	static_array* arr = (static_array*) allocator->alloc(allocator->ctx, sizeof(static_array), 0);
+	if (!arr) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct static_array!\n");
+		exit(1);
+	}
+	arr->allocator = allocator;
+	return arr;
+}
+
+
 static_array* sa_create_array(size_t capacity) {
+	return sa_create_array_with_allocator(capacity, NULL);
+}
+
+
+static_array* sa_create_array_with_allocator(size_t capacity, const dsa_allocator* allocator) {
     // Validate input parameter: capacity
 	if (capacity == 0) {
 		printf("Requested capacity must be > 0\n");
 		return NULL;
 	}
 
-    // Memory allocation: static_array struct
-	static_array* arr = (static_array*) malloc(sizeof(static_array));
-	
-    // Handling memory allocation failure: arr
-    if (!arr) {
-		printf("Memory allocation failed: couldn't allocate memory for the struct static_array!\n");
-		exit(1);
-	}
+    // Memory allocation: static_array struct and array->data
+	allocator = dsa_allocator_or_default(allocator);
+	static_array* arr = sa_alloc_struct(allocator);
+	arr->data = sa_alloc_buffer(allocator, capacity, 0, 0);
 
-    // Memory allocation: array->data
-	arr->data = (int*) malloc(sizeof(int) * capacity);
+    // Initialize struct members
+	arr->capacity = capacity;
+	arr->size = 0;
+	arr->owns_buffer = 1;
+	arr->mapped_bytes = 0;
+	arr->image = NULL;
+	arr->data_exposed = 0;
+	arr->alignment = 0;
+	arr->huge_pages = 0;
+	return arr;
+}
 
-    // Handling memory allocation failure: arr->data
-	if (!arr->data) {
-		printf("Memory allocation failed: couldn't allocate memory for %zu integers in the array\n", capacity);
-		free(arr);
-		exit(1);
+
+static_array* sa_create_array_ex(size_t capacity, const sa_options* opts) {
+	// Validate input parameter: opts (NULL means the sa_create_array defaults)
+	if (!opts) return sa_create_array(capacity);
+
+	// Validate input parameter: capacity
+	if (capacity == 0) {
+		printf("Requested capacity must be > 0\n");
+		return NULL;
 	}
 
-    // Initialize struct members
+	// Validate input parameter: alignment
+	size_t alignment = opts->alignment;
+	if (alignment == SA_ALIGN_PAGE) alignment = (size_t)sysconf(_SC_PAGESIZE);
+	if (alignment & (alignment - 1)) {
+		printf("sa_create_array_ex: alignment must be a power of two (alignment=%zu)\n", alignment);
+		return NULL;
+	}
+
+	// Huge pages only pay off for buffers spanning several of them; align to the huge page size
+	int huge_pages = opts->huge_pages && sizeof(int) * capacity >= SA_HUGE_PAGE_SIZE;
+	if (huge_pages && alignment < SA_HUGE_PAGE_SIZE) alignment = SA_HUGE_PAGE_SIZE;
+
+	// Memory allocation: static_array struct
+	static_array* arr = sa_alloc_struct(dsa_allocator_or_default(opts->allocator));
+
+	// Memory allocation: array->data, advised before the first touch so faults can map huge pages
+	arr->data = sa_alloc_buffer(arr->allocator, capacity, alignment, huge_pages);
+	if (opts->prefault || opts->first_touch_threads > 1) sa_prefault(arr->data, capacity, opts->first_touch_threads);
+
+	// Initialize struct members
 	arr->capacity = capacity;
 	arr->size = 0;
 	arr->owns_buffer = 1;
+	arr->mapped_bytes = 0;
+	arr->image = NULL;
+	arr->data_exposed = 0;
+	arr->alignment = alignment;
+	arr->huge_pages = huge_pages;
+	return arr;
+}
+
+
+static_array* sa_create_array_from_buffer(int* buffer, size_t capacity, size_t size, const dsa_allocator* owner) {
+	// Validate input parameters: buffer, capacity and size
+	if (!buffer || capacity == 0 || size > capacity) {
+		printf("sa_create_array_from_buffer: need a buffer, capacity > 0 and size <= capacity (capacity=%zu, size=%zu)\n", capacity, size);
+		return NULL;
+	}
+
+	// Memory allocation: static_array struct (from the owner, so the array is released to one allocator)
+	static_array* arr = sa_alloc_struct(dsa_allocator_or_default(owner));
+	arr->data = buffer;
+	arr->capacity = capacity;
+	arr->size = size;
+	arr->owns_buffer = owner != NULL;
+	arr->mapped_bytes = 0;
+	arr->image = NULL;
+	arr->data_exposed = owner == NULL;
+	arr->alignment = 0;
+	arr->huge_pages = 0;
 	return arr;
 }
 
 
+static_array* sa_clone(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("sa_clone: NULL array pointer\n");
+		return NULL;
+	}
+
+	// First clone since the array was created or last written: copy its elements into an image.
+	// An array whose buffer may be written behind its back can't vouch for its image: always a new one
+	if (arr->data_exposed) sa_leave_image(arr);
+	if (!arr->image) arr->image = sa_create_image(arr);
+
+	// Memory allocation: static_array struct (clones use the allocator of their source)
+	static_array* clone = sa_alloc_struct(arr->allocator);
+
+	// Private mapping of the image: pages stay shared until this clone writes to them
+	void* data = mmap(NULL, arr->image->bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, arr->image->fd, 0);
+	if (data == MAP_FAILED) {
+		printf("Memory allocation failed: couldn't map the clone image\n");
+		exit(1);
+	}
+	atomic_fetch_add_explicit(&arr->image->users, 1, memory_order_relaxed);
+
+	// Initialize struct members
+	clone->data = (int*)data;
+	clone->capacity = arr->capacity;
+	clone->size = arr->size;
+	clone->owns_buffer = 1;
+	clone->mapped_bytes = arr->image->bytes;
+	clone->image = arr->image;
+	clone->data_exposed = 0;
+	clone->alignment = 0;
+	clone->huge_pages = 0;
+	return clone;
+}
+
+
+int sa_is_shared(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("sa_is_shared: NULL array pointer\n");
+		return 0;
+	}
+
+	return arr->image && !arr->data_exposed && atomic_load_explicit(&arr->image->users, memory_order_acquire) > 1;
+}
+
+
 int sa_insert_at(static_array* arr, size_t index, int val) {
 
 	// Validate input parameter: arr
@@ -67,6 +351,7 @@ int sa_insert_at(static_array* arr, size_t index, int val) {
 	}
 
 	// Shift elements to make space for new value
+	sa_leave_image(arr);
 	if (index < arr->size) {
 		memmove(&arr->data[index + 1], &arr->data[index], (arr->size - index) * sizeof(int));
 	}
@@ -98,6 +383,7 @@ int sa_insert_last(static_array* arr, int val) {
 	}
 
 	// Insert value at the last position and update size
+	sa_leave_image(arr);
 	arr->data[arr->size++] = val;
 	return 0;
 }
@@ -116,6 +402,7 @@ int sa_modify_at(static_array* arr, size_t index, int val) {
 	}
 
 	// Modify value at the given index
+	sa_leave_image(arr);
 	arr->data[index] = val;
 	return 0;
 }
@@ -135,6 +422,7 @@ int sa_remove_at(static_array* arr, size_t index) {
 
 	// Shift elements to remove value at index
 	if (index + 1 < arr->size) {
+		sa_leave_image(arr);
 		memmove(&arr->data[index], &arr->data[index + 1], (arr->size - index - 1) * sizeof(int));
 	}
 
@@ -249,6 +537,66 @@ int sa_count_elements(static_array* arr, int val) {
 	return count;
 }
 
+size_t sa_size(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("sa_size: NULL array pointer\n");
+		return 0;
+	}
+
+	return arr->size;
+}
+
+size_t sa_capacity(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("sa_capacity: NULL array pointer\n");
+		return 0;
+	}
+
+	return arr->capacity;
+}
+
+int sa_set_size(static_array* arr, size_t size) {
+	// Validate input parameters: arr and size
+	if (!arr) {
+		printf("sa_set_size: NULL array pointer\n");
+		return -1;
+	}
+	if (size > arr->capacity) {
+		printf("sa_set_size: size exceeds capacity (size=%zu, capacity=%zu)\n", size, arr->capacity);
+		return -1;
+	}
+
+	// Elements past the old size were written through sa_data: the array no longer matches its image
+	if (size > arr->size) sa_leave_image(arr);
+	arr->size = size;
+	return 0;
+}
+
+int* sa_data(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("sa_data: NULL array pointer\n");
+		return NULL;
+	}
+
+	// The caller may write through the pointer, now or after a later clone
+	sa_leave_image(arr);
+	arr->data_exposed = 1;
+	return arr->data;
+}
+
+const int* sa_const_data(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("sa_const_data: NULL array pointer\n");
+		return NULL;
+	}
+
+	return arr->data;
+}
+
 void sa_display(static_array* arr) {
 	// Validate input parameter: arr
 	if (!arr) {
@@ -256,12 +604,15 @@ void sa_display(static_array* arr) {
 		return;
 	}
 
-	// Display array elements
-	printf("[");
+	// Display array elements, formatted into the writer's buffer and written in large blocks
+	fio_writer w;
+	fio_writer_init(&w, stdout, NULL, 0);
+	fio_put_char(&w, '[');
 	for (size_t i = 0; i < arr->size; ++i) {
-		printf("%d", arr->data[i]);
-		if (i + 1 < arr->size) printf(", ");
+		fio_put_int(&w, arr->data[i]);
+		if (i + 1 < arr->size) fio_put_bytes(&w, ", ", 2);
 	}
+	fio_writer_flush(&w);
 	printf("] (size=%zu, capacity=%zu)\n", arr->size, arr->capacity);
 }
 
@@ -269,9 +620,10 @@ void sa_free(static_array* arr) {
 	// Validate input parameter: arr
 	if (!arr) return;
 
-	// Free array data if owned
-	if (arr->owns_buffer && arr->data) free(arr->data);
+	// Free array data if owned (or unmap a clone's), and drop the image
+	sa_free_buffer(arr);
+	if (arr->image) sa_release_image(arr);
 
 	// Free struct
-	free(arr);
+	arr->allocator->free(arr->allocator->ctx, arr, sizeof(static_array));
 }
\ No newline at end of file
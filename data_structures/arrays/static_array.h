@@ -3,6 +3,7 @@
 
 
 #include <stddef.h>
+#include "../allocator/allocator.h"
 
 
 /*
@@ -17,8 +18,43 @@ typedef struct static_array static_array;
 // Create a static array of a given capacity
 static_array* sa_create_array(size_t capacity);
 
-// TO BE IMPLEMENTED LATER
-// static_array* sa_create_array_from_buffer(int* buffer, size_t capacity);
+// Create a static array whose struct and buffer come from allocator (NULL -> libc). sa_free returns them to it
+static_array* sa_create_array_with_allocator(size_t capacity, const dsa_allocator* allocator);
+
+// Pass as sa_options.alignment to align the buffer to the system page size
+#define SA_ALIGN_PAGE ((size_t)-1)
+
+// Transparent huge page size assumed for huge_pages (x86-64 / most arm64 kernels)
+#define SA_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+// Buffer placement options for sa_create_array_ex. A zeroed struct gives the sa_create_array behaviour
+typedef struct sa_options {
+	size_t alignment;          // 0 = malloc default, a power of two (64 = cache line) or SA_ALIGN_PAGE
+	int huge_pages;            // Buffers >= SA_HUGE_PAGE_SIZE: align to it and madvise(MADV_HUGEPAGE)
+	int prefault;              // Touch every page at creation, so later accesses don't page-fault
+	int first_touch_threads;   // > 1: prefault with this many threads, each zeroing its own contiguous slice,
+	                           // so on NUMA machines the pages of a slice land on the node of its thread
+	const dsa_allocator* allocator;   // NULL = libc
+} sa_options;
+
+// Create a static array with an aligned / huge-page / pre-faulted buffer (opts NULL -> sa_create_array)
+static_array* sa_create_array_ex(size_t capacity, const sa_options* opts);
+
+// Copy-on-write clone. The first clone of an array (and the first after it was written) copies its elements
+// once into an in-memory image; clones map that image privately, so further clones cost O(1) and a clone's
+// first write to a page copies only that page. The source keeps its own buffer. Clones may be used and freed
+// from different threads. Once a writable pointer to the source's buffer was handed out (sa_data, or a buffer
+// the caller kept in sa_create_array_from_buffer) every clone copies the elements into a new image
+static_array* sa_clone(static_array* arr);
+
+// Returns 1 if the array is unmodified since it shared its image with a clone else 0 (always 0 once a
+// writable pointer to its buffer was handed out)
+int sa_is_shared(static_array* arr);
+
+// Wrap a buffer already holding `size` elements (size <= capacity). With owner == NULL the caller keeps the
+// buffer, which must outlive the array; otherwise the array takes it over and sa_free returns it to owner
+// (it must come from owner->alloc with capacity * sizeof(int) bytes), which also provides the struct
+static_array* sa_create_array_from_buffer(int* buffer, size_t capacity, size_t size, const dsa_allocator* owner);
 
 // =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
 
@@ -63,9 +99,27 @@ int sa_find_val(static_array* arr, int val);
 
 // =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
 
-// Get the current no. of elements
+// Count the occurrences of val in the array
 int sa_count_elements(static_array* arr, int val);  
 
+// Get the current no. of elements
+size_t sa_size(static_array* arr);
+
+// Get the capacity (maximum no. of elements)
+size_t sa_capacity(static_array* arr);
+
+// Set the no. of elements (size <= capacity) without touching the buffer, e.g. after writing the new
+// elements through sa_data - returns 0 on success else -1
+int sa_set_size(static_array* arr, size_t size);
+
+// Direct access to the element buffer (elements 0..sa_size-1 are valid) - NULL on error.
+// Writable, also after the array is cloned, so from now on every clone copies the elements into a new image;
+// use sa_const_data for reading
+int* sa_data(static_array* arr);
+
+// Read-only access to the element buffer, leaves the array's image shared - NULL on error
+const int* sa_const_data(static_array* arr);
+
 // Display the array
 void sa_display(static_array* arr);
 
@@ -0,0 +1,188 @@
+/*
+Bitset vs static_array of ints for dense integer sets: memory and speed.
+
+    Build: gcc -O2 benchmark.c bitset.c ../arrays/static_array.c ../../algorithms/sortingAlgorithms.c -o bitset_bench
+    Usage: ./bitset_bench [max_universe=16777216]
+
+For universes of 64K, 1M, 16M, ... values and densities of 1%, 10% and 50% it builds two random sets
+A and B both as bitsets and as int arrays (A unsorted as an application would fill it, plus sorted
+copies for the merge baseline), then measures
+    memory     : bitset bytes vs 4 bytes per stored int
+    test       : membership test - bs_test vs sa_find_val (linear scan, bounded no. of probes)
+    intersect  : |A & B| - bs_count_and vs a merge over the two sorted int arrays
+    and        : materializing A & B - bs_and vs writing the merged result into a static_array
+    iterate    : visiting every member of A - bs_next_set loop vs reading the array
+Every pair of results is cross-checked and the row is marked "ok" when they agree.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "bitset.h"
+#include "../arrays/static_array.h"
+#include "../../algorithms/sortingAlgorithms.h"
+
+#define TEST_PROBES    1000000
+#define LINEAR_BUDGET  100000000ull   // Element visits allowed for the sa_find_val measurement
+#define REPS           5
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Random subset of [0, universe) with about density * universe members, as a bitset and an unsorted array
+static bitset* random_set(size_t universe, double density, static_array** arr_out) {
+    bitset* bs = bs_create(universe);
+    uint64_t threshold = (uint64_t)(density * 18446744073709551615.0);
+    for (size_t v = 0; v < universe; v++) {
+        if (next_random() < threshold) bs_set(bs, v);
+    }
+    static_array* arr = bs_to_array(bs);
+
+    // Shuffle: the int-array representation is filled in arbitrary order
+    int* d = sa_data(arr);
+    for (size_t i = sa_size(arr); i > 1; i--) {
+        size_t j = next_random() % i;
+        int t = d[i - 1]; d[i - 1] = d[j]; d[j] = t;
+    }
+    *arr_out = arr;
+    return bs;
+}
+
+// Sorted-merge intersection of two sorted arrays; writes into out when non-NULL, returns the count
+static size_t merge_intersect(const int* a, size_t na, const int* b, size_t nb, static_array* out) {
+    size_t i = 0, j = 0, count = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) i++;
+        else if (b[j] < a[i]) j++;
+        else {
+            if (out) sa_insert_last(out, a[i]);
+            count++;
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+static void run(size_t universe, double density) {
+    static_array *arr_a, *arr_b;
+    bitset* a = random_set(universe, density, &arr_a);
+    bitset* b = random_set(universe, density, &arr_b);
+    size_t na = sa_size(arr_a), nb = sa_size(arr_b);
+    int ok = 1;
+
+    // Sorted copies for the merge baseline
+    int* sorted_a = (int*) malloc((na + 1) * sizeof(int));
+    int* sorted_b = (int*) malloc((nb + 1) * sizeof(int));
+    if (!sorted_a || !sorted_b) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < na; i++) sorted_a[i] = sa_data(arr_a)[i];
+    for (size_t i = 0; i < nb; i++) sorted_b[i] = sa_data(arr_b)[i];
+    quick_sort_array(sorted_a, na, ascending);
+    quick_sort_array(sorted_b, nb, ascending);
+
+    // memory
+    double bs_kb = (double)((universe + 63) / 64 * 8) / 1024.0;
+    double sa_kb = (double)(na * sizeof(int)) / 1024.0;
+
+    // test
+    size_t hits_bs = 0, hits_sa = 0;
+    uint64_t saved = rng_state;
+    double t0 = now_seconds();
+    for (size_t i = 0; i < TEST_PROBES; i++) hits_bs += (size_t)bs_test(a, next_random() % universe);
+    double test_bs = (now_seconds() - t0) * 1e9 / TEST_PROBES;
+
+    size_t probes = na > 0 ? (size_t)(LINEAR_BUDGET / na) : TEST_PROBES;
+    if (probes > TEST_PROBES) probes = TEST_PROBES;
+    if (probes == 0) probes = 1;
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < probes; i++) hits_sa += sa_find_val(arr_a, (int)(next_random() % universe)) >= 0;
+    double test_sa = (now_seconds() - t0) * 1e9 / probes;
+    rng_state = saved;
+    size_t check = 0;
+    for (size_t i = 0; i < probes; i++) check += (size_t)bs_test(a, next_random() % universe);
+    if (check != hits_sa) ok = 0;
+    (void)hits_bs;
+
+    // intersect (count only)
+    size_t inter_bs = 0, inter_sa = 0;
+    t0 = now_seconds();
+    for (int r = 0; r < REPS; r++) inter_bs = bs_count_and(a, b);
+    double intersect_bs = (now_seconds() - t0) * 1e6 / REPS;
+    t0 = now_seconds();
+    for (int r = 0; r < REPS; r++) inter_sa = merge_intersect(sorted_a, na, sorted_b, nb, NULL);
+    double intersect_sa = (now_seconds() - t0) * 1e6 / REPS;
+    if (inter_bs != inter_sa) ok = 0;
+
+    // and (materialized)
+    bitset* dst = bs_create(universe);
+    static_array* out = sa_create_array(inter_sa > 0 ? inter_sa : 1);
+    t0 = now_seconds();
+    for (int r = 0; r < REPS; r++) bs_and(dst, a, b);
+    double and_bs = (now_seconds() - t0) * 1e6 / REPS;
+    t0 = now_seconds();
+    for (int r = 0; r < REPS; r++) {
+        while (sa_size(out) > 0) sa_remove_last(out);
+        merge_intersect(sorted_a, na, sorted_b, nb, out);
+    }
+    double and_sa = (now_seconds() - t0) * 1e6 / REPS;
+    if (bs_count(dst) != sa_size(out)) ok = 0;
+
+    // iterate
+    unsigned long long sum_bs = 0, sum_sa = 0;
+    t0 = now_seconds();
+    for (size_t i = bs_next_set(a, 0); i != BS_NONE; i = bs_next_set(a, i + 1)) sum_bs += i;
+    double iter_bs = (now_seconds() - t0) * 1e6;
+    const int* d = sa_data(arr_a);
+    t0 = now_seconds();
+    for (size_t i = 0; i < na; i++) sum_sa += (unsigned long long)d[i];
+    double iter_sa = (now_seconds() - t0) * 1e6;
+    if (sum_bs != sum_sa) ok = 0;
+
+    printf("%10zu %7.0f%% %10.1f %10.1f %8.2f %10.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f  %s\n",
+           universe, density * 100.0, bs_kb, sa_kb, test_bs, test_sa,
+           intersect_bs, intersect_sa, and_bs, and_sa, iter_bs, iter_sa, ok ? "ok" : "MISMATCH");
+
+    bs_free(a);
+    bs_free(b);
+    bs_free(dst);
+    sa_free(arr_a);
+    sa_free(arr_b);
+    sa_free(out);
+    free(sorted_a);
+    free(sorted_b);
+}
+
+int main(int argc, char** argv) {
+    size_t max_universe = argc > 1 ? strtoull(argv[1], NULL, 10) : 16777216;
+    if (max_universe < 65536) max_universe = 65536;
+
+    printf("%10s %8s %10s %10s %8s %10s %9s %9s %9s %9s %9s %9s\n", "universe", "density",
+           "bs KB", "sa KB", "bs test", "sa test", "bs inter", "sa inter", "bs and", "sa and",
+           "bs iter", "sa iter");
+    printf("%10s %8s %10s %10s %8s %10s %9s %9s %9s %9s %9s %9s\n", "", "", "", "", "ns", "ns",
+           "us", "us", "us", "us", "us", "us");
+    const double densities[] = { 0.01, 0.10, 0.50 };
+    for (size_t u = 65536; u <= max_universe; u *= 16) {
+        for (size_t k = 0; k < sizeof(densities) / sizeof(densities[0]); k++) run(u, densities[k]);
+    }
+    return 0;
+}
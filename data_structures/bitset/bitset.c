@@ -0,0 +1,341 @@
+#include "bitset.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define BS_WORD_BITS 64
+#define BS_ALIGN 64                                     // Buffer alignment in bytes (one cache line)
+#define BS_ALIGN_WORDS (BS_ALIGN / sizeof(uint64_t))    // Word count is padded to a multiple of this
+
+/*
+* Invariant: every bit at position >= nbits (the rest of the last word and the padding words)
+* is zero, so bulk operations and counting can run over all words without masking.
+*/
+
+typedef struct bitset {
+	uint64_t* words;     // 64-byte aligned, nwords is a multiple of BS_ALIGN_WORDS
+	size_t nwords;
+	size_t nbits;
+} bitset;
+
+typedef enum { BS_OP_AND, BS_OP_OR, BS_OP_XOR, BS_OP_ANDNOT } bs_op;
+
+
+bitset* bs_create(size_t nbits) {
+	// Validate input parameter: nbits
+	if (nbits == 0) {
+		printf("Requested size must be > 0\n");
+		return NULL;
+	}
+
+	// Memory allocation: bitset struct
+	bitset* bs = (bitset*) malloc(sizeof(bitset));
+	if (!bs) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct bitset!\n");
+		exit(1);
+	}
+
+	// Memory allocation: bs->words, zeroed and padded to whole cache lines
+	size_t nwords = (nbits + BS_WORD_BITS - 1) / BS_WORD_BITS;
+	nwords = (nwords + BS_ALIGN_WORDS - 1) / BS_ALIGN_WORDS * BS_ALIGN_WORDS;
+	bs->words = (uint64_t*) aligned_alloc(BS_ALIGN, nwords * sizeof(uint64_t));
+	if (!bs->words) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu bits\n", nbits);
+		free(bs);
+		exit(1);
+	}
+	memset(bs->words, 0, nwords * sizeof(uint64_t));
+
+	bs->nwords = nwords;
+	bs->nbits = nbits;
+	return bs;
+}
+
+
+bitset* bs_from_array(static_array* arr, size_t nbits) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("bs_from_array: NULL array pointer\n");
+		return NULL;
+	}
+
+	const int* values = sa_const_data(arr);
+	size_t n = sa_size(arr);
+
+	// Check the values fit the universe (and find it when nbits = 0)
+	size_t max_val = 0;
+	for (size_t i = 0; i < n; i++) {
+		if (values[i] < 0) {
+			printf("bs_from_array: negative value %d at index %zu\n", values[i], i);
+			return NULL;
+		}
+		if ((size_t)values[i] > max_val) max_val = (size_t)values[i];
+	}
+	if (nbits == 0) nbits = max_val + 1;
+	else if (n > 0 && max_val >= nbits) {
+		printf("bs_from_array: value %zu out of range (nbits=%zu)\n", max_val, nbits);
+		return NULL;
+	}
+
+	bitset* bs = bs_create(nbits);
+	for (size_t i = 0; i < n; i++) {
+		size_t v = (size_t)values[i];
+		bs->words[v / BS_WORD_BITS] |= (uint64_t)1 << (v % BS_WORD_BITS);
+	}
+	return bs;
+}
+
+
+static_array* bs_to_array(const bitset* bs) {
+	// Validate input parameter: bs
+	if (!bs) {
+		printf("bs_to_array: NULL bitset pointer\n");
+		return NULL;
+	}
+
+	size_t count = bs_count(bs);
+	static_array* arr = sa_create_array(count > 0 ? count : 1);
+
+	// Walk the set bits of every word, lowest first
+	for (size_t w = 0; w < bs->nwords; w++) {
+		uint64_t word = bs->words[w];
+		while (word) {
+			sa_insert_last(arr, (int)(w * BS_WORD_BITS + (size_t)__builtin_ctzll(word)));
+			word &= word - 1;
+		}
+	}
+	return arr;
+}
+
+
+int bs_set(bitset* bs, size_t bit) {
+	// Validate input parameters: bs and bit
+	if (!bs || bit >= bs->nbits) {
+		printf("bs_set: bit %zu out of range or NULL bitset\n", bit);
+		return -1;
+	}
+
+	bs->words[bit / BS_WORD_BITS] |= (uint64_t)1 << (bit % BS_WORD_BITS);
+	return 0;
+}
+
+
+int bs_clear(bitset* bs, size_t bit) {
+	// Validate input parameters: bs and bit
+	if (!bs || bit >= bs->nbits) {
+		printf("bs_clear: bit %zu out of range or NULL bitset\n", bit);
+		return -1;
+	}
+
+	bs->words[bit / BS_WORD_BITS] &= ~((uint64_t)1 << (bit % BS_WORD_BITS));
+	return 0;
+}
+
+
+int bs_test(const bitset* bs, size_t bit) {
+	if (!bs || bit >= bs->nbits) return 0;
+	return (int)((bs->words[bit / BS_WORD_BITS] >> (bit % BS_WORD_BITS)) & 1);
+}
+
+
+void bs_set_all(bitset* bs) {
+	// Validate input parameter: bs
+	if (!bs) return;
+
+	// Full words, then the partial last word, keeping the bits past nbits zero
+	size_t full = bs->nbits / BS_WORD_BITS;
+	memset(bs->words, 0xFF, full * sizeof(uint64_t));
+	if (bs->nbits % BS_WORD_BITS) bs->words[full] = ((uint64_t)1 << (bs->nbits % BS_WORD_BITS)) - 1;
+}
+
+
+void bs_clear_all(bitset* bs) {
+	// Validate input parameter: bs
+	if (!bs) return;
+	memset(bs->words, 0, bs->nwords * sizeof(uint64_t));
+}
+
+
+// Shared body of the bulk operations: one pass over the words, 128 bits per step with SSE2
+static int bs_combine(bitset* dst, const bitset* a, const bitset* b, bs_op op, const char* caller) {
+	// Validate input parameters: dst, a and b
+	if (!dst || !a || !b) {
+		printf("%s: NULL bitset pointer\n", caller);
+		return -1;
+	}
+	if (dst->nbits != a->nbits || a->nbits != b->nbits) {
+		printf("%s: size mismatch (%zu, %zu, %zu)\n", caller, dst->nbits, a->nbits, b->nbits);
+		return -1;
+	}
+
+	uint64_t* d = dst->words;
+	const uint64_t* x = a->words;
+	const uint64_t* y = b->words;
+	size_t n = dst->nwords;
+
+#ifdef __SSE2__
+	// nwords is a multiple of 8, so there is no scalar tail
+	for (size_t i = 0; i < n; i += 2) {
+		__m128i vx = _mm_load_si128((const __m128i*)(x + i));
+		__m128i vy = _mm_load_si128((const __m128i*)(y + i));
+		__m128i r;
+		switch (op) {
+			case BS_OP_AND:    r = _mm_and_si128(vx, vy); break;
+			case BS_OP_OR:     r = _mm_or_si128(vx, vy); break;
+			case BS_OP_XOR:    r = _mm_xor_si128(vx, vy); break;
+			default:           r = _mm_andnot_si128(vy, vx); break;
+		}
+		_mm_store_si128((__m128i*)(d + i), r);
+	}
+#else
+	switch (op) {
+		case BS_OP_AND:    for (size_t i = 0; i < n; i++) d[i] = x[i] & y[i]; break;
+		case BS_OP_OR:     for (size_t i = 0; i < n; i++) d[i] = x[i] | y[i]; break;
+		case BS_OP_XOR:    for (size_t i = 0; i < n; i++) d[i] = x[i] ^ y[i]; break;
+		default:           for (size_t i = 0; i < n; i++) d[i] = x[i] & ~y[i]; break;
+	}
+#endif
+	return 0;
+}
+
+int bs_and(bitset* dst, const bitset* a, const bitset* b) {
+	return bs_combine(dst, a, b, BS_OP_AND, "bs_and");
+}
+
+int bs_or(bitset* dst, const bitset* a, const bitset* b) {
+	return bs_combine(dst, a, b, BS_OP_OR, "bs_or");
+}
+
+int bs_xor(bitset* dst, const bitset* a, const bitset* b) {
+	return bs_combine(dst, a, b, BS_OP_XOR, "bs_xor");
+}
+
+int bs_andnot(bitset* dst, const bitset* a, const bitset* b) {
+	return bs_combine(dst, a, b, BS_OP_ANDNOT, "bs_andnot");
+}
+
+
+/*
+* Popcount of a word range. With a hardware popcount instruction (-mpopcnt / -march=native)
+* the builtin is used per word; with plain SSE2 the bits are counted per byte with the
+* shift-and-mask (SWAR) method on 128 bits at a time and the byte counts summed with psadbw.
+*/
+#if !defined(__POPCNT__) && defined(__SSE2__)
+static inline __m128i bs_popcount_bytes(__m128i v) {
+	const __m128i m1 = _mm_set1_epi8(0x55);
+	const __m128i m2 = _mm_set1_epi8(0x33);
+	const __m128i m4 = _mm_set1_epi8(0x0F);
+	v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+	v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+	v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+	return _mm_sad_epu8(v, _mm_setzero_si128());   // Two 64-bit lane sums
+}
+
+static inline size_t bs_lane_sum(__m128i acc) {
+	return (size_t)(_mm_cvtsi128_si64(acc) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(acc, acc)));
+}
+#endif
+
+static inline size_t bs_popcount_word(uint64_t x) {
+#if defined(__POPCNT__)
+	return (size_t)__builtin_popcountll(x);
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ull);
+	x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+	return (size_t)((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+
+size_t bs_count(const bitset* bs) {
+	if (!bs) return 0;
+
+	size_t total = 0;
+#if !defined(__POPCNT__) && defined(__SSE2__)
+	__m128i acc = _mm_setzero_si128();
+	for (size_t i = 0; i < bs->nwords; i += 2) {
+		acc = _mm_add_epi64(acc, bs_popcount_bytes(_mm_load_si128((const __m128i*)(bs->words + i))));
+	}
+	total = bs_lane_sum(acc);
+#else
+	for (size_t i = 0; i < bs->nwords; i++) total += bs_popcount_word(bs->words[i]);
+#endif
+	return total;
+}
+
+
+size_t bs_count_and(const bitset* a, const bitset* b) {
+	// Validate input parameters: a and b
+	if (!a || !b || a->nbits != b->nbits) {
+		printf("bs_count_and: NULL bitset pointer or size mismatch\n");
+		return 0;
+	}
+
+	size_t total = 0;
+#if !defined(__POPCNT__) && defined(__SSE2__)
+	__m128i acc = _mm_setzero_si128();
+	for (size_t i = 0; i < a->nwords; i += 2) {
+		__m128i v = _mm_and_si128(_mm_load_si128((const __m128i*)(a->words + i)),
+		                          _mm_load_si128((const __m128i*)(b->words + i)));
+		acc = _mm_add_epi64(acc, bs_popcount_bytes(v));
+	}
+	total = bs_lane_sum(acc);
+#else
+	for (size_t i = 0; i < a->nwords; i++) total += bs_popcount_word(a->words[i] & b->words[i]);
+#endif
+	return total;
+}
+
+
+size_t bs_next_set(const bitset* bs, size_t from) {
+	if (!bs || from >= bs->nbits) return BS_NONE;
+
+	// First word: drop the bits below `from`
+	size_t w = from / BS_WORD_BITS;
+	uint64_t word = bs->words[w] & (~(uint64_t)0 << (from % BS_WORD_BITS));
+
+	// Skip empty words; the padding is zero so reaching nwords means no member
+	while (!word) {
+		if (++w == bs->nwords) return BS_NONE;
+		word = bs->words[w];
+	}
+	return w * BS_WORD_BITS + (size_t)__builtin_ctzll(word);
+}
+
+
+size_t bs_size(const bitset* bs) {
+	return bs ? bs->nbits : 0;
+}
+
+
+void bs_display(const bitset* bs) {
+	// Validate input parameter: bs
+	if (!bs) {
+		printf("bs_display: NULL bitset pointer\n");
+		return;
+	}
+
+	// Display members in increasing order
+	printf("{");
+	for (size_t i = bs_next_set(bs, 0); i != BS_NONE; ) {
+		printf("%zu", i);
+		i = bs_next_set(bs, i + 1);
+		if (i != BS_NONE) printf(", ");
+	}
+	printf("} (count=%zu, nbits=%zu)\n", bs_count(bs), bs->nbits);
+}
+
+
+void bs_free(bitset* bs) {
+	// Validate input parameter: bs
+	if (!bs) return;
+	free(bs->words);
+	free(bs);
+}
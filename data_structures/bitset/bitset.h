@@ -0,0 +1,88 @@
+#ifndef DSA_BITSET_H
+#define DSA_BITSET_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Fixed-size bitset over the universe [0, nbits): one bit per possible value instead of one
+* int per stored value. Bits are kept in 64-bit words in a 64-byte aligned buffer, bulk operations
+* work on whole words (two at a time with SSE2) and counting uses popcount, so cardinality and
+* set algebra cost nbits/64 word operations regardless of how many members there are.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct bitset bitset;
+
+// Returned by bs_next_set when there is no further member
+#define BS_NONE ((size_t)-1)
+
+// Create an empty bitset for values in [0, nbits)
+bitset* bs_create(size_t nbits);
+
+// Create a bitset holding every value of arr. nbits = 0 sizes it to max value + 1. Fails on negative or out-of-range values
+bitset* bs_from_array(static_array* arr, size_t nbits);
+
+// Create a static_array with the members in increasing order (capacity = max(count, 1))
+static_array* bs_to_array(const bitset* bs);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Add bit to the set. Returns 0 on success else -1 (out of range)
+int bs_set(bitset* bs, size_t bit);
+
+// Remove bit from the set. Returns 0 on success else -1 (out of range)
+int bs_clear(bitset* bs, size_t bit);
+
+// Returns 1 if bit is in the set else 0 (also 0 when out of range)
+int bs_test(const bitset* bs, size_t bit);
+
+// Add every value in [0, nbits)
+void bs_set_all(bitset* bs);
+
+// Remove every value
+void bs_clear_all(bitset* bs);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Bulk operations: all operands must have the same nbits, dst may be the same bitset as a or b.
+// Each returns 0 on success else -1
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// dst = a & b (intersection)
+int bs_and(bitset* dst, const bitset* a, const bitset* b);
+
+// dst = a | b (union)
+int bs_or(bitset* dst, const bitset* a, const bitset* b);
+
+// dst = a ^ b (symmetric difference)
+int bs_xor(bitset* dst, const bitset* a, const bitset* b);
+
+// dst = a & ~b (difference a - b)
+int bs_andnot(bitset* dst, const bitset* a, const bitset* b);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of members (popcount over all words)
+size_t bs_count(const bitset* bs);
+
+// Get the no. of common members of a and b without building the intersection
+size_t bs_count_and(const bitset* a, const bitset* b);
+
+// Get the smallest member >= from, or BS_NONE. Iterate with: for (i = bs_next_set(bs, 0); i != BS_NONE; i = bs_next_set(bs, i + 1))
+size_t bs_next_set(const bitset* bs, size_t from);
+
+// Get the universe size nbits
+size_t bs_size(const bitset* bs);
+
+// Print the members like sa_display
+void bs_display(const bitset* bs);
+
+// Delete the bitset
+void bs_free(bitset* bs);
+
+
+#endif /* DSA_BITSET_H */
@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include "bitset.h"
+#include "../arrays/static_array.h"
+
+int main(void) {
+
+    printf("\n\n============================| BITSET EXAMPLE |============================\n\n");
+
+    // Build one set bit by bit and one from an existing static_array of flags
+    bitset* evens = bs_create(20);
+    for (size_t i = 0; i < 20; i += 2) bs_set(evens, i);
+    printf("Evens: ");
+    bs_display(evens);
+
+    static_array* arr = sa_create_array(8);
+    sa_insert_last(arr, 3);
+    sa_insert_last(arr, 4);
+    sa_insert_last(arr, 9);
+    sa_insert_last(arr, 12);
+    sa_insert_last(arr, 15);
+    bitset* picked = bs_from_array(arr, 20);
+    printf("From array: ");
+    bs_display(picked);
+    printf("Contains 9: %d, contains 10: %d\n", bs_test(picked, 9), bs_test(picked, 10));
+
+    // Set algebra into a third bitset
+    bitset* result = bs_create(20);
+    bs_and(result, evens, picked);
+    printf("Evens AND picked: ");
+    bs_display(result);
+    bs_or(result, evens, picked);
+    printf("Evens OR picked: ");
+    bs_display(result);
+    bs_andnot(result, picked, evens);
+    printf("Picked ANDNOT evens: ");
+    bs_display(result);
+    printf("Common members counted without materializing: %zu\n", bs_count_and(evens, picked));
+
+    // Iterate members and convert back to an array
+    printf("Members of picked >= 5: ");
+    for (size_t i = bs_next_set(picked, 5); i != BS_NONE; i = bs_next_set(picked, i + 1)) printf("%zu ", i);
+    printf("\n");
+    bs_clear(picked, 4);
+    static_array* back = bs_to_array(picked);
+    printf("Back to array after clearing 4: ");
+    sa_display(back);
+
+    sa_free(arr);
+    sa_free(back);
+    bs_free(evens);
+    bs_free(picked);
+    bs_free(result);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+Miss-heavy lookup benchmark: sa_find_val / ll_search with and without a Bloom filter in front.
+
+    Build: gcc -O2 benchmark.c bloom_filter.c ../arrays/static_array.c ../linked_list/linked_list.c -lm -o bloom_bench
+    Usage: ./bloom_bench [max_elements=1000000]
+
+Part 1 - accuracy: for target rates 10%, 1% and 0.1% it fills a filter with 1M keys and reports
+         the measured false-positive rate on 10M absent keys, the filter size and ns per query.
+Part 2 - miss-heavy workload: for n = 1K, 10K, ... up to max_elements random values in a static_array
+         and in a linked list, lookups where 1% (and 10%) of the probes are present, timed with the
+         plain call and with the bf_* guarded call (1% target rate). Prints ns per lookup.
+The unfiltered linear searches get a bounded budget of element visits per size; every guarded
+call must return the same position as the plain one, which the last column reports.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "bloom_filter.h"
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+#define ACCURACY_KEYS   1000000
+#define ACCURACY_PROBES 10000000
+#define LOOKUPS         1000000
+#define SCAN_BUDGET     300000000ull   // Element visits allowed for one unfiltered measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static void accuracy(double fpr) {
+    // Even keys are added, odd keys are guaranteed absent
+    bloom_filter* bf = bf_create(ACCURACY_KEYS, fpr);
+    for (int i = 0; i < ACCURACY_KEYS; i++) bf_add(bf, 2 * (int)(next_random() % 500000000));
+    size_t positives = 0;
+    double t0 = now_seconds();
+    for (size_t i = 0; i < ACCURACY_PROBES; i++) positives += (size_t)bf_may_contain(bf, 2 * (int)(next_random() % 500000000) + 1);
+    double ns = (now_seconds() - t0) * 1e9 / ACCURACY_PROBES;
+    printf("target %6.2f%%  measured %6.3f%%  %8.2f bits/key  k=%2d  %6.1f ns/query\n", fpr * 100,
+           100.0 * (double)positives / ACCURACY_PROBES, 8.0 * (double)bf_bytes(bf) / ACCURACY_KEYS,
+           bf_hashes(bf), ns);
+    bf_free(bf);
+}
+
+// Probe value: present (an element of vals) with probability hit_pct %, else a guaranteed absent odd value
+static int probe(const int* vals, size_t n, int hit_pct) {
+    if ((int)(next_random() % 100) < hit_pct) return vals[next_random() % n];
+    return 2 * (int)(next_random() % 500000000) + 1;
+}
+
+static void workload(size_t n, int hit_pct) {
+    static_array* arr = sa_create_array(n);
+    ll_node* head = NULL;
+    for (size_t i = 0; i < n; i++) {
+        int v = 2 * (int)(next_random() % 500000000);
+        sa_insert_last(arr, v);
+        ll_push_front(&head, v);
+    }
+    const int* vals = sa_data(arr);
+    bloom_filter* bf_arr = bf_create_for_array(arr, 0.01);
+    bloom_filter* bf_list = bf_create_for_list(head, 0.01);
+
+    size_t plain_lookups = (size_t)(SCAN_BUDGET / n);
+    if (plain_lookups > LOOKUPS) plain_lookups = LOOKUPS;
+    if (plain_lookups == 0) plain_lookups = 1;
+    int ok = 1;
+
+    // static_array: plain, then the same probe sequence guarded
+    uint64_t saved = rng_state;
+    long long check_plain = 0, check_guarded = 0;
+    double t0 = now_seconds();
+    for (size_t i = 0; i < plain_lookups; i++) check_plain += sa_find_val(arr, probe(vals, n, hit_pct));
+    double sa_plain = (now_seconds() - t0) * 1e9 / plain_lookups;
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < LOOKUPS; i++) {
+        int r = bf_sa_find_val(bf_arr, arr, probe(vals, n, hit_pct));
+        if (i < plain_lookups) check_guarded += r;
+    }
+    double sa_guarded = (now_seconds() - t0) * 1e9 / LOOKUPS;
+    if (check_plain != check_guarded) ok = 0;
+
+    // linked list: same scheme
+    saved = rng_state;
+    check_plain = check_guarded = 0;
+    t0 = now_seconds();
+    for (size_t i = 0; i < plain_lookups; i++) check_plain += ll_search(head, probe(vals, n, hit_pct));
+    double ll_plain = (now_seconds() - t0) * 1e9 / plain_lookups;
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < LOOKUPS; i++) {
+        int r = bf_ll_search(bf_list, head, probe(vals, n, hit_pct));
+        if (i < plain_lookups) check_guarded += r;
+    }
+    double ll_guarded = (now_seconds() - t0) * 1e9 / LOOKUPS;
+    if (check_plain != check_guarded) ok = 0;
+
+    printf("%10zu %5d%% | %12.1f %12.1f %8.1fx | %12.1f %12.1f %8.1fx | %s\n", n, hit_pct,
+           sa_plain, sa_guarded, sa_plain / sa_guarded, ll_plain, ll_guarded, ll_plain / ll_guarded,
+           ok ? "ok" : "MISMATCH");
+
+    bf_free(bf_arr);
+    bf_free(bf_list);
+    while (head) ll_pop_front(&head);
+    sa_free(arr);
+}
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+
+    printf("Accuracy (1M keys, 10M absent probes):\n");
+    accuracy(0.10);
+    accuracy(0.01);
+    accuracy(0.001);
+
+    printf("\nMiss-heavy lookups, ns per lookup:\n");
+    printf("%10s %6s | %12s %12s %9s | %12s %12s %9s |\n", "elements", "hits",
+           "sa_find_val", "guarded", "speedup", "ll_search", "guarded", "speedup");
+    for (size_t n = 1000; n <= max_elements; n *= 10) {
+        workload(n, 1);
+        workload(n, 10);
+    }
+    return 0;
+}
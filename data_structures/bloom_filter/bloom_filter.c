@@ -0,0 +1,265 @@
+#include "bloom_filter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#define BF_BLOCK_BYTES 64                           // One cache line per block
+#define BF_BLOCK_WORDS (BF_BLOCK_BYTES / 8)
+#define BF_BLOCK_BITS (BF_BLOCK_BYTES * 8)
+#define BF_MAX_HASHES 16
+#define BF_DEFAULT_FPR 0.01
+
+typedef struct bloom_filter {
+	uint64_t* blocks;   // nblocks * BF_BLOCK_WORDS words, 64-byte aligned
+	size_t nblocks;
+	int k;              // Bits set per key
+	size_t count;       // Keys added
+} bloom_filter;
+
+
+// splitmix64 finalizer, as in hash_map.c
+static inline uint64_t bf_hash(uint64_t x) {
+	x += 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+/*
+* The high 32 hash bits pick the block (multiply-shift instead of a modulo). The k in-block
+* positions take 9 bits each, first from the low 32 bits of the hash, then from re-hashing
+* it (7 positions per 64-bit hash), so they are independent like in a classic filter.
+*/
+static inline const uint64_t* bf_block(const bloom_filter* bf, uint64_t h) {
+	size_t block = (size_t)(((h >> 32) * (uint64_t)bf->nblocks) >> 32);
+	return bf->blocks + block * BF_BLOCK_WORDS;
+}
+
+/*
+* Expected false-positive rate of the blocked layout. Keys per block follow a Poisson distribution
+* with mean lambda; a block holding i keys answers a foreign query positively with the classic
+* rate for a 512-bit filter with i keys: (1 - (1 - 1/512)^(k * i))^k.
+*/
+static double bf_blocked_fpr(double lambda, int k) {
+	double p_i = exp(-lambda);   // Poisson probability of i keys, starting at i = 0
+	double total = 0;
+	int last = (int)(lambda + 10 * sqrt(lambda) + 20);
+	for (int i = 0; i <= last; i++) {
+		double empty = pow(1.0 - 1.0 / BF_BLOCK_BITS, (double)k * i);
+		total += p_i * pow(1.0 - empty, k);
+		p_i *= lambda / (i + 1);
+	}
+	return total;
+}
+
+// Build the k-bit mask of key inside its block
+static inline void bf_mask(const bloom_filter* bf, uint64_t h, uint64_t mask[BF_BLOCK_WORDS]) {
+	uint64_t bits = (uint32_t)h;
+	int avail = 32 / 9;
+	for (int w = 0; w < BF_BLOCK_WORDS; w++) mask[w] = 0;
+	for (int i = 0; i < bf->k; i++) {
+		if (avail == 0) {
+			h = bf_hash(h);
+			bits = h;
+			avail = 64 / 9;
+		}
+		uint32_t pos = (uint32_t)bits & (BF_BLOCK_BITS - 1);
+		bits >>= 9;
+		avail--;
+		mask[pos >> 6] |= (uint64_t)1 << (pos & 63);
+	}
+}
+
+
+bloom_filter* bf_create(size_t expected, double fpr) {
+	// Validate input parameters: expected and fpr
+	if (fpr == 0) fpr = BF_DEFAULT_FPR;
+	if (fpr <= 0 || fpr >= 1) {
+		printf("bf_create: false-positive rate must be in (0, 1), got %g\n", fpr);
+		return NULL;
+	}
+	if (expected == 0) expected = 1;
+
+	// Memory allocation: bloom_filter struct
+	bloom_filter* bf = (bloom_filter*) malloc(sizeof(bloom_filter));
+	if (!bf) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct bloom_filter!\n");
+		exit(1);
+	}
+
+	// Classic sizing: -ln(p) / ln(2)^2 bits per key and ln(2) * bits_per_key hashes
+	double ln2 = 0.69314718055994530942;
+	double bits_per_key = -log(fpr) / (ln2 * ln2);
+	bf->k = (int)lround(bits_per_key * ln2);
+	if (bf->k < 1) bf->k = 1;
+	if (bf->k > BF_MAX_HASHES) bf->k = BF_MAX_HASHES;
+	bf->count = 0;
+
+	// Confining each key to one block loads the blocks unevenly, which raises the rate:
+	// grow the classic size by 5% steps until the blocked layout meets the target
+	double blocks = ceil(bits_per_key * (double)expected / BF_BLOCK_BITS);
+	while (bf_blocked_fpr((double)expected / blocks, bf->k) > fpr) blocks = ceil(blocks * 1.05);
+	bf->nblocks = (size_t)blocks;
+
+	// Memory allocation: bf->blocks, zeroed, one block per cache line
+	bf->blocks = (uint64_t*) aligned_alloc(BF_BLOCK_BYTES, bf->nblocks * BF_BLOCK_BYTES);
+	if (!bf->blocks) {
+		printf("Memory allocation failed: couldn't allocate %zu filter blocks\n", bf->nblocks);
+		free(bf);
+		exit(1);
+	}
+	memset(bf->blocks, 0, bf->nblocks * BF_BLOCK_BYTES);
+	return bf;
+}
+
+
+bloom_filter* bf_create_for_array(static_array* arr, double fpr) {
+	// Validate input parameter: arr
+	if (!arr) {
+		printf("bf_create_for_array: NULL array pointer\n");
+		return NULL;
+	}
+
+	bloom_filter* bf = bf_create(sa_capacity(arr), fpr);
+	if (bf) bf_rebuild_array(bf, arr);
+	return bf;
+}
+
+
+bloom_filter* bf_create_for_list(ll_node* head, double fpr) {
+	bloom_filter* bf = bf_create(2 * (size_t)ll_count_nodes(head), fpr);
+	if (bf) bf_rebuild_list(bf, head);
+	return bf;
+}
+
+
+void bf_add(bloom_filter* bf, int key) {
+	// Validate input parameter: bf
+	if (!bf) return;
+
+	uint64_t h = bf_hash((uint32_t)key);
+	uint64_t* block = (uint64_t*) bf_block(bf, h);
+	uint64_t mask[BF_BLOCK_WORDS];
+	bf_mask(bf, h, mask);
+	for (int w = 0; w < BF_BLOCK_WORDS; w++) block[w] |= mask[w];
+	bf->count++;
+}
+
+
+int bf_may_contain(const bloom_filter* bf, int key) {
+	if (!bf) return 1;
+
+	uint64_t h = bf_hash((uint32_t)key);
+	const uint64_t* block = bf_block(bf, h);
+	uint64_t mask[BF_BLOCK_WORDS];
+	bf_mask(bf, h, mask);
+
+	// All k bits set <=> no word misses a bit of the mask (branch-free over the whole line)
+	uint64_t missing = 0;
+	for (int w = 0; w < BF_BLOCK_WORDS; w++) missing |= mask[w] & ~block[w];
+	return missing == 0;
+}
+
+
+void bf_clear(bloom_filter* bf) {
+	// Validate input parameter: bf
+	if (!bf) return;
+	memset(bf->blocks, 0, bf->nblocks * BF_BLOCK_BYTES);
+	bf->count = 0;
+}
+
+
+void bf_rebuild_array(bloom_filter* bf, static_array* arr) {
+	// Validate input parameters: bf and arr
+	if (!bf || !arr) {
+		printf("bf_rebuild_array: NULL filter or array pointer\n");
+		return;
+	}
+
+	bf_clear(bf);
+	const int* data = sa_const_data(arr);
+	for (size_t i = 0; i < sa_size(arr); i++) bf_add(bf, data[i]);
+}
+
+
+void bf_rebuild_list(bloom_filter* bf, ll_node* head) {
+	// Validate input parameter: bf
+	if (!bf) {
+		printf("bf_rebuild_list: NULL filter pointer\n");
+		return;
+	}
+
+	bf_clear(bf);
+	for (ll_node* node = head; node != NULL; node = ll_next(node)) bf_add(bf, ll_get_data(node));
+}
+
+
+int bf_sa_find_val(const bloom_filter* bf, static_array* arr, int val) {
+	if (bf && !bf_may_contain(bf, val)) return -1;
+	return sa_find_val(arr, val);
+}
+
+
+int bf_ll_search(const bloom_filter* bf, ll_node* head, int key) {
+	if (bf && !bf_may_contain(bf, key)) return -1;
+	return ll_search(head, key);
+}
+
+
+int bf_sa_insert_last(bloom_filter* bf, static_array* arr, int val) {
+	int rc = sa_insert_last(arr, val);
+	if (rc == 0) bf_add(bf, val);
+	return rc;
+}
+
+
+int bf_sa_insert_at(bloom_filter* bf, static_array* arr, size_t index, int val) {
+	int rc = sa_insert_at(arr, index, val);
+	if (rc == 0) bf_add(bf, val);
+	return rc;
+}
+
+
+int bf_sa_modify_at(bloom_filter* bf, static_array* arr, size_t index, int val) {
+	int rc = sa_modify_at(arr, index, val);
+	if (rc == 0) bf_add(bf, val);
+	return rc;
+}
+
+
+void bf_ll_push_front(bloom_filter* bf, ll_node** headRef, int data) {
+	ll_push_front(headRef, data);
+	bf_add(bf, data);
+}
+
+
+void bf_ll_push_back(bloom_filter* bf, ll_node** headRef, int data) {
+	ll_push_back(headRef, data);
+	bf_add(bf, data);
+}
+
+
+size_t bf_count(const bloom_filter* bf) {
+	return bf ? bf->count : 0;
+}
+
+
+size_t bf_bytes(const bloom_filter* bf) {
+	return bf ? bf->nblocks * BF_BLOCK_BYTES : 0;
+}
+
+
+int bf_hashes(const bloom_filter* bf) {
+	return bf ? bf->k : 0;
+}
+
+
+void bf_free(bloom_filter* bf) {
+	// Validate input parameter: bf
+	if (!bf) return;
+	free(bf->blocks);
+	free(bf);
+}
@@ -0,0 +1,93 @@
+#ifndef DSA_BLOOM_FILTER_H
+#define DSA_BLOOM_FILTER_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+
+/*
+* Blocked Bloom filter for int keys: a fast "definitely absent" answer in front of
+* sa_find_val / ll_search, whose misses otherwise scan the whole container.
+* Every key maps to one 64-byte block (one cache line) and sets k bits inside it, so a query
+* costs one hash and one cache miss at most. False positives happen at about the configured
+* rate; false negatives never happen for keys that were added.
+*
+* The filter only learns keys through bf_add and the bf_sa_* / bf_ll_* insert wrappers.
+* Removing elements from the container leaves their bits set: lookups stay correct but the
+* false-positive rate creeps up, so call bf_rebuild_* after many removals.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct bloom_filter bloom_filter;
+
+// Create a filter sized for `expected` keys with false-positive rate fpr in (0, 1) (0 -> 1%)
+bloom_filter* bf_create(size_t expected, double fpr);
+
+// Create a filter filled with the elements of arr, sized for its capacity so later inserts keep the rate
+bloom_filter* bf_create_for_array(static_array* arr, double fpr);
+
+// Create a filter filled with the values of the list, sized for twice its current length
+bloom_filter* bf_create_for_list(ll_node* head, double fpr);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Add key to the filter
+void bf_add(bloom_filter* bf, int key);
+
+// Returns 0 if key was definitely never added, 1 if it may have been
+int bf_may_contain(const bloom_filter* bf, int key);
+
+// Forget every key
+void bf_clear(bloom_filter* bf);
+
+// Clear and re-add every element of arr (after removals)
+void bf_rebuild_array(bloom_filter* bf, static_array* arr);
+
+// Clear and re-add every value of the list (after removals)
+void bf_rebuild_list(bloom_filter* bf, ll_node* head);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Guarded container operations: same results as the wrapped call, the filter answers most misses
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// sa_find_val, skipped (-1) when the filter rules val out
+int bf_sa_find_val(const bloom_filter* bf, static_array* arr, int val);
+
+// ll_search, skipped (-1) when the filter rules key out
+int bf_ll_search(const bloom_filter* bf, ll_node* head, int key);
+
+// sa_insert_last and add val to the filter on success
+int bf_sa_insert_last(bloom_filter* bf, static_array* arr, int val);
+
+// sa_insert_at and add val to the filter on success
+int bf_sa_insert_at(bloom_filter* bf, static_array* arr, size_t index, int val);
+
+// sa_modify_at and add val to the filter on success (the old value stays a possible false positive)
+int bf_sa_modify_at(bloom_filter* bf, static_array* arr, size_t index, int val);
+
+// ll_push_front and add data to the filter
+void bf_ll_push_front(bloom_filter* bf, ll_node** headRef, int data);
+
+// ll_push_back and add data to the filter
+void bf_ll_push_back(bloom_filter* bf, ll_node** headRef, int data);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of bf_add calls since creation or the last clear/rebuild
+size_t bf_count(const bloom_filter* bf);
+
+// Get the filter size in bytes
+size_t bf_bytes(const bloom_filter* bf);
+
+// Get the no. of bits set per key
+int bf_hashes(const bloom_filter* bf);
+
+// Delete the filter
+void bf_free(bloom_filter* bf);
+
+
+#endif /* DSA_BLOOM_FILTER_H */
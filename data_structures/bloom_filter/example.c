@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include "bloom_filter.h"
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+int main(void) {
+
+    printf("\n\n============================| BLOOM FILTER EXAMPLE |============================\n\n");
+
+    // Filter attached to a static_array: inserts go through the wrapper so the filter stays current
+    static_array* arr = sa_create_array(100);
+    bloom_filter* bf = bf_create_for_array(arr, 0.01);
+    for (int v = 0; v < 50; v++) bf_sa_insert_last(bf, arr, v * 7);
+    printf("Filter: %zu bytes, %d hash bits set per key, %zu keys added\n", bf_bytes(bf), bf_hashes(bf), bf_count(bf));
+    printf("Find 35: index %d (filter says %s)\n", bf_sa_find_val(bf, arr, 35),
+           bf_may_contain(bf, 35) ? "maybe" : "absent");
+    printf("Find 36: index %d (filter says %s)\n", bf_sa_find_val(bf, arr, 36),
+           bf_may_contain(bf, 36) ? "maybe" : "absent");
+
+    // Count how many of 10000 absent values still need a scan
+    int scans = 0;
+    for (int v = 1000; v < 11000; v++) scans += bf_may_contain(bf, v);
+    printf("Absent values that still reach sa_find_val: %d of 10000\n", scans);
+
+    // Removing elements leaves stale bits until the filter is rebuilt
+    while (sa_size(arr) > 10) sa_remove_last(arr);
+    printf("After removing 40 elements, 343 maybe present: %d\n", bf_may_contain(bf, 343));
+    bf_rebuild_array(bf, arr);
+    printf("After rebuild, 343 maybe present: %d, keys in filter: %zu\n", bf_may_contain(bf, 343), bf_count(bf));
+    bf_free(bf);
+    sa_free(arr);
+
+    // Filter in front of a linked list
+    ll_node* head = NULL;
+    for (int v = 1; v <= 5; v++) ll_push_back(&head, v * 100);
+    bf = bf_create_for_list(head, 0.001);
+    bf_ll_push_front(bf, &head, 42);
+    ll_display(head);
+    printf("Search 42: position %d, search 43: position %d\n", bf_ll_search(bf, head, 42), bf_ll_search(bf, head, 43));
+
+    while (head) ll_pop_front(&head);
+    bf_free(bf);
+    return 0;
+}
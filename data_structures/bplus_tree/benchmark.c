@@ -0,0 +1,228 @@
+/*
+Ordered map benchmark: B+-tree vs sorted static_array (binary search + shifting insert/remove).
+
+    Build: gcc -O2 benchmark.c bplus_tree.c ../arrays/static_array.c -o bpt_bench
+    Usage: ./bpt_bench [max_keys=10000000]
+
+For n = 10K, 100K, 1M, ... up to max_keys random keys, both structures are built from the same
+sorted data (bpt_create_from_array vs copying into a static_array) and then run
+    load       : bulk load time
+    lookup     : random lookups, half of them hits
+    read-heavy : 90% lookups, 5% inserts, 5% removes
+    mixed      : 50% lookups, 25% inserts, 25% removes
+    range      : range scans returning ~100 consecutive keys each
+and prints ns per operation (ms for load). The sorted array gets a bounded number of write-mixed
+operations per size because each insert/remove shifts n/2 ints on average. After every workload
+the two structures must hold the same keys, which the last column reports.
+The repo has no skip list, so the sorted array is the only ordered alternative measured.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "bplus_tree.h"
+#include "../arrays/static_array.h"
+
+#define OPS            1000000
+#define RANGE_SCANS    100000
+#define RANGE_KEYS     100
+#define SHIFT_BUDGET   2000000000ull   // Shifted ints allowed per sorted-array write workload
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Sorted static_array used as an ordered set
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Index of the first element >= key
+static size_t sorted_lower_bound(static_array* arr, int key) {
+    const int* d = sa_data(arr);
+    size_t lo = 0, hi = sa_size(arr);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (d[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static int sorted_contains(static_array* arr, int key) {
+    size_t i = sorted_lower_bound(arr, key);
+    return i < sa_size(arr) && sa_data(arr)[i] == key;
+}
+
+static void sorted_insert(static_array* arr, int key) {
+    size_t i = sorted_lower_bound(arr, key);
+    if (i < sa_size(arr) && sa_data(arr)[i] == key) return;
+    sa_insert_at(arr, i, key);
+}
+
+static void sorted_remove(static_array* arr, int key) {
+    size_t i = sorted_lower_bound(arr, key);
+    if (i < sa_size(arr) && sa_data(arr)[i] == key) sa_remove_at(arr, i);
+}
+
+// Sum of the keys in [lo, hi] so the scan cannot be optimized away
+static long long sorted_range_sum(static_array* arr, int lo, int hi) {
+    const int* d = sa_data(arr);
+    long long sum = 0;
+    for (size_t i = sorted_lower_bound(arr, lo); i < sa_size(arr) && d[i] <= hi; i++) sum += d[i];
+    return sum;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+static int same_keys(bptree* t, static_array* arr) {
+    if (bpt_size(t) != sa_size(arr)) return 0;
+    const int* d = sa_data(arr);
+    bpt_iter it = bpt_lower_bound(t, -2147483647 - 1);
+    int key;
+    for (size_t i = 0; bpt_iter_next(&it, &key, NULL); i++) {
+        if (key != d[i]) return 0;
+    }
+    return 1;
+}
+
+// Keys are even numbers in [0, 4n) so random probes are hits about half of the time
+static int random_key(size_t n) {
+    return (int)(next_random() % (4 * n));
+}
+
+// Runs `ops` operations with the given lookup/insert percentages on both structures, returns ns/op
+static void mixed(bptree* t, static_array* arr, size_t n, int lookup_pct, int insert_pct,
+                  size_t ops, size_t arr_ops, double* bpt_ns, double* arr_ns) {
+    uint64_t saved = rng_state;
+    long long hits = 0;
+    double t0 = now_seconds();
+    for (size_t i = 0; i < ops; i++) {
+        int dice = (int)(next_random() % 100);
+        int key = random_key(n);
+        if (dice < lookup_pct) hits += bpt_contains(t, key);
+        else if (dice < lookup_pct + insert_pct) bpt_insert(t, key, key);
+        else bpt_remove(t, key);
+    }
+    *bpt_ns = (now_seconds() - t0) * 1e9 / ops;
+
+    // Replay the same operation stream on the array; the tree then replays the array's extra tail
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < arr_ops; i++) {
+        int dice = (int)(next_random() % 100);
+        int key = random_key(n);
+        if (dice < lookup_pct) hits += sorted_contains(arr, key);
+        else if (dice < lookup_pct + insert_pct) sorted_insert(arr, key);
+        else sorted_remove(arr, key);
+    }
+    *arr_ns = (now_seconds() - t0) * 1e9 / arr_ops;
+    for (size_t i = arr_ops; i < ops; i++) {
+        int dice = (int)(next_random() % 100);
+        int key = random_key(n);
+        if (dice < lookup_pct) hits += sorted_contains(arr, key);
+        else if (dice < lookup_pct + insert_pct) sorted_insert(arr, key);
+        else sorted_remove(arr, key);
+    }
+    if (hits == -1) printf("unreachable\n");
+}
+
+static void run(size_t n) {
+    // Source data: n sorted even keys
+    static_array* src = sa_create_array(n);
+    for (size_t i = 0; i < n; i++) sa_insert_last(src, (int)(2 * i));
+    int ok = 1;
+
+    // load
+    double t0 = now_seconds();
+    bptree* t = bpt_create_from_array(src, NULL);
+    double load_bpt = (now_seconds() - t0) * 1e3;
+    t0 = now_seconds();
+    static_array* arr = sa_create_array(4 * n);   // Every key in [0, 4n) may end up present
+    for (size_t i = 0; i < n; i++) sa_insert_last(arr, sa_data(src)[i]);
+    double load_arr = (now_seconds() - t0) * 1e3;
+
+    // lookup
+    uint64_t saved = rng_state;
+    long long hits_bpt = 0, hits_arr = 0;
+    t0 = now_seconds();
+    for (size_t i = 0; i < OPS; i++) hits_bpt += bpt_contains(t, random_key(n));
+    double lookup_bpt = (now_seconds() - t0) * 1e9 / OPS;
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < OPS; i++) hits_arr += sorted_contains(arr, random_key(n));
+    double lookup_arr = (now_seconds() - t0) * 1e9 / OPS;
+    if (hits_bpt != hits_arr) ok = 0;
+
+    // read-heavy and mixed: the array is limited by the shifting cost (n/2 ints per write)
+    size_t writes_allowed = (size_t)(SHIFT_BUDGET / (n / 2 + 1));
+    size_t rh_arr = writes_allowed * 10 < OPS ? writes_allowed * 10 : OPS;
+    size_t mx_arr = writes_allowed * 2 < OPS ? writes_allowed * 2 : OPS;
+    if (rh_arr == 0) rh_arr = 1;
+    if (mx_arr == 0) mx_arr = 1;
+    double rh_bpt, rh_a, mx_bpt, mx_a;
+    mixed(t, arr, n, 90, 5, OPS, rh_arr, &rh_bpt, &rh_a);
+    if (!same_keys(t, arr)) ok = 0;
+    mixed(t, arr, n, 50, 25, OPS, mx_arr, &mx_bpt, &mx_a);
+    if (!same_keys(t, arr)) ok = 0;
+
+    // range: ~RANGE_KEYS keys per scan (keys are about 2 apart)
+    int* buf = (int*) malloc(4 * RANGE_KEYS * sizeof(int));
+    if (!buf) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    long long sum_bpt = 0, sum_arr = 0;
+    saved = rng_state;
+    t0 = now_seconds();
+    for (size_t i = 0; i < RANGE_SCANS; i++) {
+        int lo = random_key(n);
+        size_t got = bpt_range(t, lo, lo + 2 * RANGE_KEYS, buf, NULL, 4 * RANGE_KEYS);
+        for (size_t j = 0; j < got; j++) sum_bpt += buf[j];
+    }
+    double range_bpt = (now_seconds() - t0) * 1e9 / RANGE_SCANS;
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < RANGE_SCANS; i++) {
+        int lo = random_key(n);
+        sum_arr += sorted_range_sum(arr, lo, lo + 2 * RANGE_KEYS);
+    }
+    double range_arr = (now_seconds() - t0) * 1e9 / RANGE_SCANS;
+    if (sum_bpt != sum_arr) ok = 0;
+
+    printf("%10zu %4d | %8.2f %8.2f | %8.1f %8.1f | %8.1f %10.1f | %8.1f %10.1f | %8.1f %8.1f | %s\n",
+           n, bpt_height(t), load_bpt, load_arr, lookup_bpt, lookup_arr, rh_bpt, rh_a, mx_bpt, mx_a,
+           range_bpt, range_arr, ok ? "ok" : "MISMATCH");
+
+    free(buf);
+    bpt_free(t);
+    sa_free(arr);
+    sa_free(src);
+}
+
+int main(int argc, char** argv) {
+    size_t max_keys = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    if (max_keys > 200000000) max_keys = 200000000;   // Keys go up to 4 * n and must fit an int
+
+    printf("%10s %4s | %17s | %17s | %19s | %19s | %17s |\n", "", "", "load ms", "lookup ns",
+           "read-heavy ns", "mixed ns", "range ns");
+    printf("%10s %4s | %8s %8s | %8s %8s | %8s %10s | %8s %10s | %8s %8s |\n", "keys", "h",
+           "bpt", "array", "bpt", "array", "bpt", "array", "bpt", "array", "bpt", "array");
+    for (size_t n = 10000; n <= max_keys; n *= 10) run(n);
+    return 0;
+}
@@ -0,0 +1,624 @@
+#include "bplus_tree.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#if BPT_NODE_KEYS % 4 != 0 || BPT_NODE_KEYS < 8
+#error "BPT_NODE_KEYS must be a multiple of 4 and >= 8"
+#endif
+
+#define BPT_MAX BPT_NODE_KEYS
+#define BPT_MIN (BPT_NODE_KEYS / 2)                     // Fewer keys than this triggers borrow/merge
+#define BPT_BULK_FILL (BPT_MAX - BPT_MAX / 8)            // Bulk-loaded leaves keep 1/8 free for later inserts
+#define BPT_ALIGN 64
+#define BPT_PAD INT_MAX
+
+/*
+* Node layout: a small header, then the key array on its own cache lines. Key slots at index
+* >= nkeys always hold BPT_PAD, so the SIMD search can read whole groups of 4 keys without masking.
+*
+* Inner node with n keys has n + 1 children; child i holds the keys k with
+* keys[i - 1] <= k < keys[i]. Separators are copies of a leaf key and may become stale
+* after removals, which keeps them valid bounds.
+*/
+
+typedef struct bpt_node {
+	int nkeys;
+	int is_leaf;
+} bpt_node;
+
+typedef struct bpt_leaf {
+	bpt_node hdr;
+	struct bpt_leaf* prev;
+	struct bpt_leaf* next;
+	_Alignas(BPT_ALIGN) int keys[BPT_MAX];
+	int vals[BPT_MAX];
+} bpt_leaf;
+
+typedef struct bpt_inner {
+	bpt_node hdr;
+	_Alignas(BPT_ALIGN) int keys[BPT_MAX];
+	bpt_node* children[BPT_MAX + 1];
+} bpt_inner;
+
+typedef struct bptree {
+	bpt_node* root;
+	size_t size;
+	int height;
+} bptree;
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Node helpers
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+static inline void bpt_pad(int* keys, int from) {
+	for (int i = from; i < BPT_MAX; i++) keys[i] = BPT_PAD;
+}
+
+static void* bpt_alloc_node(size_t bytes, int is_leaf) {
+	// sizeof of both node types is a multiple of BPT_ALIGN because of the aligned key array
+	bpt_node* node = (bpt_node*) aligned_alloc(BPT_ALIGN, bytes);
+	if (!node) {
+		printf("Memory allocation failed: couldn't allocate memory for a B+-tree node!\n");
+		exit(1);
+	}
+	node->nkeys = 0;
+	node->is_leaf = is_leaf;
+	return node;
+}
+
+static bpt_leaf* bpt_new_leaf(void) {
+	bpt_leaf* leaf = (bpt_leaf*) bpt_alloc_node(sizeof(bpt_leaf), 1);
+	leaf->prev = NULL;
+	leaf->next = NULL;
+	bpt_pad(leaf->keys, 0);
+	return leaf;
+}
+
+static bpt_inner* bpt_new_inner(void) {
+	bpt_inner* in = (bpt_inner*) bpt_alloc_node(sizeof(bpt_inner), 0);
+	bpt_pad(in->keys, 0);
+	return in;
+}
+
+#ifdef __SSE2__
+static inline int bpt_hsum(__m128i v) {
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(v);
+}
+#endif
+
+// No. of keys[0, n) that are < key (position of the first key >= key)
+static inline int bpt_rank_less(const int* keys, int n, int key) {
+#ifdef __SSE2__
+	// Each compare yields -1 per lane where keys[i] < key; padding lanes never match
+	__m128i k = _mm_set1_epi32(key);
+	__m128i acc = _mm_setzero_si128();
+	for (int i = 0; i < n; i += 4) {
+		acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(k, _mm_load_si128((const __m128i*)(keys + i))));
+	}
+	return bpt_hsum(acc);
+#else
+	int lo = 0, hi = n;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (keys[mid] < key) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+#endif
+}
+
+// No. of keys[0, n) that are <= key (index of the child to descend into)
+static inline int bpt_rank_le(const int* keys, int n, int key) {
+#ifdef __SSE2__
+	// Count keys > key per group of 4; padding only counts as <= when key == INT_MAX, hence the cap
+	__m128i k = _mm_set1_epi32(key);
+	__m128i acc = _mm_setzero_si128();
+	int groups = 0;
+	for (int i = 0; i < n; i += 4, groups++) {
+		acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(_mm_load_si128((const __m128i*)(keys + i)), k));
+	}
+	int le = 4 * groups - bpt_hsum(acc);
+	return le < n ? le : n;
+#else
+	int lo = 0, hi = n;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (keys[mid] <= key) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+#endif
+}
+
+static bpt_leaf* bpt_find_leaf(const bptree* t, int key) {
+	bpt_node* node = t->root;
+	while (!node->is_leaf) {
+		const bpt_inner* in = (const bpt_inner*) node;
+		node = in->children[bpt_rank_le(in->keys, node->nkeys, key)];
+	}
+	return (bpt_leaf*) node;
+}
+
+static void bpt_free_node(bpt_node* node) {
+	if (!node->is_leaf) {
+		bpt_inner* in = (bpt_inner*) node;
+		for (int i = 0; i <= node->nkeys; i++) bpt_free_node(in->children[i]);
+	}
+	free(node);
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Construction
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+bptree* bpt_create(void) {
+	// Memory allocation: bptree struct
+	bptree* t = (bptree*) malloc(sizeof(bptree));
+	if (!t) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct bptree!\n");
+		exit(1);
+	}
+
+	// An empty tree is a single empty leaf
+	t->root = &bpt_new_leaf()->hdr;
+	t->size = 0;
+	t->height = 1;
+	return t;
+}
+
+
+// No. of nodes for one bulk-load level: as many as `fill` per node allows, but never more than `max` per node
+static size_t bpt_level_nodes(size_t items, size_t max, size_t fill) {
+	size_t at_max = (items + max - 1) / max;
+	size_t at_fill = items / fill;
+	size_t nodes = at_max > at_fill ? at_max : at_fill;
+	return nodes > 0 ? nodes : 1;
+}
+
+bptree* bpt_create_from_array(static_array* keys, static_array* vals) {
+	// Validate input parameters: keys and vals
+	if (!keys) {
+		printf("bpt_create_from_array: NULL keys array\n");
+		return NULL;
+	}
+	size_t n = sa_size(keys);
+	if (vals && sa_size(vals) != n) {
+		printf("bpt_create_from_array: %zu keys but %zu values\n", n, sa_size(vals));
+		return NULL;
+	}
+	const int* k = sa_const_data(keys);
+	const int* v = vals ? sa_const_data(vals) : NULL;
+	for (size_t i = 1; i < n; i++) {
+		if (k[i - 1] >= k[i]) {
+			printf("bpt_create_from_array: keys are not strictly increasing at index %zu\n", i);
+			return NULL;
+		}
+	}
+
+	bptree* t = bpt_create();
+	if (n == 0) return t;
+	free(t->root);
+
+	// Leaf level: spread the entries evenly, every leaf at most full and at least half full
+	size_t count = bpt_level_nodes(n, BPT_MAX, BPT_BULK_FILL);
+	bpt_node** level = (bpt_node**) malloc(count * sizeof(bpt_node*));
+	int* low = (int*) malloc(count * sizeof(int));   // Smallest key under each node of the level
+	if (!level || !low) {
+		printf("Memory allocation failed: couldn't allocate the bulk-load level for %zu nodes\n", count);
+		exit(1);
+	}
+
+	bpt_leaf* prev = NULL;
+	size_t next = 0;
+	for (size_t i = 0; i < count; i++) {
+		int take = (int)(n / count + (i < n % count ? 1 : 0));
+		bpt_leaf* leaf = bpt_new_leaf();
+		memcpy(leaf->keys, k + next, (size_t)take * sizeof(int));
+		if (v) memcpy(leaf->vals, v + next, (size_t)take * sizeof(int));
+		else for (int j = 0; j < take; j++) leaf->vals[j] = (int)(next + (size_t)j);
+		leaf->hdr.nkeys = take;
+		leaf->prev = prev;
+		if (prev) prev->next = leaf;
+		prev = leaf;
+		level[i] = &leaf->hdr;
+		low[i] = leaf->keys[0];
+		next += (size_t)take;
+	}
+
+	// Inner levels, built in place over the level arrays (a parent's index never exceeds its first child's)
+	int height = 1;
+	while (count > 1) {
+		size_t parents = bpt_level_nodes(count, BPT_MAX + 1, BPT_BULK_FILL + 1);
+		size_t child = 0;
+		for (size_t p = 0; p < parents; p++) {
+			int take = (int)(count / parents + (p < count % parents ? 1 : 0));
+			bpt_inner* in = bpt_new_inner();
+			int first_low = low[child];
+			for (int j = 0; j < take; j++, child++) {
+				in->children[j] = level[child];
+				if (j > 0) in->keys[j - 1] = low[child];
+			}
+			in->hdr.nkeys = take - 1;
+			level[p] = &in->hdr;
+			low[p] = first_low;
+		}
+		count = parents;
+		height++;
+	}
+
+	t->root = level[0];
+	t->size = n;
+	t->height = height;
+	free(level);
+	free(low);
+	return t;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Insert
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Insert into the subtree at node. If node splits, *split_node is the new right sibling and *split_key its separator
+static int bpt_insert_rec(bptree* t, bpt_node* node, int key, int val, int* split_key, bpt_node** split_node) {
+	*split_node = NULL;
+
+	if (node->is_leaf) {
+		bpt_leaf* leaf = (bpt_leaf*) node;
+		int n = node->nkeys;
+		int pos = bpt_rank_less(leaf->keys, n, key);
+		if (pos < n && leaf->keys[pos] == key) {
+			leaf->vals[pos] = val;
+			return 1;
+		}
+
+		// Full leaf: move the upper half into a new right neighbour, then insert into the proper half
+		if (n == BPT_MAX) {
+			int half = BPT_MAX / 2;
+			bpt_leaf* right = bpt_new_leaf();
+			memcpy(right->keys, leaf->keys + half, (size_t)(n - half) * sizeof(int));
+			memcpy(right->vals, leaf->vals + half, (size_t)(n - half) * sizeof(int));
+			right->hdr.nkeys = n - half;
+			leaf->hdr.nkeys = half;
+			bpt_pad(leaf->keys, half);
+
+			right->next = leaf->next;
+			if (right->next) right->next->prev = right;
+			right->prev = leaf;
+			leaf->next = right;
+
+			*split_key = right->keys[0];
+			*split_node = &right->hdr;
+			if (pos > half) {
+				leaf = right;
+				pos -= half;
+			}
+			n = leaf->hdr.nkeys;
+		}
+
+		memmove(leaf->keys + pos + 1, leaf->keys + pos, (size_t)(n - pos) * sizeof(int));
+		memmove(leaf->vals + pos + 1, leaf->vals + pos, (size_t)(n - pos) * sizeof(int));
+		leaf->keys[pos] = key;
+		leaf->vals[pos] = val;
+		leaf->hdr.nkeys = n + 1;
+		t->size++;
+		return 0;
+	}
+
+	bpt_inner* in = (bpt_inner*) node;
+	int ci = bpt_rank_le(in->keys, node->nkeys, key);
+	int child_key;
+	bpt_node* child_new;
+	int rc = bpt_insert_rec(t, in->children[ci], key, val, &child_key, &child_new);
+	if (!child_new) return rc;
+
+	// The child split: add (child_key, child_new) after child ci, splitting this node first if it is full
+	int n = node->nkeys;
+	if (n == BPT_MAX) {
+		// Keys [0, half) stay, keys[half] moves up, keys (half, n) go to the new right node
+		int half = BPT_MAX / 2;
+		int rn = n - half - 1;
+		bpt_inner* right = bpt_new_inner();
+		memcpy(right->keys, in->keys + half + 1, (size_t)rn * sizeof(int));
+		memcpy(right->children, in->children + half + 1, (size_t)(rn + 1) * sizeof(bpt_node*));
+		right->hdr.nkeys = rn;
+
+		*split_key = in->keys[half];
+		*split_node = &right->hdr;
+		node->nkeys = half;
+		bpt_pad(in->keys, half);
+		if (ci > half) {
+			in = right;
+			ci -= half + 1;
+		}
+		n = in->hdr.nkeys;
+	}
+
+	memmove(in->keys + ci + 1, in->keys + ci, (size_t)(n - ci) * sizeof(int));
+	memmove(in->children + ci + 2, in->children + ci + 1, (size_t)(n - ci) * sizeof(bpt_node*));
+	in->keys[ci] = child_key;
+	in->children[ci + 1] = child_new;
+	in->hdr.nkeys = n + 1;
+	return rc;
+}
+
+int bpt_insert(bptree* t, int key, int val) {
+	// Validate input parameter: t
+	if (!t) {
+		printf("bpt_insert: NULL tree pointer\n");
+		return -1;
+	}
+
+	int split_key;
+	bpt_node* split_node;
+	int rc = bpt_insert_rec(t, t->root, key, val, &split_key, &split_node);
+
+	// The root split: grow a new root above the two halves
+	if (split_node) {
+		bpt_inner* root = bpt_new_inner();
+		root->keys[0] = split_key;
+		root->children[0] = t->root;
+		root->children[1] = split_node;
+		root->hdr.nkeys = 1;
+		t->root = &root->hdr;
+		t->height++;
+	}
+	return rc;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Lookup
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+int bpt_get(const bptree* t, int key, int* out) {
+	if (!t) return -1;
+
+	const bpt_leaf* leaf = bpt_find_leaf(t, key);
+	int pos = bpt_rank_less(leaf->keys, leaf->hdr.nkeys, key);
+	if (pos == leaf->hdr.nkeys || leaf->keys[pos] != key) return -1;
+	if (out) *out = leaf->vals[pos];
+	return 0;
+}
+
+
+int bpt_contains(const bptree* t, int key) {
+	return bpt_get(t, key, NULL) == 0;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Remove
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Move the last entry of child ci - 1 to the front of child ci
+static void bpt_borrow_left(bpt_inner* parent, int ci) {
+	bpt_node* child = parent->children[ci];
+	bpt_node* left = parent->children[ci - 1];
+	int cn = child->nkeys, ln = left->nkeys;
+
+	if (child->is_leaf) {
+		bpt_leaf* c = (bpt_leaf*) child;
+		bpt_leaf* l = (bpt_leaf*) left;
+		memmove(c->keys + 1, c->keys, (size_t)cn * sizeof(int));
+		memmove(c->vals + 1, c->vals, (size_t)cn * sizeof(int));
+		c->keys[0] = l->keys[ln - 1];
+		c->vals[0] = l->vals[ln - 1];
+		l->keys[ln - 1] = BPT_PAD;
+		parent->keys[ci - 1] = c->keys[0];
+	} else {
+		// Rotate through the parent: separator comes down, left's last key goes up
+		bpt_inner* c = (bpt_inner*) child;
+		bpt_inner* l = (bpt_inner*) left;
+		memmove(c->keys + 1, c->keys, (size_t)cn * sizeof(int));
+		memmove(c->children + 1, c->children, (size_t)(cn + 1) * sizeof(bpt_node*));
+		c->keys[0] = parent->keys[ci - 1];
+		c->children[0] = l->children[ln];
+		parent->keys[ci - 1] = l->keys[ln - 1];
+		l->keys[ln - 1] = BPT_PAD;
+	}
+	child->nkeys = cn + 1;
+	left->nkeys = ln - 1;
+}
+
+// Move the first entry of child ci + 1 to the end of child ci
+static void bpt_borrow_right(bpt_inner* parent, int ci) {
+	bpt_node* child = parent->children[ci];
+	bpt_node* right = parent->children[ci + 1];
+	int cn = child->nkeys, rn = right->nkeys;
+
+	if (child->is_leaf) {
+		bpt_leaf* c = (bpt_leaf*) child;
+		bpt_leaf* r = (bpt_leaf*) right;
+		c->keys[cn] = r->keys[0];
+		c->vals[cn] = r->vals[0];
+		memmove(r->keys, r->keys + 1, (size_t)(rn - 1) * sizeof(int));
+		memmove(r->vals, r->vals + 1, (size_t)(rn - 1) * sizeof(int));
+		r->keys[rn - 1] = BPT_PAD;
+		parent->keys[ci] = r->keys[0];
+	} else {
+		bpt_inner* c = (bpt_inner*) child;
+		bpt_inner* r = (bpt_inner*) right;
+		c->keys[cn] = parent->keys[ci];
+		c->children[cn + 1] = r->children[0];
+		parent->keys[ci] = r->keys[0];
+		memmove(r->keys, r->keys + 1, (size_t)(rn - 1) * sizeof(int));
+		memmove(r->children, r->children + 1, (size_t)rn * sizeof(bpt_node*));
+		r->keys[rn - 1] = BPT_PAD;
+	}
+	child->nkeys = cn + 1;
+	right->nkeys = rn - 1;
+}
+
+// Merge child i + 1 into child i and drop separator i from the parent
+static void bpt_merge(bpt_inner* parent, int i) {
+	bpt_node* left = parent->children[i];
+	bpt_node* right = parent->children[i + 1];
+	int ln = left->nkeys, rn = right->nkeys;
+
+	if (left->is_leaf) {
+		bpt_leaf* l = (bpt_leaf*) left;
+		bpt_leaf* r = (bpt_leaf*) right;
+		memcpy(l->keys + ln, r->keys, (size_t)rn * sizeof(int));
+		memcpy(l->vals + ln, r->vals, (size_t)rn * sizeof(int));
+		left->nkeys = ln + rn;
+		l->next = r->next;
+		if (l->next) l->next->prev = l;
+	} else {
+		bpt_inner* l = (bpt_inner*) left;
+		bpt_inner* r = (bpt_inner*) right;
+		l->keys[ln] = parent->keys[i];
+		memcpy(l->keys + ln + 1, r->keys, (size_t)rn * sizeof(int));
+		memcpy(l->children + ln + 1, r->children, (size_t)(rn + 1) * sizeof(bpt_node*));
+		left->nkeys = ln + rn + 1;
+	}
+	free(right);
+
+	int pn = parent->hdr.nkeys;
+	memmove(parent->keys + i, parent->keys + i + 1, (size_t)(pn - i - 1) * sizeof(int));
+	memmove(parent->children + i + 1, parent->children + i + 2, (size_t)(pn - i - 1) * sizeof(bpt_node*));
+	parent->keys[pn - 1] = BPT_PAD;
+	parent->hdr.nkeys = pn - 1;
+}
+
+// Child ci dropped below BPT_MIN keys: borrow from a sibling that can spare one, else merge with a sibling
+static void bpt_fix_child(bpt_inner* parent, int ci) {
+	bpt_node* left = ci > 0 ? parent->children[ci - 1] : NULL;
+	bpt_node* right = ci < parent->hdr.nkeys ? parent->children[ci + 1] : NULL;
+
+	if (left && left->nkeys > BPT_MIN) bpt_borrow_left(parent, ci);
+	else if (right && right->nkeys > BPT_MIN) bpt_borrow_right(parent, ci);
+	else if (left) bpt_merge(parent, ci - 1);
+	else bpt_merge(parent, ci);
+}
+
+static int bpt_remove_rec(bptree* t, bpt_node* node, int key) {
+	if (node->is_leaf) {
+		bpt_leaf* leaf = (bpt_leaf*) node;
+		int n = node->nkeys;
+		int pos = bpt_rank_less(leaf->keys, n, key);
+		if (pos == n || leaf->keys[pos] != key) return -1;
+
+		memmove(leaf->keys + pos, leaf->keys + pos + 1, (size_t)(n - pos - 1) * sizeof(int));
+		memmove(leaf->vals + pos, leaf->vals + pos + 1, (size_t)(n - pos - 1) * sizeof(int));
+		leaf->keys[n - 1] = BPT_PAD;
+		node->nkeys = n - 1;
+		t->size--;
+		return 0;
+	}
+
+	bpt_inner* in = (bpt_inner*) node;
+	int ci = bpt_rank_le(in->keys, node->nkeys, key);
+	int rc = bpt_remove_rec(t, in->children[ci], key);
+	if (rc == 0 && in->children[ci]->nkeys < BPT_MIN) bpt_fix_child(in, ci);
+	return rc;
+}
+
+int bpt_remove(bptree* t, int key) {
+	// Validate input parameter: t
+	if (!t) {
+		printf("bpt_remove: NULL tree pointer\n");
+		return -1;
+	}
+
+	int rc = bpt_remove_rec(t, t->root, key);
+
+	// The root lost its last separator: its only child becomes the root
+	if (!t->root->is_leaf && t->root->nkeys == 0) {
+		bpt_node* old = t->root;
+		t->root = ((bpt_inner*) old)->children[0];
+		free(old);
+		t->height--;
+	}
+	return rc;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Range iteration
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+bpt_iter bpt_lower_bound(const bptree* t, int key) {
+	bpt_iter it = { NULL, 0 };
+	if (!t) return it;
+
+	const bpt_leaf* leaf = bpt_find_leaf(t, key);
+	it.leaf = leaf;
+	it.pos = bpt_rank_less(leaf->keys, leaf->hdr.nkeys, key);
+	return it;
+}
+
+
+int bpt_iter_next(bpt_iter* it, int* key, int* val) {
+	if (!it) return 0;
+
+	// Step over exhausted leaves
+	const bpt_leaf* leaf = (const bpt_leaf*) it->leaf;
+	while (leaf && it->pos >= leaf->hdr.nkeys) {
+		leaf = leaf->next;
+		it->pos = 0;
+	}
+	it->leaf = leaf;
+	if (!leaf) return 0;
+
+	if (key) *key = leaf->keys[it->pos];
+	if (val) *val = leaf->vals[it->pos];
+	it->pos++;
+	return 1;
+}
+
+
+size_t bpt_range(const bptree* t, int lo, int hi, int* keys, int* vals, size_t max) {
+	if (!t || lo > hi) return 0;
+
+	// Start in the leaf holding lo, then copy leaf by leaf until a key passes hi
+	const bpt_leaf* leaf = bpt_find_leaf(t, lo);
+	int pos = bpt_rank_less(leaf->keys, leaf->hdr.nkeys, lo);
+	size_t count = 0;
+	while (leaf && count < max) {
+		int n = leaf->hdr.nkeys;
+		int end = bpt_rank_le(leaf->keys, n, hi);
+		size_t take = (size_t)(end > pos ? end - pos : 0);
+		if (take > max - count) take = max - count;
+		if (keys) memcpy(keys + count, leaf->keys + pos, take * sizeof(int));
+		if (vals) memcpy(vals + count, leaf->vals + pos, take * sizeof(int));
+		count += take;
+		if (end < n) break;
+		leaf = leaf->next;
+		pos = 0;
+	}
+	return count;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Misc
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+size_t bpt_size(const bptree* t) {
+	return t ? t->size : 0;
+}
+
+
+int bpt_height(const bptree* t) {
+	return t ? t->height : 0;
+}
+
+
+void bpt_free(bptree* t) {
+	// Validate input parameter: t
+	if (!t) return;
+	bpt_free_node(t->root);
+	free(t);
+}
@@ -0,0 +1,76 @@
+#ifndef DSA_BPLUS_TREE_H
+#define DSA_BPLUS_TREE_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* B+-tree ordered map with int keys and int values.
+* Keys live only in fixed-size nodes whose key array is cache-line aligned: by default 64 keys
+* (4 cache lines) per node, so a lookup in a tree of millions of keys touches 4-5 nodes.
+* Inside a node the search compares 4 keys per SSE2 instruction (binary search without SSE2).
+* All entries sit in the leaves, which are doubly linked, so range scans walk leaves sequentially.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+// Keys per node; must be a multiple of 4 and >= 8. Override at compile time with -DBPT_NODE_KEYS=...
+#ifndef BPT_NODE_KEYS
+#define BPT_NODE_KEYS 64
+#endif
+
+typedef struct bptree bptree;
+
+// Cursor over the entries in key order (see bpt_lower_bound / bpt_iter_next)
+typedef struct bpt_iter {
+	const void* leaf;
+	int pos;
+} bpt_iter;
+
+// Create an empty tree
+bptree* bpt_create(void);
+
+// Bulk-load a tree from strictly increasing keys. vals may be NULL (then the value of keys[i] is i). O(n)
+bptree* bpt_create_from_array(static_array* keys, static_array* vals);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Insert or overwrite key -> val - returns 0 if inserted, 1 if an existing value was overwritten, -1 on error
+int bpt_insert(bptree* t, int key, int val);
+
+// Look up key - returns 0 and stores the value in *out (if out != NULL) when found, else -1
+int bpt_get(const bptree* t, int key, int* out);
+
+// Returns 1 if key is in the tree else 0
+int bpt_contains(const bptree* t, int key);
+
+// Remove key - returns 0 if removed else -1 (not present)
+int bpt_remove(bptree* t, int key);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Cursor at the first entry with key >= key
+bpt_iter bpt_lower_bound(const bptree* t, int key);
+
+// Read the entry at the cursor and advance - returns 1 if an entry was read, 0 at the end
+int bpt_iter_next(bpt_iter* it, int* key, int* val);
+
+// Copy up to max entries with lo <= key <= hi, in key order, into keys/vals (either may be NULL). Returns the count
+size_t bpt_range(const bptree* t, int lo, int hi, int* keys, int* vals, size_t max);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of entries
+size_t bpt_size(const bptree* t);
+
+// Get the no. of levels (1 = the root is a leaf)
+int bpt_height(const bptree* t);
+
+// Delete the tree
+void bpt_free(bptree* t);
+
+
+#endif /* DSA_BPLUS_TREE_H */
@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include "bplus_tree.h"
+#include "../arrays/static_array.h"
+
+int main(void) {
+
+    printf("\n\n============================| B+ TREE EXAMPLE |============================\n\n");
+
+    // Insert, overwrite, look up and remove
+    bptree* t = bpt_create();
+    for (int k = 0; k < 1000; k++) bpt_insert(t, k * 3, k);
+    printf("Inserted 1000 keys: size=%zu, height=%d\n", bpt_size(t), bpt_height(t));
+    printf("Overwriting key 30 returns %d\n", bpt_insert(t, 30, -1));
+
+    int v;
+    if (bpt_get(t, 30, &v) == 0) printf("Value of key 30: %d\n", v);
+    printf("Contains 31: %d\n", bpt_contains(t, 31));
+    printf("Removing 30 returns %d, removing 31 returns %d\n", bpt_remove(t, 30), bpt_remove(t, 31));
+
+    // Range scan over the linked leaves
+    int keys[16], vals[16];
+    size_t n = bpt_range(t, 20, 50, keys, vals, 16);
+    printf("Entries with 20 <= key <= 50: ");
+    for (size_t i = 0; i < n; i++) printf("%d->%d ", keys[i], vals[i]);
+    printf("\n");
+
+    // Cursor iteration from a lower bound
+    printf("First 5 keys >= 2990: ");
+    bpt_iter it = bpt_lower_bound(t, 2990);
+    for (int i = 0; i < 5 && bpt_iter_next(&it, &keys[0], NULL); i++) printf("%d ", keys[0]);
+    printf("\n");
+    bpt_free(t);
+
+    // Bulk load from a sorted static_array (value = index when no value array is given)
+    static_array* sorted = sa_create_array(100000);
+    for (int k = 0; k < 100000; k++) sa_insert_last(sorted, 2 * k);
+    t = bpt_create_from_array(sorted, NULL);
+    printf("Bulk-loaded %zu keys: height=%d\n", bpt_size(t), bpt_height(t));
+    if (bpt_get(t, 12344, &v) == 0) printf("Key 12344 is at index %d of the array\n", v);
+
+    bpt_free(t);
+    sa_free(sorted);
+    return 0;
+}
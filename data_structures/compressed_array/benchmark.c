@@ -0,0 +1,148 @@
+/*
+Compressed array benchmark: size and decode speed on sorted ID distributions.
+
+    Build: gcc -O2 benchmark.c compressed_array.c ../arrays/static_array.c -o cpa_bench
+    Usage: ./cpa_bench [elements=10000000]
+
+For three distributions of sorted ints it builds a compressed_array from a static_array and reports:
+  bits/value and compression ratio (plain 4-byte array size / cpa_bytes),
+  decode GB/s (decoded bytes per second for cpa_decode of the whole array; memcpy of the plain
+  array is printed for scale), ns per cpa_get_element and per cpa_lower_bound at random positions,
+  and ns per binary search on the plain array.
+Distributions: dense IDs (mostly consecutive, 5% small gaps), clustered (runs of about 1000 close IDs
+separated by large jumps) and uniform sparse (gaps spread evenly over the whole int range).
+The decoded array and every lower_bound must match the plain array, which the last column reports.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "compressed_array.h"
+#include "../arrays/static_array.h"
+
+#define DECODE_BYTES  2000000000ull    // Decoded bytes per decode measurement
+#define QUERIES       1000000
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Next gap for distribution d
+static uint32_t next_gap(int d, size_t i, size_t n) {
+    switch (d) {
+    case 0: return 1 + ((next_random() % 20 == 0) ? (uint32_t)(next_random() % 8) : 0);
+    case 1: return (i % 1000 == 0) ? (uint32_t)(next_random() % 100000) : 1 + (uint32_t)(next_random() % 4);
+    default: return (uint32_t)(next_random() % (2 * (0x7FFFFFFFull / n)));
+    }
+}
+
+static size_t plain_lower_bound(const int* data, size_t n, int key) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (data[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    if (n == 0) n = 1;
+    const char* names[3] = { "dense IDs", "clustered", "uniform sparse" };
+    int* out = (int*) malloc(sizeof(int) * n);
+    int* copy = (int*) malloc(sizeof(int) * n);
+    size_t* positions = (size_t*) malloc(sizeof(size_t) * QUERIES);
+    int* keys = (int*) malloc(sizeof(int) * QUERIES);
+    if (!out || !copy || !positions || !keys) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    printf("%zu elements, plain size %.1f MB\n", n, (double)(sizeof(int) * n) / 1e6);
+    printf("%-15s %9s %7s %11s %11s %9s %9s %9s %8s\n", "distribution", "bits/val", "ratio",
+           "dec GB/s", "memcpy GB/s", "get ns", "lb ns", "plain ns", "check");
+
+    for (int d = 0; d < 3; d++) {
+        static_array* arr = sa_create_array(n);
+        int64_t v = 0;
+        for (size_t i = 0; i < n; i++) {
+            v += next_gap(d, i, n);
+            if (v > 0x7FFFFFFF) v = 0x7FFFFFFF;
+            sa_insert_last(arr, (int)v);
+        }
+        const int* data = sa_data(arr);
+        compressed_array* ca = cpa_create_from_array(arr);
+        int ok = 1;
+
+        // Whole-array decode vs memcpy of the plain array
+        size_t reps = DECODE_BYTES / (sizeof(int) * n);
+        if (reps == 0) reps = 1;
+        double t0 = now_seconds();
+        for (size_t r = 0; r < reps; r++) cpa_decode(ca, out);
+        double dec_s = (now_seconds() - t0) / (double)reps;
+        if (memcmp(out, data, sizeof(int) * n) != 0) ok = 0;
+
+        t0 = now_seconds();
+        for (size_t r = 0; r < reps; r++) {
+            memcpy(copy, data, sizeof(int) * n);
+            __asm__ __volatile__("" : : "r"(copy) : "memory");
+        }
+        double cpy_s = (now_seconds() - t0) / (double)reps;
+
+        // Random access
+        for (size_t q = 0; q < QUERIES; q++) {
+            positions[q] = (size_t)(next_random() % n);
+            keys[q] = data[positions[q]] + (int)(next_random() % 3) - 1;
+        }
+        long long sink = 0;
+        t0 = now_seconds();
+        for (size_t q = 0; q < QUERIES; q++) sink += cpa_get_element(ca, positions[q]);
+        double get_ns = (now_seconds() - t0) * 1e9 / QUERIES;
+
+        // Lower bound, compressed vs plain binary search
+        size_t sum_c = 0, sum_p = 0;
+        t0 = now_seconds();
+        for (size_t q = 0; q < QUERIES; q++) sum_c += cpa_lower_bound(ca, keys[q]);
+        double lb_ns = (now_seconds() - t0) * 1e9 / QUERIES;
+        t0 = now_seconds();
+        for (size_t q = 0; q < QUERIES; q++) sum_p += plain_lower_bound(data, n, keys[q]);
+        double plain_ns = (now_seconds() - t0) * 1e9 / QUERIES;
+        if (sum_c != sum_p) ok = 0;
+        for (size_t q = 0; q < 1000; q++) {
+            if (cpa_lower_bound(ca, keys[q]) != plain_lower_bound(data, n, keys[q])) ok = 0;
+            if (cpa_get_element(ca, positions[q]) != data[positions[q]]) ok = 0;
+        }
+
+        double bytes = (double)(sizeof(int) * n);
+        printf("%-15s %9.2f %6.1fx %11.2f %11.2f %9.1f %9.1f %9.1f %8s\n", names[d],
+               8.0 * (double)cpa_bytes(ca) / (double)n, bytes / (double)cpa_bytes(ca),
+               bytes / dec_s / 1e9, bytes / cpy_s / 1e9, get_ns, lb_ns, plain_ns, ok ? "ok" : "MISMATCH");
+        if (sink == 42) printf(" ");
+
+        cpa_free(ca);
+        sa_free(arr);
+    }
+
+    free(out);
+    free(copy);
+    free(positions);
+    free(keys);
+    return 0;
+}
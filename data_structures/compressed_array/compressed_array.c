@@ -0,0 +1,348 @@
+#include "compressed_array.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define CPA_LANES 4                                 // Interleaved 32-bit lanes (one SSE2 register)
+#define CPA_PER_LANE (CPA_BLOCK / CPA_LANES)        // Values per lane in a block
+#define CPA_ALIGN 64                                // Packed buffer alignment in bytes (one cache line)
+
+/*
+* Packed layout of a block with bit width b: 4 * b words. Value i of the block belongs to lane i % 4
+* as its (i / 4)-th value; each lane is a plain little-endian bit stream of 32 values of b bits, and
+* word k of lane j is stored at index 4 * k + j. Loading 4 consecutive words therefore gives word k
+* of all 4 lanes, and one shift + mask extracts values 4v .. 4v + 3 at once.
+*
+* Residuals are unsigned 32-bit: value - first (frame of reference) or value - value[i - 4]
+* (delta, with value[-4 .. -1] taken as first). The tail of the last block is padded with its last value.
+*/
+
+typedef struct cpa_block {
+	size_t offset;       // First word of the block in packed
+	uint8_t bits;        // Bits per residual, 0..32
+	uint8_t delta;       // 1 = delta coded, 0 = frame of reference
+} cpa_block;
+
+typedef struct compressed_array {
+	uint32_t* packed;    // 64-byte aligned, every block starts on a 16-byte boundary
+	size_t words;
+	int* firsts;         // First value of every block (searched by cpa_lower_bound)
+	cpa_block* dir;
+	size_t nblocks;
+	size_t size;
+} compressed_array;
+
+
+static inline uint8_t cpa_bits_for(uint32_t max) {
+	uint8_t bits = 0;
+	while (bits < 32 && (max >> bits) != 0) bits++;
+	return bits;
+}
+
+static inline uint32_t cpa_mask(int bits) {
+	return bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1;
+}
+
+// Value v of lane j from a packed block with the given bit width
+static inline uint32_t cpa_extract(const uint32_t* in, int bits, size_t j, size_t v) {
+	if (bits == 0) return 0;
+	size_t pos = v * (size_t)bits;
+	size_t k = pos >> 5, s = pos & 31;
+	uint64_t w = in[CPA_LANES * k + j];
+	if (s + (size_t)bits > 32) w |= (uint64_t)in[CPA_LANES * (k + 1) + j] << 32;
+	return (uint32_t)(w >> s) & cpa_mask(bits);
+}
+
+// Pack 128 residuals (natural order) into 4 * bits words
+static void cpa_pack(const uint32_t* res, int bits, uint32_t* out) {
+	memset(out, 0, sizeof(uint32_t) * CPA_LANES * (size_t)bits);
+	if (bits == 0) return;
+	for (size_t i = 0; i < CPA_BLOCK; i++) {
+		size_t j = i % CPA_LANES;
+		size_t pos = (i / CPA_LANES) * (size_t)bits;
+		size_t k = pos >> 5, s = pos & 31;
+		out[CPA_LANES * k + j] |= res[i] << s;
+		if (s + (size_t)bits > 32) out[CPA_LANES * (k + 1) + j] |= res[i] >> (32 - s);
+	}
+}
+
+/*
+* Unpack one block and undo its coding: out[i] = first + residual (frame of reference) or
+* out[i] = out[i - 4] + residual (delta). Called with a constant bit width from the switch below,
+* so the compiler unrolls the 32 steps with immediate shift counts.
+*/
+static inline __attribute__((always_inline))
+void cpa_unpack(const uint32_t* in, int bits, int delta, int first, int* out) {
+#ifdef __SSE2__
+	const __m128i mask = _mm_set1_epi32((int)cpa_mask(bits));
+	__m128i acc = _mm_set1_epi32(first);
+	for (int v = 0; v < CPA_PER_LANE; v++) {
+		__m128i x = _mm_setzero_si128();
+		if (bits != 0) {
+			int pos = v * bits, k = pos >> 5, s = pos & 31;
+			x = _mm_srli_epi32(_mm_load_si128((const __m128i*)(in + CPA_LANES * k)), s);
+			if (s + bits > 32)
+				x = _mm_or_si128(x, _mm_slli_epi32(_mm_load_si128((const __m128i*)(in + CPA_LANES * (k + 1))), 32 - s));
+			x = _mm_and_si128(x, mask);
+		}
+		if (delta) {
+			acc = _mm_add_epi32(acc, x);
+			_mm_storeu_si128((__m128i*)(out + CPA_LANES * v), acc);
+		} else {
+			_mm_storeu_si128((__m128i*)(out + CPA_LANES * v), _mm_add_epi32(acc, x));
+		}
+	}
+#else
+	uint32_t acc[CPA_LANES] = { (uint32_t)first, (uint32_t)first, (uint32_t)first, (uint32_t)first };
+	for (size_t v = 0; v < CPA_PER_LANE; v++) {
+		for (size_t j = 0; j < CPA_LANES; j++) {
+			uint32_t x = cpa_extract(in, bits, j, v);
+			if (delta) {
+				acc[j] += x;
+				out[CPA_LANES * v + j] = (int)acc[j];
+			} else {
+				out[CPA_LANES * v + j] = (int)(acc[j] + x);
+			}
+		}
+	}
+#endif
+}
+
+#define CPA_CASE(b) case b: cpa_unpack(in, b, delta, first, out); break;
+
+// Decode a full block (128 values) into out
+static void cpa_decode_full(const compressed_array* ca, size_t block, int* out) {
+	const cpa_block* d = &ca->dir[block];
+	const uint32_t* in = ca->packed + d->offset;
+	int delta = d->delta, first = ca->firsts[block];
+	switch (d->bits) {
+		CPA_CASE(0)  CPA_CASE(1)  CPA_CASE(2)  CPA_CASE(3)  CPA_CASE(4)  CPA_CASE(5)  CPA_CASE(6)
+		CPA_CASE(7)  CPA_CASE(8)  CPA_CASE(9)  CPA_CASE(10) CPA_CASE(11) CPA_CASE(12) CPA_CASE(13)
+		CPA_CASE(14) CPA_CASE(15) CPA_CASE(16) CPA_CASE(17) CPA_CASE(18) CPA_CASE(19) CPA_CASE(20)
+		CPA_CASE(21) CPA_CASE(22) CPA_CASE(23) CPA_CASE(24) CPA_CASE(25) CPA_CASE(26) CPA_CASE(27)
+		CPA_CASE(28) CPA_CASE(29) CPA_CASE(30) CPA_CASE(31) CPA_CASE(32)
+	}
+}
+
+static inline size_t cpa_block_count(const compressed_array* ca, size_t block) {
+	size_t start = block * CPA_BLOCK;
+	return ca->size - start < CPA_BLOCK ? ca->size - start : CPA_BLOCK;
+}
+
+
+compressed_array* cpa_create_from_array(static_array* src) {
+	// Validate input parameter: src
+	if (!src) {
+		printf("cpa_create_from_array: NULL array pointer\n");
+		return NULL;
+	}
+
+	size_t n = sa_size(src);
+	const int* values = sa_const_data(src);
+	for (size_t i = 1; i < n; i++) {
+		if (values[i] < values[i - 1]) {
+			printf("cpa_create_from_array: array is not sorted (index %zu)\n", i);
+			return NULL;
+		}
+	}
+
+	// Memory allocation: compressed_array struct and block directory
+	compressed_array* ca = (compressed_array*) malloc(sizeof(compressed_array));
+	if (!ca) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct compressed_array!\n");
+		exit(1);
+	}
+	ca->size = n;
+	ca->nblocks = (n + CPA_BLOCK - 1) / CPA_BLOCK;
+	ca->firsts = (int*) malloc(sizeof(int) * (ca->nblocks ? ca->nblocks : 1));
+	ca->dir = (cpa_block*) malloc(sizeof(cpa_block) * (ca->nblocks ? ca->nblocks : 1));
+	if (!ca->firsts || !ca->dir) {
+		printf("Memory allocation failed: couldn't allocate the directory for %zu blocks\n", ca->nblocks);
+		exit(1);
+	}
+
+	// First pass: pick the coding and bit width of every block
+	uint32_t res_for[CPA_BLOCK], res_delta[CPA_BLOCK];
+	ca->words = 0;
+	for (size_t b = 0; b < ca->nblocks; b++) {
+		const int* x = values + b * CPA_BLOCK;
+		size_t count = cpa_block_count(ca, b);
+		uint32_t max_for = (uint32_t)x[count - 1] - (uint32_t)x[0];
+		uint32_t max_delta = 0;
+		for (size_t i = 0; i < count; i++) {
+			uint32_t d = (uint32_t)x[i] - (uint32_t)(i < CPA_LANES ? x[0] : x[i - CPA_LANES]);
+			if (d > max_delta) max_delta = d;
+		}
+		uint8_t bits_for = cpa_bits_for(max_for), bits_delta = cpa_bits_for(max_delta);
+
+		ca->firsts[b] = x[0];
+		ca->dir[b].delta = bits_delta < bits_for;
+		ca->dir[b].bits = ca->dir[b].delta ? bits_delta : bits_for;
+		ca->dir[b].offset = ca->words;
+		ca->words += CPA_LANES * (size_t)ca->dir[b].bits;
+	}
+
+	// Memory allocation: packed data, padded to the alignment
+	size_t bytes = (sizeof(uint32_t) * ca->words + CPA_ALIGN - 1) / CPA_ALIGN * CPA_ALIGN;
+	ca->packed = (uint32_t*) aligned_alloc(CPA_ALIGN, bytes ? bytes : CPA_ALIGN);
+	if (!ca->packed) {
+		printf("Memory allocation failed: couldn't allocate %zu packed words\n", ca->words);
+		exit(1);
+	}
+
+	// Second pass: pack the residuals (the tail of the last block repeats its last value)
+	for (size_t b = 0; b < ca->nblocks; b++) {
+		const int* x = values + b * CPA_BLOCK;
+		size_t count = cpa_block_count(ca, b);
+		int padded[CPA_BLOCK];
+		for (size_t i = 0; i < CPA_BLOCK; i++) padded[i] = x[i < count ? i : count - 1];
+
+		uint32_t* res = ca->dir[b].delta ? res_delta : res_for;
+		for (size_t i = 0; i < CPA_BLOCK; i++) {
+			uint32_t prev = (uint32_t)(ca->dir[b].delta && i >= CPA_LANES ? padded[i - CPA_LANES] : padded[0]);
+			res[i] = (uint32_t)padded[i] - prev;
+		}
+		cpa_pack(res, ca->dir[b].bits, ca->packed + ca->dir[b].offset);
+	}
+	return ca;
+}
+
+
+static_array* cpa_to_array(const compressed_array* ca) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("cpa_to_array: NULL compressed array pointer\n");
+		return NULL;
+	}
+
+	static_array* arr = sa_create_array(ca->size ? ca->size : 1);
+	int block[CPA_BLOCK];
+	for (size_t b = 0; b < ca->nblocks; b++) {
+		size_t count = cpa_decode_block(ca, b, block);
+		for (size_t i = 0; i < count; i++) sa_insert_last(arr, block[i]);
+	}
+	return arr;
+}
+
+
+int cpa_get_element(const compressed_array* ca, size_t index) {
+	// Validate input parameters: ca and index
+	if (!ca || index >= ca->size) {
+		printf("cpa_get_element: index %zu out of range\n", index);
+		return -1;
+	}
+
+	size_t b = index / CPA_BLOCK, r = index % CPA_BLOCK;
+	size_t j = r % CPA_LANES, v = r / CPA_LANES;
+	const cpa_block* d = &ca->dir[b];
+	const uint32_t* in = ca->packed + d->offset;
+
+	// Frame of reference: one residual; delta: the residuals of the lane up to this one
+	uint32_t val = (uint32_t)ca->firsts[b];
+	if (!d->delta) return (int)(val + cpa_extract(in, d->bits, j, v));
+	for (size_t u = 0; u <= v; u++) val += cpa_extract(in, d->bits, j, u);
+	return (int)val;
+}
+
+
+size_t cpa_decode_block(const compressed_array* ca, size_t block, int* out) {
+	// Validate input parameters: ca, block and out
+	if (!ca || !out || block >= ca->nblocks) {
+		printf("cpa_decode_block: block %zu out of range or NULL pointer\n", block);
+		return 0;
+	}
+
+	cpa_decode_full(ca, block, out);
+	return cpa_block_count(ca, block);
+}
+
+
+size_t cpa_decode(const compressed_array* ca, int* out) {
+	// Validate input parameters: ca and out
+	if (!ca || !out) {
+		printf("cpa_decode: NULL pointer\n");
+		return 0;
+	}
+
+	// Full blocks straight into out, the last partial block through a scratch block
+	size_t full = ca->size / CPA_BLOCK;
+	for (size_t b = 0; b < full; b++) cpa_decode_full(ca, b, out + b * CPA_BLOCK);
+	if (full < ca->nblocks) {
+		int block[CPA_BLOCK];
+		cpa_decode_full(ca, full, block);
+		memcpy(out + full * CPA_BLOCK, block, sizeof(int) * cpa_block_count(ca, full));
+	}
+	return ca->size;
+}
+
+
+size_t cpa_lower_bound(const compressed_array* ca, int key) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("cpa_lower_bound: NULL compressed array pointer\n");
+		return 0;
+	}
+
+	// First block whose first value is >= key; the answer is in the block before it or at its start
+	size_t lo = 0, hi = ca->nblocks;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (ca->firsts[mid] < key) lo = mid + 1;
+		else hi = mid;
+	}
+	if (lo == 0) return 0;
+
+	// Sorted block: the position is the number of values < key (branch-free count)
+	int block[CPA_BLOCK];
+	size_t b = lo - 1;
+	size_t count = cpa_decode_block(ca, b, block);
+	size_t below = 0;
+	for (size_t i = 0; i < count; i++) below += block[i] < key;
+	return b * CPA_BLOCK + below;
+}
+
+
+int cpa_find_val(const compressed_array* ca, int val) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("cpa_find_val: NULL compressed array pointer\n");
+		return -1;
+	}
+
+	size_t idx = cpa_lower_bound(ca, val);
+	if (idx < ca->size && cpa_get_element(ca, idx) == val) return (int)idx;
+	return -1;
+}
+
+
+size_t cpa_size(const compressed_array* ca) {
+	return ca ? ca->size : 0;
+}
+
+
+size_t cpa_blocks(const compressed_array* ca) {
+	return ca ? ca->nblocks : 0;
+}
+
+
+size_t cpa_bytes(const compressed_array* ca) {
+	if (!ca) return 0;
+	return sizeof(compressed_array) + sizeof(uint32_t) * ca->words + (sizeof(int) + sizeof(cpa_block)) * ca->nblocks;
+}
+
+
+void cpa_free(compressed_array* ca) {
+	// Validate input parameter: ca
+	if (!ca) return;
+
+	free(ca->packed);
+	free(ca->firsts);
+	free(ca->dir);
+	free(ca);
+}
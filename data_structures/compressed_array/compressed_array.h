@@ -0,0 +1,66 @@
+#ifndef DSA_COMPRESSED_ARRAY_H
+#define DSA_COMPRESSED_ARRAY_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Read-only compressed array of sorted (non-decreasing) ints, built from a static_array.
+* Values are cut into blocks of CPA_BLOCK = 128. Each block stores its residuals with the fewest bits
+* that fit, choosing per block between frame-of-reference (value - first value of the block) and
+* delta coding (value - value 4 positions earlier). Residuals are bit-packed in 4 interleaved 32-bit
+* lanes, so SSE2 decodes 4 values per instruction and undoes the deltas with one vector add per step.
+*
+* A block directory (first value, bit width, coding, word offset) gives random access to any block:
+* cpa_get unpacks a single value, cpa_lower_bound binary searches the first values of the blocks
+* and decodes one block. Dense IDs need 1-2 bits per value instead of 32.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+#define CPA_BLOCK 128
+
+typedef struct compressed_array compressed_array;
+
+// Compress the elements of src, which must be sorted in non-decreasing order (NULL with a message otherwise)
+compressed_array* cpa_create_from_array(static_array* src);
+
+// Decompress into a new static_array of capacity max(size, 1)
+static_array* cpa_to_array(const compressed_array* ca);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get specific element (-1 with a message if index is out of range)
+int cpa_get_element(const compressed_array* ca, size_t index);
+
+// Decode block `block` into out (room for CPA_BLOCK ints). Returns the no. of values written (0 on error)
+size_t cpa_decode_block(const compressed_array* ca, size_t block, int* out);
+
+// Decode every element into out (room for cpa_size ints). Returns the no. of values written
+size_t cpa_decode(const compressed_array* ca, int* out);
+
+// Index of the first element >= key (cpa_size if there is none)
+size_t cpa_lower_bound(const compressed_array* ca, int key);
+
+// Find specific element - returns index of its first occurrence (-1 if element not found)
+int cpa_find_val(const compressed_array* ca, int val);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of elements
+size_t cpa_size(const compressed_array* ca);
+
+// Get the no. of blocks
+size_t cpa_blocks(const compressed_array* ca);
+
+// Bytes used by the packed data and the block directory
+size_t cpa_bytes(const compressed_array* ca);
+
+// Delete the compressed array
+void cpa_free(compressed_array* ca);
+
+
+#endif /* DSA_COMPRESSED_ARRAY_H */
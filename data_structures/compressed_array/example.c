@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include "compressed_array.h"
+
+int main(void) {
+
+    printf("\n\n============================| COMPRESSED ARRAY EXAMPLE |============================\n\n");
+
+    // Sorted IDs with small gaps
+    static_array* ids = sa_create_array(1000);
+    int id = 5000;
+    for (int i = 0; i < 1000; i++) {
+        sa_insert_last(ids, id);
+        id += 1 + (i % 7 == 0 ? 3 : 0);
+    }
+
+    compressed_array* ca = cpa_create_from_array(ids);
+    printf("Elements: %zu in %zu blocks\n", cpa_size(ca), cpa_blocks(ca));
+    printf("Compressed: %zu bytes (plain: %zu bytes)\n", cpa_bytes(ca), sizeof(int) * cpa_size(ca));
+
+    // Random access and search without decompressing everything
+    printf("Element 0: %d, element 500: %d, element 999: %d\n",
+           cpa_get_element(ca, 0), cpa_get_element(ca, 500), cpa_get_element(ca, 999));
+    printf("Index of %d: %d\n", sa_get_element(ids, 321), cpa_find_val(ca, sa_get_element(ids, 321)));
+    printf("Index of 4999 (absent): %d\n", cpa_find_val(ca, 4999));
+    printf("Lower bound of 5500: %zu\n", cpa_lower_bound(ca, 5500));
+
+    // Decode one block
+    int block[CPA_BLOCK];
+    size_t count = cpa_decode_block(ca, 7, block);
+    printf("Block 7 holds %zu values: %d .. %d\n", count, block[0], block[count - 1]);
+
+    // Back to a static_array
+    static_array* back = cpa_to_array(ca);
+    printf("Decompressed size: %zu, last element: %d\n", sa_size(back), sa_get_last(back));
+
+    // Unsorted input is rejected
+    static_array* unsorted = sa_create_array(3);
+    sa_insert_last(unsorted, 3);
+    sa_insert_last(unsorted, 1);
+    sa_insert_last(unsorted, 2);
+    compressed_array* bad = cpa_create_from_array(unsorted);
+    printf("Unsorted input gives %s\n", bad ? "an array" : "NULL");
+
+    cpa_free(ca);
+    sa_free(ids);
+    sa_free(back);
+    sa_free(unsorted);
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+Read scaling of a shared static_array: one big mutex vs a pthread rwlock vs concurrent_array.
+
+    Build: gcc -O2 -pthread benchmark.c concurrent_array.c ../arrays/static_array.c -o ca_bench
+    Usage: ./ca_bench [max_threads=8] [ops_per_thread=2000000]
+
+Every thread runs ops_per_thread operations on a 1M-element array: a random-index write
+(sa_modify_at / ca_set) with probability 0%, 1% or 10%, otherwise a random-index read
+(sa_get_element / ca_get). Thread counts go 1, 2, 4, ... max_threads. Prints total Mops/s.
+Every value ever written encodes its index, so each read is checked to come from the right slot;
+the last column reports "ok" if all reads passed.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include "concurrent_array.h"
+#include "../arrays/static_array.h"
+
+#define ELEMENTS (1 << 20)
+#define INDEX_MASK (ELEMENTS - 1)
+
+typedef enum { GUARD_MUTEX, GUARD_RWLOCK, GUARD_CONCURRENT } guard_kind;
+static const char* guard_names[] = { "mutex", "rwlock", "concurrent" };
+
+typedef struct {
+    guard_kind kind;
+    static_array* arr;
+    concurrent_array* ca;
+    pthread_mutex_t* mutex;
+    pthread_rwlock_t* rwlock;
+    size_t ops;
+    int write_pct;
+    uint64_t seed;
+    int ok;
+} worker_args;
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static inline uint64_t next_random(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1Dull;
+}
+
+static void* worker(void* p) {
+    worker_args* a = (worker_args*) p;
+    uint64_t rng = a->seed;
+    for (size_t i = 0; i < a->ops; i++) {
+        uint64_t r = next_random(&rng);
+        size_t index = (size_t)(r & INDEX_MASK);
+        int write = (int)((r >> 32) % 100) < a->write_pct;
+        int version = (int)((r >> 40) & 0x3FF);
+        int val = (version << 20) | (int)index;   // Low 20 bits always name the slot
+
+        if (write) {
+            switch (a->kind) {
+                case GUARD_MUTEX:
+                    pthread_mutex_lock(a->mutex);
+                    sa_modify_at(a->arr, index, val);
+                    pthread_mutex_unlock(a->mutex);
+                    break;
+                case GUARD_RWLOCK:
+                    pthread_rwlock_wrlock(a->rwlock);
+                    sa_modify_at(a->arr, index, val);
+                    pthread_rwlock_unlock(a->rwlock);
+                    break;
+                default:
+                    ca_set(a->ca, index, val);
+            }
+            continue;
+        }
+
+        int got = 0;
+        switch (a->kind) {
+            case GUARD_MUTEX:
+                pthread_mutex_lock(a->mutex);
+                got = sa_get_element(a->arr, index);
+                pthread_mutex_unlock(a->mutex);
+                break;
+            case GUARD_RWLOCK:
+                pthread_rwlock_rdlock(a->rwlock);
+                got = sa_get_element(a->arr, index);
+                pthread_rwlock_unlock(a->rwlock);
+                break;
+            default:
+                ca_get(a->ca, index, &got);
+        }
+        if ((size_t)(got & INDEX_MASK) != index) a->ok = 0;
+    }
+    return NULL;
+}
+
+static void run(guard_kind kind, int threads, int write_pct, size_t ops) {
+    static_array* arr = sa_create_array(ELEMENTS);
+    for (int i = 0; i < ELEMENTS; i++) sa_insert_last(arr, i);
+    concurrent_array* ca = kind == GUARD_CONCURRENT ? ca_create_from_array(arr, 64) : NULL;
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+
+    pthread_t* tids = (pthread_t*) malloc(sizeof(pthread_t) * (size_t)threads);
+    worker_args* args = (worker_args*) malloc(sizeof(worker_args) * (size_t)threads);
+    if (!tids || !args) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    double t0 = now_seconds();
+    for (int i = 0; i < threads; i++) {
+        worker_args a = { kind, arr, ca, &mutex, &rwlock, ops, write_pct,
+                          0x9E3779B97F4A7C15ull * (uint64_t)(i + 1), 1 };
+        args[i] = a;
+        pthread_create(&tids[i], NULL, worker, &args[i]);
+    }
+    int ok = 1;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        if (!args[i].ok) ok = 0;
+    }
+    double secs = now_seconds() - t0;
+
+    printf("%-11s %7d %6d%% %12.2f   %s\n", guard_names[kind], threads, write_pct,
+           (double)ops * threads / secs / 1e6, ok ? "ok" : "FAILED");
+
+    free(tids);
+    free(args);
+    ca_free(ca);
+    sa_free(arr);
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    size_t ops = argc > 2 ? strtoull(argv[2], NULL, 10) : 2000000;
+    if (max_threads < 1 || ops == 0) {
+        printf("Usage: %s [max_threads >= 1] [ops_per_thread > 0]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-11s %7s %7s %12s\n", "guard", "threads", "writes", "Mops/s");
+    const int write_pcts[] = { 0, 1, 10 };
+    for (size_t w = 0; w < sizeof(write_pcts) / sizeof(write_pcts[0]); w++) {
+        for (int t = 1; t <= max_threads; t *= 2) {
+            for (int kind = GUARD_MUTEX; kind <= GUARD_CONCURRENT; kind++) run((guard_kind)kind, t, write_pcts[w], ops);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,386 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "concurrent_array.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define CA_CACHE_LINE 64
+#define CA_DEFAULT_REGIONS 16
+#define CA_SPINS_BEFORE_YIELD 64
+#define CA_SNAPSHOT_RETRIES 8     // Optimistic ca_find_val attempts before it locks out the writers
+
+/*
+* Sequence lock protocol, per region:
+*   writer: lock mutex, seq += 1 (odd), release fence, modify, seq += 1 (even, release store), unlock
+*   reader: s1 = seq (acquire), skip if odd, read, acquire fence, retry unless seq == s1
+* Sequences only grow, so "every region unchanged" equals "sum of all sequences unchanged",
+* which lets ca_find_val validate a whole-array snapshot without storing one value per region.
+*
+* Elements are read and written with relaxed atomic loads and stores (the sequences order them), so
+* readers never race with a writer. Writers validate against the published size and keep the wrapped
+* array's size in sync with sa_set_size; the size only changes under the last region's lock.
+*/
+
+typedef struct ca_region {
+	_Alignas(CA_CACHE_LINE) _Atomic size_t seq;   // Odd while a writer is inside the region
+	pthread_mutex_t lock;                          // Serializes the writers of the region
+} ca_region;
+
+typedef struct concurrent_array {
+	static_array* arr;
+	int* data;                 // sa_data(arr); the buffer never moves
+	_Atomic size_t size;       // sa_size(arr), published for the readers and the writers
+	size_t region_len;         // Indices per region
+	size_t nregions;
+	ca_region* regions;        // One cache line per region
+} concurrent_array;
+
+
+static inline size_t ca_region_of(const concurrent_array* ca, size_t index) {
+	size_t r = index / ca->region_len;
+	return r < ca->nregions ? r : ca->nregions - 1;
+}
+
+static inline void ca_backoff(int* spins) {
+	if (++*spins >= CA_SPINS_BEFORE_YIELD) {
+		*spins = 0;
+		sched_yield();
+	}
+}
+
+static inline int ca_load(const concurrent_array* ca, size_t index) {
+	return __atomic_load_n(&ca->data[index], __ATOMIC_RELAXED);
+}
+
+static inline void ca_store(concurrent_array* ca, size_t index, int val) {
+	__atomic_store_n(&ca->data[index], val, __ATOMIC_RELAXED);
+}
+
+static inline size_t ca_load_size(const concurrent_array* ca) {
+	return atomic_load_explicit(&ca->size, memory_order_relaxed);
+}
+
+// New size, set while holding the last region (published to readers by ca_write_end)
+static inline void ca_store_size(concurrent_array* ca, size_t size) {
+	sa_set_size(ca->arr, size);
+	atomic_store_explicit(&ca->size, size, memory_order_relaxed);
+}
+
+// Enter regions first..last as a writer (mutexes in increasing order, then the odd sequence)
+static void ca_write_begin(concurrent_array* ca, size_t first, size_t last) {
+	for (size_t r = first; r <= last; r++) pthread_mutex_lock(&ca->regions[r].lock);
+	for (size_t r = first; r <= last; r++) {
+		size_t s = atomic_load_explicit(&ca->regions[r].seq, memory_order_relaxed);
+		atomic_store_explicit(&ca->regions[r].seq, s + 1, memory_order_relaxed);
+	}
+	atomic_thread_fence(memory_order_release);
+}
+
+// Publish the writes: even sequences, unlock
+static void ca_write_end(concurrent_array* ca, size_t first, size_t last) {
+	for (size_t r = first; r <= last; r++) {
+		size_t s = atomic_load_explicit(&ca->regions[r].seq, memory_order_relaxed);
+		atomic_store_explicit(&ca->regions[r].seq, s + 1, memory_order_release);
+	}
+	for (size_t r = last + 1; r-- > first; ) pthread_mutex_unlock(&ca->regions[r].lock);
+}
+
+/*
+* Lock the regions from the one holding the current end (size + offset) to the last region.
+* The size can only change under the last region's lock, so once we hold it the size is stable;
+* if it dropped into an earlier region while we were waiting, start over from there.
+*/
+static size_t ca_write_begin_at_end(concurrent_array* ca, long offset) {
+	for (;;) {
+		size_t size = atomic_load_explicit(&ca->size, memory_order_relaxed);
+		size_t end = (offset < 0 && size == 0) ? 0 : size + (size_t)offset;
+		size_t first = ca_region_of(ca, end);
+		ca_write_begin(ca, first, ca->nregions - 1);
+
+		size = ca_load_size(ca);
+		end = (offset < 0 && size == 0) ? 0 : size + (size_t)offset;
+		if (ca_region_of(ca, end) >= first) return first;
+		ca_write_end(ca, first, ca->nregions - 1);
+	}
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+concurrent_array* ca_create(size_t capacity, size_t regions) {
+	// Validate input parameter: capacity
+	if (capacity == 0) {
+		printf("Requested capacity must be > 0\n");
+		return NULL;
+	}
+	if (regions == 0) regions = CA_DEFAULT_REGIONS;
+	if (regions > capacity) regions = capacity;
+
+	// Memory allocation: concurrent_array struct
+	concurrent_array* ca = (concurrent_array*) malloc(sizeof(concurrent_array));
+	if (!ca) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct concurrent_array!\n");
+		exit(1);
+	}
+
+	ca->arr = sa_create_array(capacity);
+	ca->data = sa_data(ca->arr);
+	atomic_init(&ca->size, 0);
+	ca->region_len = (capacity + regions - 1) / regions;
+	ca->nregions = (capacity + ca->region_len - 1) / ca->region_len;
+
+	// Memory allocation: ca->regions, one cache line each
+	ca->regions = (ca_region*) aligned_alloc(CA_CACHE_LINE, ca->nregions * sizeof(ca_region));
+	if (!ca->regions) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu regions\n", ca->nregions);
+		exit(1);
+	}
+	for (size_t r = 0; r < ca->nregions; r++) {
+		atomic_init(&ca->regions[r].seq, 0);
+		pthread_mutex_init(&ca->regions[r].lock, NULL);
+	}
+	return ca;
+}
+
+
+concurrent_array* ca_create_from_array(static_array* src, size_t regions) {
+	// Validate input parameter: src
+	if (!src) {
+		printf("ca_create_from_array: NULL array pointer\n");
+		return NULL;
+	}
+
+	concurrent_array* ca = ca_create(sa_capacity(src), regions);
+	if (!ca) return NULL;
+	const int* values = sa_const_data(src);
+	for (size_t i = 0; i < sa_size(src); i++) sa_insert_last(ca->arr, values[i]);
+	atomic_store(&ca->size, sa_size(ca->arr));
+	return ca;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Readers
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+int ca_get(concurrent_array* ca, size_t index, int* out) {
+	// Validate input parameters: ca, out and index
+	if (!ca || !out) {
+		printf("ca_get: NULL array or output pointer\n");
+		return -1;
+	}
+	if (index >= sa_capacity(ca->arr)) {
+		printf("ca_get: index out of range (index=%zu)\n", index);
+		return -1;
+	}
+
+	ca_region* reg = &ca->regions[ca_region_of(ca, index)];
+	int spins = 0;
+	for (;;) {
+		size_t s1 = atomic_load_explicit(&reg->seq, memory_order_acquire);
+		if (s1 & 1) {
+			ca_backoff(&spins);
+			continue;
+		}
+		size_t size = atomic_load_explicit(&ca->size, memory_order_relaxed);
+		int val = ca_load(ca, index);
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&reg->seq, memory_order_relaxed) != s1) {
+			ca_backoff(&spins);
+			continue;
+		}
+
+		if (index >= size) {
+			printf("ca_get: index out of range (index=%zu, size=%zu)\n", index, size);
+			return -1;
+		}
+		*out = val;
+		return 0;
+	}
+}
+
+
+// Sum of all region sequences, or (size_t)-1 if a writer is inside some region
+static size_t ca_seq_sum(concurrent_array* ca) {
+	size_t sum = 0;
+	for (size_t r = 0; r < ca->nregions; r++) {
+		size_t s = atomic_load_explicit(&ca->regions[r].seq, memory_order_acquire);
+		if (s & 1) return (size_t)-1;
+		sum += s;
+	}
+	return sum;
+}
+
+int ca_find_val(concurrent_array* ca, int val) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("ca_find_val: NULL array pointer\n");
+		return -1;
+	}
+
+	// Optimistic: scan without locks, keep the answer if no writer touched any region meanwhile
+	for (int attempt = 0; attempt < CA_SNAPSHOT_RETRIES; attempt++) {
+		size_t before = ca_seq_sum(ca);
+		if (before == (size_t)-1) {
+			sched_yield();
+			continue;
+		}
+		size_t size = atomic_load_explicit(&ca->size, memory_order_relaxed);
+		int found = -1;
+		for (size_t i = 0; i < size; i++) {
+			if (ca_load(ca, i) == val) {
+				found = (int)i;
+				break;
+			}
+		}
+		atomic_thread_fence(memory_order_acquire);
+		if (ca_seq_sum(ca) == before) return found;
+	}
+
+	// Writers kept interfering: hold every region's mutex (readers are not blocked) and scan
+	for (size_t r = 0; r < ca->nregions; r++) pthread_mutex_lock(&ca->regions[r].lock);
+	int found = sa_find_val(ca->arr, val);
+	for (size_t r = ca->nregions; r-- > 0; ) pthread_mutex_unlock(&ca->regions[r].lock);
+	return found;
+}
+
+
+size_t ca_size(concurrent_array* ca) {
+	return ca ? atomic_load_explicit(&ca->size, memory_order_relaxed) : 0;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Writers
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+int ca_set(concurrent_array* ca, size_t index, int val) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("ca_set: NULL array pointer\n");
+		return -1;
+	}
+
+	// The size can't drop below an index of this region while we hold it
+	size_t r = ca_region_of(ca, index);
+	ca_write_begin(ca, r, r);
+	size_t size = ca_load_size(ca);
+	int rc = -1;
+	if (index < size) {
+		ca_store(ca, index, val);
+		rc = 0;
+	}
+	ca_write_end(ca, r, r);
+	if (rc != 0) printf("ca_set: index out of range (index=%zu, size=%zu)\n", index, size);
+	return rc;
+}
+
+
+int ca_insert_last(concurrent_array* ca, int val) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("ca_insert_last: NULL array pointer\n");
+		return -1;
+	}
+
+	size_t first = ca_write_begin_at_end(ca, 0);
+	size_t size = ca_load_size(ca);
+	int rc = -1;
+	if (size < sa_capacity(ca->arr)) {
+		ca_store(ca, size, val);
+		ca_store_size(ca, size + 1);
+		rc = 0;
+	}
+	ca_write_end(ca, first, ca->nregions - 1);
+	if (rc != 0) printf("ca_insert_last: array is full (capacity=%zu)\n", sa_capacity(ca->arr));
+	return rc;
+}
+
+
+int ca_insert_at(concurrent_array* ca, size_t index, int val) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("ca_insert_at: NULL array pointer\n");
+		return -1;
+	}
+
+	size_t first = ca_region_of(ca, index);
+	ca_write_begin(ca, first, ca->nregions - 1);
+	size_t size = ca_load_size(ca);
+	int rc = -1;
+	if (index <= size && size < sa_capacity(ca->arr)) {
+		// Shift [index, size) one step right, from the end
+		for (size_t i = size; i > index; i--) ca_store(ca, i, ca_load(ca, i - 1));
+		ca_store(ca, index, val);
+		ca_store_size(ca, size + 1);
+		rc = 0;
+	}
+	ca_write_end(ca, first, ca->nregions - 1);
+	if (index > size) printf("ca_insert_at: index out of range (index=%zu, size=%zu)\n", index, size);
+	else if (rc != 0) printf("ca_insert_at: array is full (capacity=%zu)\n", sa_capacity(ca->arr));
+	return rc;
+}
+
+
+int ca_remove_last(concurrent_array* ca) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("ca_remove_last: NULL array pointer\n");
+		return -1;
+	}
+
+	size_t first = ca_write_begin_at_end(ca, -1);
+	size_t size = ca_load_size(ca);
+	if (size > 0) ca_store_size(ca, size - 1);
+	ca_write_end(ca, first, ca->nregions - 1);
+	if (size == 0) {
+		printf("ca_remove_last: array is empty\n");
+		return -1;
+	}
+	return 0;
+}
+
+
+int ca_remove_at(concurrent_array* ca, size_t index) {
+	// Validate input parameter: ca
+	if (!ca) {
+		printf("ca_remove_at: NULL array pointer\n");
+		return -1;
+	}
+
+	size_t first = ca_region_of(ca, index);
+	ca_write_begin(ca, first, ca->nregions - 1);
+	size_t size = ca_load_size(ca);
+	int rc = -1;
+	if (index < size) {
+		// Shift (index, size) one step left
+		for (size_t i = index; i + 1 < size; i++) ca_store(ca, i, ca_load(ca, i + 1));
+		ca_store_size(ca, size - 1);
+		rc = 0;
+	}
+	ca_write_end(ca, first, ca->nregions - 1);
+	if (rc != 0) printf("ca_remove_at: index out of range (index=%zu, size=%zu)\n", index, size);
+	return rc;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+size_t ca_regions(concurrent_array* ca) {
+	return ca ? ca->nregions : 0;
+}
+
+
+void ca_free(concurrent_array* ca) {
+	// Validate input parameter: ca
+	if (!ca) return;
+
+	for (size_t r = 0; r < ca->nregions; r++) pthread_mutex_destroy(&ca->regions[r].lock);
+	free(ca->regions);
+	sa_free(ca->arr);
+	free(ca);
+}
@@ -0,0 +1,70 @@
+#ifndef DSA_CONCURRENT_ARRAY_H
+#define DSA_CONCURRENT_ARRAY_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Thread-safe wrapper around one static_array, for many reader threads and occasional writers.
+* The index range is split into regions (shards); every region has a sequence lock for readers
+* and a mutex that serializes its writers.
+*   - Reads take no lock: they retry if a writer changed the region meanwhile, so readers never
+*     block each other or the writers.
+*   - ca_set locks only the region of its index, so writers to different regions run in parallel.
+*   - Operations that shift elements or change the size lock every region from the affected index
+*     to the end (always in increasing order, so writers cannot deadlock).
+* Calls mirror the sa_* functions they wrap and return the same status codes.
+*/
+
+typedef struct concurrent_array concurrent_array;
+
+// Create an empty array of `capacity` elements split into `regions` shards (0 -> 16, clamped to capacity)
+concurrent_array* ca_create(size_t capacity, size_t regions);
+
+// Create a concurrent copy of src (same capacity and elements)
+concurrent_array* ca_create_from_array(static_array* src, size_t regions);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Readers (lock-free)
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Read the element at index into *out - returns 0 on success else -1 (out of range)
+int ca_get(concurrent_array* ca, size_t index, int* out);
+
+// Index of the first occurrence of val in a consistent snapshot, or -1
+int ca_find_val(concurrent_array* ca, int val);
+
+// Get the current no. of elements
+size_t ca_size(concurrent_array* ca);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Writers
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// sa_modify_at: locks one region
+int ca_set(concurrent_array* ca, size_t index, int val);
+
+// sa_insert_last: locks the last regions only
+int ca_insert_last(concurrent_array* ca, int val);
+
+// sa_insert_at: locks the regions from index to the end
+int ca_insert_at(concurrent_array* ca, size_t index, int val);
+
+// sa_remove_last: locks the last regions only
+int ca_remove_last(concurrent_array* ca);
+
+// sa_remove_at: locks the regions from index to the end
+int ca_remove_at(concurrent_array* ca, size_t index);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of regions
+size_t ca_regions(concurrent_array* ca);
+
+// Delete the array (no thread may be using it)
+void ca_free(concurrent_array* ca);
+
+
+#endif /* DSA_CONCURRENT_ARRAY_H */
@@ -0,0 +1,52 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <pthread.h>
+#include "concurrent_array.h"
+#include "../arrays/static_array.h"
+
+#define READS 200000
+
+// Reader thread: sums element 0..size-1 over and over while the main thread writes
+static void* reader(void* arg) {
+    concurrent_array* ca = (concurrent_array*) arg;
+    long long sum = 0;
+    int v;
+    for (int i = 0; i < READS; i++) {
+        if (ca_get(ca, (size_t)i % 8, &v) == 0) sum += v;
+    }
+    printf("Reader finished, sum of values read: %lld\n", sum);
+    return NULL;
+}
+
+int main(void) {
+
+    printf("\n\n============================| CONCURRENT ARRAY EXAMPLE |============================\n\n");
+
+    // Copy an existing static_array into a concurrent one with 4 regions
+    static_array* arr = sa_create_array(16);
+    for (int i = 1; i <= 8; i++) sa_insert_last(arr, i * 10);
+    concurrent_array* ca = ca_create_from_array(arr, 4);
+    printf("Concurrent copy: size=%zu, regions=%zu\n", ca_size(ca), ca_regions(ca));
+
+    // Two readers run lock-free while this thread updates elements
+    pthread_t t[2];
+    for (int i = 0; i < 2; i++) pthread_create(&t[i], NULL, reader, ca);
+    for (int round = 0; round < 1000; round++) ca_set(ca, (size_t)round % 8, round);
+    for (int i = 0; i < 2; i++) pthread_join(t[i], NULL);
+
+    // Structural changes lock from the affected region to the end
+    ca_insert_at(ca, 2, -5);
+    ca_remove_last(ca);
+    ca_insert_last(ca, 77);
+    int v;
+    printf("After insert_at(2, -5), remove_last, insert_last(77):");
+    for (size_t i = 0; i < ca_size(ca); i++) {
+        if (ca_get(ca, i, &v) == 0) printf(" %d", v);
+    }
+    printf("\nIndex of 77: %d, index of 12345: %d\n", ca_find_val(ca, 77), ca_find_val(ca, 12345));
+
+    ca_free(ca);
+    sa_free(arr);
+    return 0;
+}
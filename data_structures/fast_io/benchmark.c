@@ -0,0 +1,159 @@
+/*
+Text I/O benchmark: fio_write_ints / fio_read_array / sa_display vs printf and scanf per element.
+
+    Build: gcc -O2 -pthread benchmark.c fast_io.c ../arrays/static_array.c -o fio_bench
+    Usage: ./fio_bench [elements=10000000] [dir=/tmp]
+
+For random ints over the full int range and over 0..999, reports MB/s of text for:
+  - write:   fprintf(f, "%d\n") per element vs fio_write_ints(f, ..., '\n')
+  - read:    fscanf(f, "%d") + sa_insert_last per element vs fio_read_array
+  - display: the old sa_display loop (printf per element) vs sa_display, with stdout sent to a file
+Files go to `dir`; both parsers read the same file, and their arrays are compared with the input.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "fast_io.h"
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static double file_mb(const char* path) {
+    struct stat info;
+    return stat(path, &info) == 0 ? (double)info.st_size / 1e6 : 0;
+}
+
+static int same_array(static_array* arr, const int* values, size_t n) {
+    return arr && sa_size(arr) == n && memcmp(sa_const_data(arr), values, n * sizeof(int)) == 0;
+}
+
+// Point stdout at path (returns the saved descriptor) / back at the terminal
+static int redirect_stdout(const char* path) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    dup2(fd, STDOUT_FILENO);
+    close(fd);
+    return saved;
+}
+
+static void restore_stdout(int saved) {
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    const char* dir = argc > 2 ? argv[2] : "/tmp";
+    if (n == 0) {
+        printf("elements must be > 0\n");
+        return 1;
+    }
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/fio_bench.txt", dir);
+
+    static_array* arr = sa_create_array(n);
+    int* values = (int*) malloc(n * sizeof(int));
+    if (!values) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    const char* ranges[] = { "full int", "0..999" };
+    printf("%10s %9s | %9s %9s %8s | %9s %9s %8s | %9s %9s %8s | %6s\n", "values", "text MB",
+           "fprintf", "fio", "speedup", "fscanf", "fio", "speedup", "printf", "sa_disp", "speedup", "check");
+    for (int r = 0; r < 2; r++) {
+        while (sa_size(arr) > 0) sa_remove_last(arr);
+        for (size_t i = 0; i < n; i++) {
+            values[i] = r == 0 ? (int)next_random() : (int)(next_random() % 1000);
+            sa_insert_last(arr, values[i]);
+        }
+
+        // Write
+        double t0 = now_seconds();
+        FILE* f = fopen(path, "w");
+        for (size_t i = 0; f && i < n; i++) fprintf(f, "%d\n", values[i]);
+        if (f) fclose(f);
+        double printf_s = now_seconds() - t0;
+        double mb = file_mb(path);
+
+        t0 = now_seconds();
+        f = fopen(path, "w");
+        int ok = f && fio_write_ints(f, values, n, '\n') == 0;
+        if (f) fclose(f);
+        double fio_write_s = now_seconds() - t0;
+        ok &= file_mb(path) == mb;
+
+        // Read
+        t0 = now_seconds();
+        static_array* scanned = sa_create_array(n);
+        f = fopen(path, "r");
+        int v;
+        while (f && fscanf(f, "%d", &v) == 1) sa_insert_last(scanned, v);
+        if (f) fclose(f);
+        double scanf_s = now_seconds() - t0;
+        ok &= same_array(scanned, values, n);
+        sa_free(scanned);
+
+        t0 = now_seconds();
+        f = fopen(path, "r");
+        static_array* parsed = f ? fio_read_array(f) : NULL;
+        if (f) fclose(f);
+        double fio_read_s = now_seconds() - t0;
+        ok &= same_array(parsed, values, n);
+        sa_free(parsed);
+
+        // Display: the loop sa_display used to run, then sa_display itself
+        int saved = redirect_stdout(path);
+        t0 = now_seconds();
+        printf("[");
+        for (size_t i = 0; i < n; ++i) {
+            printf("%d", values[i]);
+            if (i + 1 < n) printf(", ");
+        }
+        printf("] (size=%zu, capacity=%zu)\n", n, n);
+        fflush(stdout);
+        double old_display_s = now_seconds() - t0;
+        restore_stdout(saved);
+        double display_mb = file_mb(path);
+
+        saved = redirect_stdout(path);
+        t0 = now_seconds();
+        sa_display(arr);
+        fflush(stdout);
+        double display_s = now_seconds() - t0;
+        restore_stdout(saved);
+        ok &= file_mb(path) == display_mb;
+
+        printf("%10s %9.1f | %9.0f %9.0f %7.1fx | %9.0f %9.0f %7.1fx | %9.0f %9.0f %7.1fx | %6s\n", ranges[r], mb,
+               mb / printf_s, mb / fio_write_s, printf_s / fio_write_s,
+               mb / scanf_s, mb / fio_read_s, scanf_s / fio_read_s,
+               display_mb / old_display_s, display_mb / display_s, old_display_s / display_s, ok ? "ok" : "MISMATCH");
+    }
+
+    remove(path);
+    sa_free(arr);
+    free(values);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include "fast_io.h"
+
+int main(void) {
+
+    printf("\n\n============================| FAST I/O EXAMPLE |============================\n\n");
+
+    // Writer on stdout with its own buffer: one fwrite when flushed
+    fio_writer w;
+    fio_writer_init(&w, stdout, NULL, 0);
+    fio_put_str(&w, "Cubes:");
+    for (int i = -3; i <= 3; i++) {
+        fio_put_char(&w, ' ');
+        fio_put_int(&w, i * i * i);
+    }
+    fio_put_char(&w, '\n');
+    fio_writer_flush(&w);
+
+    // Bulk write to a file, then parse it back into a static_array
+    const char* path = "example_ints.txt";
+    int values[] = { 42, -7, 2147483647, -2147483647 - 1, 0, 1000 };
+    FILE* f = fopen(path, "w");
+    fio_write_ints(f, values, 6, '\n');
+    fclose(f);
+
+    f = fopen(path, "r");
+    static_array* arr = fio_read_array(f);
+    fclose(f);
+    printf("Parsed back: ");
+    sa_display(arr);
+
+    // Bad input is reported, nothing is returned
+    f = fopen(path, "w");
+    fputs("1 2 three 4\n", f);
+    fclose(f);
+    f = fopen(path, "r");
+    int* parsed;
+    size_t count;
+    if (fio_read_ints(f, &parsed, &count) != 0) printf("Parse of \"1 2 three 4\" failed as expected\n");
+    fclose(f);
+
+    sa_free(arr);
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include "fast_io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define FIO_WRITE_BUFFER ((size_t)1 << 20)   // Bytes formatted per fwrite by fio_write_ints
+#define FIO_READ_CHUNK ((size_t)1 << 20)     // Bytes per fread by the parsers
+#define FIO_MAX_TOKEN 32                     // Longest token carried over between chunks
+
+
+int fio_write_ints(FILE* out, const int* values, size_t count, char sep) {
+	// Validate input parameters: out and values
+	if (!out || (!values && count > 0)) {
+		printf("fio_write_ints: NULL pointer\n");
+		return -1;
+	}
+
+	// Memory allocation: writer and its large buffer (the writer struct is too big for some thread stacks)
+	fio_writer* w = (fio_writer*) malloc(sizeof(fio_writer));
+	char* buffer = (char*) malloc(FIO_WRITE_BUFFER);
+	if (!w || !buffer) {
+		printf("Memory allocation failed: couldn't allocate the fio_write_ints buffer\n");
+		exit(1);
+	}
+	fio_writer_init(w, out, buffer, FIO_WRITE_BUFFER);
+
+	// Room for a whole int and its separator is checked once per element
+	for (size_t i = 0; i < count; i++) {
+		if (w->cap - w->len < FIO_INT_MAX_CHARS + 1) fio_writer_flush(w);
+		char* p = fio_format_int(w->buf + w->len, values[i]);
+		*p++ = sep;
+		w->len = (size_t)(p - w->buf);
+	}
+	int status = fio_writer_flush(w);
+	if (status != 0) printf("fio_write_ints: write error\n");
+	free(buffer);
+	free(w);
+	return status;
+}
+
+
+static inline int fio_is_space(char c) {
+	return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Append v to the growing array *values (capacity *cap)
+static void fio_append(int** values, size_t* count, size_t* cap, int v) {
+	if (*count == *cap) {
+		*cap = *cap ? *cap * 2 : 4096;
+		int* grown = (int*) realloc(*values, sizeof(int) * *cap);
+		if (!grown) {
+			printf("Memory allocation failed: couldn't grow the parse buffer to %zu integers\n", *cap);
+			exit(1);
+		}
+		*values = grown;
+	}
+	(*values)[(*count)++] = v;
+}
+
+// Parse the complete tokens in buf[0 .. len) - returns 0 on success else -1
+static int fio_parse_tokens(const char* buf, size_t len, int** values, size_t* count, size_t* cap) {
+	const char* p = buf;
+	const char* end = buf + len;
+	for (;;) {
+		while (p < end && fio_is_space(*p)) p++;
+		if (p == end) return 0;
+
+		// Optional sign, then digits; the magnitude saturates above the int range instead of wrapping
+		int negative = *p == '-';
+		if (*p == '-' || *p == '+') p++;
+		const char* digits = p;
+		uint64_t u = 0;
+		for (; p < end && (unsigned)(*p - '0') < 10; p++) {
+			if (u <= INT32_MAX) u = u * 10 + (uint64_t)(*p - '0');
+		}
+		if (p == digits || (p < end && !fio_is_space(*p))) {
+			const char* stop = p;
+			while (stop < end && stop - digits < 16 && !fio_is_space(*stop)) stop++;
+			printf("fio_read_ints: invalid token \"%.*s\"\n", (int)(stop - digits), digits);
+			return -1;
+		}
+		if (u > (negative ? (uint64_t)INT32_MAX + 1 : (uint64_t)INT32_MAX)) {
+			printf("fio_read_ints: value out of int range near \"%.*s\"\n", (int)(p - digits), digits);
+			return -1;
+		}
+		fio_append(values, count, cap, negative ? (int)(0u - (unsigned int)u) : (int)u);
+	}
+}
+
+
+int fio_read_ints(FILE* in, int** values, size_t* count) {
+	// Validate input parameters: in, values and count
+	if (!in || !values || !count) {
+		printf("fio_read_ints: NULL pointer\n");
+		return -1;
+	}
+	*values = NULL;
+	*count = 0;
+
+	// Memory allocation: read chunk plus room for a token carried over from the previous chunk
+	char* buf = (char*) malloc(FIO_READ_CHUNK + FIO_MAX_TOKEN);
+	if (!buf) {
+		printf("Memory allocation failed: couldn't allocate the fio_read_ints buffer\n");
+		exit(1);
+	}
+
+	// Every chunk is parsed up to its last whitespace; the unfinished token moves to the front
+	size_t cap = 0, carry = 0;
+	int status = 0;
+	for (;;) {
+		size_t got = fread(buf + carry, 1, FIO_READ_CHUNK, in);
+		size_t len = carry + got;
+		int at_end = got < FIO_READ_CHUNK;
+		size_t cut = len;
+		if (!at_end) {
+			while (cut > 0 && !fio_is_space(buf[cut - 1])) cut--;
+			if (len - cut > FIO_MAX_TOKEN) {
+				printf("fio_read_ints: token longer than %d characters\n", FIO_MAX_TOKEN);
+				status = -1;
+				break;
+			}
+		}
+		if (fio_parse_tokens(buf, cut, values, count, &cap) != 0) {
+			status = -1;
+			break;
+		}
+		if (at_end) break;
+		carry = len - cut;
+		memmove(buf, buf + cut, carry);
+	}
+	if (status == 0 && ferror(in)) {
+		printf("fio_read_ints: read error\n");
+		status = -1;
+	}
+	free(buf);
+
+	if (status != 0) {
+		free(*values);
+		*values = NULL;
+		*count = 0;
+	}
+	return status;
+}
+
+
+static_array* fio_read_array(FILE* in) {
+	int* values;
+	size_t count;
+	if (fio_read_ints(in, &values, &count) != 0) return NULL;
+
+	// Trim the parse buffer to the array's capacity and hand it over
+	size_t capacity = count > 0 ? count : 1;
+	const dsa_allocator* libc = dsa_default_allocator();
+	int* buffer = (int*) libc->realloc(libc->ctx, values, 0, sizeof(int) * capacity);
+	if (!buffer) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu integers in the array\n", capacity);
+		exit(1);
+	}
+	return sa_create_array_from_buffer(buffer, capacity, count, libc);
+}
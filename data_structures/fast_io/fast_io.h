@@ -0,0 +1,141 @@
+#ifndef DSA_FAST_IO_H
+#define DSA_FAST_IO_H
+
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Fast text output and input of ints, replacing one printf / scanf call per element.
+*
+* Output (header-only, so any container can use it without linking fast_io.c):
+*   fio_writer collects formatted text in a buffer - the caller's, or one inside the writer - and hands
+*   every full buffer to fwrite in one call. Ints are formatted two digits at a time from a table of
+*   the 100 digit pairs, so there is no format string parsing and no per-element stdio locking.
+*
+* Bulk functions (fast_io.c):
+*   fio_write_ints       - format an array with a separator through a 1 MB writer buffer
+*   fio_read_ints        - parse whitespace-separated ints (spaces, tabs, newlines) from a file or stdin
+*                          in large chunks into a growing buffer
+*   fio_read_array       - the same, straight into a static_array sized to what was read
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+#define FIO_INT_MAX_CHARS 11        // "-2147483648"
+#define FIO_LOCAL_BUFFER 16384      // Bytes of the buffer inside a writer (used when no buffer is supplied)
+
+typedef struct fio_writer {
+	FILE* out;
+	char* buf;
+	size_t cap;
+	size_t len;
+	int error;                      // Set once a write failed; later output is dropped
+	char local[FIO_LOCAL_BUFFER];
+} fio_writer;
+
+// "00" "01" ... "99"
+static const char fio_digit_pairs[201] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+// No. of decimal digits of u
+static inline int fio_digit_count(unsigned int u) {
+	int n = 1;
+	while (u >= 10000) {
+		u /= 10000;
+		n += 4;
+	}
+	return n + (u >= 10) + (u >= 100) + (u >= 1000);
+}
+
+// Format v in decimal at p (room for FIO_INT_MAX_CHARS needed), returns the end of the text
+static inline char* fio_format_int(char* p, int v) {
+	unsigned int u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+	if (v < 0) *p++ = '-';
+
+	// Digits are written last pair first, straight into place
+	char* end = p + fio_digit_count(u);
+	char* t = end;
+	while (u >= 100) {
+		unsigned int pair = (u % 100) * 2;
+		u /= 100;
+		t -= 2;
+		memcpy(t, &fio_digit_pairs[pair], 2);
+	}
+	if (u >= 10) memcpy(t - 2, &fio_digit_pairs[u * 2], 2);
+	else t[-1] = (char)('0' + u);
+	return end;
+}
+
+// Start a writer on out. buffer == NULL (or size too small for one int) uses the writer's own buffer
+static inline void fio_writer_init(fio_writer* w, FILE* out, char* buffer, size_t size) {
+	w->out = out;
+	w->len = 0;
+	w->error = 0;
+	if (buffer && size >= 4 * FIO_INT_MAX_CHARS) {
+		w->buf = buffer;
+		w->cap = size;
+	} else {
+		w->buf = w->local;
+		w->cap = sizeof(w->local);
+	}
+}
+
+// Write the buffered text with one fwrite - returns 0 on success else -1 (also for any earlier failure)
+static inline int fio_writer_flush(fio_writer* w) {
+	if (w->len > 0 && !w->error && fwrite(w->buf, 1, w->len, w->out) != w->len) w->error = 1;
+	w->len = 0;
+	return w->error ? -1 : 0;
+}
+
+// Append n bytes of text
+static inline void fio_put_bytes(fio_writer* w, const char* s, size_t n) {
+	while (n > 0) {
+		if (w->len == w->cap) fio_writer_flush(w);
+		size_t room = w->cap - w->len;
+		size_t k = n < room ? n : room;
+		memcpy(w->buf + w->len, s, k);
+		w->len += k;
+		s += k;
+		n -= k;
+	}
+}
+
+// Append a string
+static inline void fio_put_str(fio_writer* w, const char* s) {
+	fio_put_bytes(w, s, strlen(s));
+}
+
+// Append one character
+static inline void fio_put_char(fio_writer* w, char c) {
+	if (w->len == w->cap) fio_writer_flush(w);
+	w->buf[w->len++] = c;
+}
+
+// Append an int in decimal
+static inline void fio_put_int(fio_writer* w, int v) {
+	if (w->cap - w->len < FIO_INT_MAX_CHARS) fio_writer_flush(w);
+	w->len = (size_t)(fio_format_int(w->buf + w->len, v) - w->buf);
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Write count ints to out, each followed by sep (e.g. ' ' or '\n') - returns 0 on success else -1
+int fio_write_ints(FILE* out, const int* values, size_t count, char sep);
+
+// Read whitespace-separated ints from in until end of file. *values receives a malloc'd array (free it with
+// free, NULL if nothing was read) and *count its length - returns 0 on success else -1 (bad token, int overflow)
+int fio_read_ints(FILE* in, int** values, size_t* count);
+
+// Read whitespace-separated ints from in until end of file into a new static_array with capacity = count
+// (at least 1) - returns NULL on error
+static_array* fio_read_array(FILE* in);
+
+
+#endif /* DSA_FAST_IO_H */
@@ -0,0 +1,161 @@
+/*
+Range-sum benchmark: Fenwick tree vs rescanning the static_array.
+
+    Build: gcc -O2 benchmark.c fenwick_tree.c ../arrays/static_array.c -o fenwick_bench
+    Usage: ./fenwick_bench [max_elements=10000000]
+
+For n = 1K, 10K, ... up to max_elements random ints it measures
+    build  : fw_create_from_array (ms)
+    update : sa_modify_at + fw_set vs sa_modify_at alone (ns per update)
+    query  : fw_range_sum vs summing the range from sa_data (ns per query, random ranges)
+    mixed  : 50% point updates, 50% range sums (ns per operation)
+The rescans get a bounded budget of element visits per size. Both sides return the same sums,
+checked in the last column.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "fenwick_tree.h"
+#include "../arrays/static_array.h"
+
+#define OPS            1000000
+#define SCAN_BUDGET    300000000ull   // Element visits allowed for one rescan measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static long long scan_sum(static_array* arr, size_t lo, size_t hi) {
+    const int* d = sa_data(arr);
+    long long sum = 0;
+    for (size_t i = lo; i <= hi; i++) sum += d[i];
+    return sum;
+}
+
+// Random inclusive range [*lo, *hi] in [0, n)
+static void random_range(size_t n, size_t* lo, size_t* hi) {
+    size_t a = next_random() % n, b = next_random() % n;
+    *lo = a < b ? a : b;
+    *hi = a < b ? b : a;
+}
+
+static void run(size_t n) {
+    static_array* arr = sa_create_array(n);
+    for (size_t i = 0; i < n; i++) sa_insert_last(arr, (int)(next_random() % 2001) - 1000);
+    int ok = 1;
+
+    // build
+    double t0 = now_seconds();
+    fenwick_tree* fw = fw_create_from_array(arr);
+    double build = (now_seconds() - t0) * 1e3;
+
+    // update
+    t0 = now_seconds();
+    for (size_t i = 0; i < OPS; i++) {
+        size_t idx = next_random() % n;
+        int val = (int)(next_random() % 2001) - 1000;
+        sa_modify_at(arr, idx, val);
+        fw_set(fw, idx, val);
+    }
+    double update_fw = (now_seconds() - t0) * 1e9 / OPS;
+    t0 = now_seconds();
+    for (size_t i = 0; i < OPS; i++) {
+        size_t idx = next_random() % n;
+        sa_modify_at(arr, idx, sa_get_element(arr, idx));
+    }
+    double update_plain = (now_seconds() - t0) * 1e9 / OPS;
+
+    // query: both sides see the same ranges
+    size_t scans = (size_t)(SCAN_BUDGET / (n / 3 + 1));
+    if (scans > OPS) scans = OPS;
+    if (scans == 0) scans = 1;
+    uint64_t saved = rng_state;
+    long long sum_fw = 0, sum_sa = 0;
+    size_t lo, hi;
+    t0 = now_seconds();
+    for (size_t i = 0; i < OPS; i++) {
+        random_range(n, &lo, &hi);
+        long long s = fw_range_sum(fw, lo, hi);
+        if (i < scans) sum_fw += s;
+    }
+    double query_fw = (now_seconds() - t0) * 1e9 / OPS;
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        random_range(n, &lo, &hi);
+        sum_sa += scan_sum(arr, lo, hi);
+    }
+    double query_sa = (now_seconds() - t0) * 1e9 / scans;
+    if (sum_fw != sum_sa) ok = 0;
+
+    // mixed: both sides replay the same stream from the same array contents
+    int* before = (int*) malloc(n * sizeof(int));
+    if (!before) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    memcpy(before, sa_data(arr), n * sizeof(int));
+    saved = rng_state;
+    sum_fw = sum_sa = 0;
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        if (next_random() & 1) {
+            size_t idx = next_random() % n;
+            int val = (int)(next_random() % 2001) - 1000;
+            sa_modify_at(arr, idx, val);
+            fw_set(fw, idx, val);
+        } else {
+            random_range(n, &lo, &hi);
+            sum_fw += fw_range_sum(fw, lo, hi);
+        }
+    }
+    double mixed_fw = (now_seconds() - t0) * 1e9 / scans;
+    memcpy(sa_data(arr), before, n * sizeof(int));
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        if (next_random() & 1) {
+            size_t idx = next_random() % n;
+            int val = (int)(next_random() % 2001) - 1000;
+            sa_modify_at(arr, idx, val);
+        } else {
+            random_range(n, &lo, &hi);
+            sum_sa += scan_sum(arr, lo, hi);
+        }
+    }
+    double mixed_sa = (now_seconds() - t0) * 1e9 / scans;
+    if (sum_fw != sum_sa) ok = 0;
+
+    printf("%10zu | %8.2f | %8.1f %8.1f | %8.1f %12.1f | %8.1f %12.1f | %s\n", n, build,
+           update_fw, update_plain, query_fw, query_sa, mixed_fw, mixed_sa, ok ? "ok" : "MISMATCH");
+
+    free(before);
+    fw_free(fw);
+    sa_free(arr);
+}
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+
+    printf("%10s | %8s | %17s | %21s | %21s |\n", "", "build", "update ns", "range sum ns", "mixed ns");
+    printf("%10s | %8s | %8s %8s | %8s %12s | %8s %12s |\n", "elements", "ms",
+           "fenwick", "array", "fenwick", "rescan", "fenwick", "rescan");
+    for (size_t n = 1000; n <= max_elements; n *= 10) run(n);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <stdio.h>
+#include "fenwick_tree.h"
+#include "../arrays/static_array.h"
+
+int main(void) {
+
+    printf("\n\n============================| FENWICK TREE EXAMPLE |============================\n\n");
+
+    static_array* arr = sa_create_array(8);
+    int values[8] = {5, 3, 7, 9, 6, 4, 1, 2};
+    for (int i = 0; i < 8; i++) sa_insert_last(arr, values[i]);
+    printf("Array: ");
+    sa_display(arr);
+
+    fenwick_tree* fw = fw_create_from_array(arr);
+    printf("Sum of the first 4 elements: %lld\n", fw_prefix_sum(fw, 4));
+    printf("Sum of indices 2..5: %lld\n", fw_range_sum(fw, 2, 5));
+
+    // Keep the tree in step with point updates to the array
+    sa_modify_at(arr, 3, 0);
+    fw_set(fw, 3, 0);
+    fw_add(fw, 0, 10);
+    sa_modify_at(arr, 0, sa_get_element(arr, 0) + 10);
+    printf("After arr[3] = 0 and arr[0] += 10: ");
+    sa_display(arr);
+    printf("Sum of indices 0..3: %lld, element 0: %lld, total: %lld\n",
+           fw_range_sum(fw, 0, 3), fw_get(fw, 0), fw_prefix_sum(fw, fw_size(fw)));
+
+    fw_free(fw);
+    sa_free(arr);
+    return 0;
+}
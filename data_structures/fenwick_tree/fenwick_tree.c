@@ -0,0 +1,145 @@
+#include "fenwick_tree.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+* tree[i] (1-based) holds the sum of the elements in (i - lowbit(i), i], where lowbit(i) = i & -i.
+* A prefix sum strips the lowest set bit until 0, an update adds it until past n.
+*/
+
+typedef struct fenwick_tree {
+	long long* tree;   // n + 1 entries, tree[0] unused
+	size_t n;
+} fenwick_tree;
+
+
+static inline size_t fw_lowbit(size_t i) {
+	return i & (~i + 1);
+}
+
+static fenwick_tree* fw_alloc(size_t n) {
+	// Memory allocation: fenwick_tree struct
+	fenwick_tree* fw = (fenwick_tree*) malloc(sizeof(fenwick_tree));
+	if (!fw) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct fenwick_tree!\n");
+		exit(1);
+	}
+
+	// Memory allocation: fw->tree, zeroed
+	fw->tree = (long long*) calloc(n + 1, sizeof(long long));
+	if (!fw->tree) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu partial sums\n", n + 1);
+		free(fw);
+		exit(1);
+	}
+	fw->n = n;
+	return fw;
+}
+
+
+fenwick_tree* fw_create(size_t n) {
+	// Validate input parameter: n
+	if (n == 0) {
+		printf("Requested size must be > 0\n");
+		return NULL;
+	}
+	return fw_alloc(n);
+}
+
+
+fenwick_tree* fw_create_from_array(static_array* arr) {
+	// Validate input parameter: arr
+	if (!arr || sa_size(arr) == 0) {
+		printf("fw_create_from_array: NULL or empty array\n");
+		return NULL;
+	}
+
+	size_t n = sa_size(arr);
+	const int* data = sa_const_data(arr);
+	fenwick_tree* fw = fw_alloc(n);
+
+	// O(n) build: every node passes its sum on to the one node that covers it next
+	for (size_t i = 1; i <= n; i++) fw->tree[i] += data[i - 1];
+	for (size_t i = 1; i <= n; i++) {
+		size_t parent = i + fw_lowbit(i);
+		if (parent <= n) fw->tree[parent] += fw->tree[i];
+	}
+	return fw;
+}
+
+
+int fw_add(fenwick_tree* fw, size_t index, long long delta) {
+	// Validate input parameters: fw and index
+	if (!fw || index >= fw->n) {
+		printf("fw_add: index %zu out of range or NULL tree\n", index);
+		return -1;
+	}
+
+	for (size_t i = index + 1; i <= fw->n; i += fw_lowbit(i)) fw->tree[i] += delta;
+	return 0;
+}
+
+
+int fw_set(fenwick_tree* fw, size_t index, long long val) {
+	// Validate input parameters: fw and index
+	if (!fw || index >= fw->n) {
+		printf("fw_set: index %zu out of range or NULL tree\n", index);
+		return -1;
+	}
+
+	return fw_add(fw, index, val - fw_get(fw, index));
+}
+
+
+long long fw_get(const fenwick_tree* fw, size_t index) {
+	// Validate input parameters: fw and index
+	if (!fw || index >= fw->n) {
+		printf("fw_get: index %zu out of range or NULL tree\n", index);
+		return 0;
+	}
+
+	// tree[index + 1] minus the partial sums between (index + 1 - lowbit) and index
+	size_t i = index + 1;
+	long long val = fw->tree[i];
+	size_t stop = i - fw_lowbit(i);
+	for (size_t j = index; j > stop; j -= fw_lowbit(j)) val -= fw->tree[j];
+	return val;
+}
+
+
+long long fw_prefix_sum(const fenwick_tree* fw, size_t count) {
+	// Validate input parameters: fw and count
+	if (!fw || count > fw->n) {
+		printf("fw_prefix_sum: count %zu out of range or NULL tree\n", count);
+		return 0;
+	}
+
+	long long sum = 0;
+	for (size_t i = count; i > 0; i -= fw_lowbit(i)) sum += fw->tree[i];
+	return sum;
+}
+
+
+long long fw_range_sum(const fenwick_tree* fw, size_t lo, size_t hi) {
+	// Validate input parameters: fw and range
+	if (!fw || lo > hi || hi >= fw->n) {
+		printf("fw_range_sum: invalid range [%zu, %zu] or NULL tree\n", lo, hi);
+		return 0;
+	}
+
+	return fw_prefix_sum(fw, hi + 1) - fw_prefix_sum(fw, lo);
+}
+
+
+size_t fw_size(const fenwick_tree* fw) {
+	return fw ? fw->n : 0;
+}
+
+
+void fw_free(fenwick_tree* fw) {
+	// Validate input parameter: fw
+	if (!fw) return;
+	free(fw->tree);
+	free(fw);
+}
@@ -0,0 +1,52 @@
+#ifndef DSA_FENWICK_TREE_H
+#define DSA_FENWICK_TREE_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Fenwick tree (binary indexed tree) over n ints: prefix sums and point updates in O(log n)
+* with a single array of n + 1 partial sums. Sums are kept as long long so they do not
+* overflow on large int arrays. Indices are 0-based like static_array.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct fenwick_tree fenwick_tree;
+
+// Create a tree over n zeros
+fenwick_tree* fw_create(size_t n);
+
+// Create a tree over the elements of arr (built in O(n))
+fenwick_tree* fw_create_from_array(static_array* arr);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Add delta to the element at index. Returns 0 on success else -1
+int fw_add(fenwick_tree* fw, size_t index, long long delta);
+
+// Set the element at index to val (the counterpart of sa_modify_at). Returns 0 on success else -1
+int fw_set(fenwick_tree* fw, size_t index, long long val);
+
+// Get the element at index (0 with a message if out of range)
+long long fw_get(const fenwick_tree* fw, size_t index);
+
+// Sum of the first `count` elements, i.e. of indices [0, count)
+long long fw_prefix_sum(const fenwick_tree* fw, size_t count);
+
+// Sum of the elements at indices lo..hi (inclusive). 0 with a message if the range is invalid
+long long fw_range_sum(const fenwick_tree* fw, size_t lo, size_t hi);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of elements
+size_t fw_size(const fenwick_tree* fw);
+
+// Delete the tree
+void fw_free(fenwick_tree* fw);
+
+
+#endif /* DSA_FENWICK_TREE_H */
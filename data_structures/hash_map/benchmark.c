@@ -0,0 +1,105 @@
+/*
+Membership benchmark: hash_set vs sa_find_val vs ll_search.
+
+    Build: gcc -O2 benchmark.c hash_map.c ../arrays/static_array.c ../linked_list/linked_list.c -o hash_bench
+    Usage: ./hash_bench [max_keys=10000000]
+
+For n = 1K, 10K, ... up to max_keys random distinct keys, fills a hash_set, a static_array and a
+linked list with the same keys and times lookups where half of the probed keys are present.
+The linear containers get a bounded number of lookups per size (each one scans up to n elements),
+so the reported figure is ns per lookup for every container.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "hash_map.h"
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+#define HASH_LOOKUPS   2000000
+#define LINEAR_BUDGET  200000000ull   // Element visits allowed per linear-container measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+int main(int argc, char** argv) {
+    size_t max_keys = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+
+    // Even keys are stored, odd keys are guaranteed misses
+    int* keys = (int*) malloc(max_keys * sizeof(int));
+    int* probes = (int*) malloc(HASH_LOOKUPS * sizeof(int));
+    if (!keys || !probes) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    printf("%10s %14s %14s %14s %10s\n", "keys", "hash_set ns", "sa_find ns", "ll_search ns", "hits");
+    for (size_t n = 1000; n <= max_keys; n *= 10) {
+        for (size_t i = 0; i < n; i++) keys[i] = (int)(2 * i);
+        for (size_t i = n; i > 1; i--) {
+            size_t j = next_random() % i;
+            int t = keys[i - 1]; keys[i - 1] = keys[j]; keys[j] = t;
+        }
+        for (size_t i = 0; i < HASH_LOOKUPS; i++) {
+            int k = (int)(2 * (next_random() % n));
+            probes[i] = (i & 1) ? k + 1 : k;
+        }
+
+        hash_set* set = hs_create(n, 0);
+        static_array* arr = sa_create_array(n);
+        ll_node* head = NULL;
+        for (size_t i = 0; i < n; i++) {
+            hs_insert(set, keys[i]);
+            sa_insert_last(arr, keys[i]);
+            ll_push_front(&head, keys[i]);
+        }
+
+        // hash_set
+        size_t hits = 0;
+        double t0 = now_seconds();
+        for (size_t i = 0; i < HASH_LOOKUPS; i++) hits += (size_t)hs_contains(set, probes[i]);
+        double hash_ns = (now_seconds() - t0) * 1e9 / HASH_LOOKUPS;
+
+        // Linear containers: as many lookups as the visit budget allows
+        size_t linear = (size_t)(LINEAR_BUDGET / n);
+        if (linear < 2) linear = 2;
+        if (linear > HASH_LOOKUPS) linear = HASH_LOOKUPS;
+
+        size_t sa_hits = 0;
+        t0 = now_seconds();
+        for (size_t i = 0; i < linear; i++) sa_hits += sa_find_val(arr, probes[i]) >= 0;
+        double sa_ns = (now_seconds() - t0) * 1e9 / linear;
+
+        size_t ll_hits = 0;
+        t0 = now_seconds();
+        for (size_t i = 0; i < linear; i++) ll_hits += ll_search(head, probes[i]) != -1;
+        double ll_ns = (now_seconds() - t0) * 1e9 / linear;
+
+        printf("%10zu %14.1f %14.1f %14.1f %10s\n", n, hash_ns, sa_ns, ll_ns,
+               (hits == HASH_LOOKUPS / 2 && sa_hits == ll_hits) ? "ok" : "MISMATCH");
+
+        while (head) ll_pop_front(&head);
+        sa_free(arr);
+        hs_free(set);
+    }
+
+    free(probes);
+    free(keys);
+    return 0;
+}
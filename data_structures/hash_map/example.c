@@ -0,0 +1,43 @@
+#include <stdio.h>
+#include "hash_map.h"
+
+int main(void) {
+
+    printf("\n\n============================| HASH SET / MAP EXAMPLE |============================\n\n");
+
+    // Set: membership
+    hash_set* set = hs_create(8, 0);
+    hs_insert(set, 10);
+    hs_insert(set, 20);
+    hs_insert(set, 30);
+    printf("Insert 20 again returns %d (already present)\n", hs_insert(set, 20));
+    printf("Set contains 20: %d, contains 25: %d, size: %zu\n", hs_contains(set, 20), hs_contains(set, 25), hs_size(set));
+
+    hs_remove(set, 20);
+    printf("After removing 20: contains 20: %d, size: %zu\n", hs_contains(set, 20), hs_size(set));
+    hs_free(set);
+
+    // Map: key -> value
+    hash_map* map = hm_create(0, 0.75);
+    for (int i = 0; i < 100; i++) hm_put(map, i, i * i);
+    hm_put(map, 7, -1);
+
+    int val;
+    if (hm_get(map, 7, &val) == 0) printf("map[7] = %d\n", val);
+    if (hm_get(map, 12, &val) == 0) printf("map[12] = %d\n", val);
+    if (hm_get(map, 500, &val) != 0) printf("map[500] not found\n");
+
+    int* slot = hm_find(map, 9);
+    if (slot) *slot += 1;
+    hm_get(map, 9, &val);
+    printf("map[9] after in-place increment = %d\n", val);
+
+    for (int i = 0; i < 100; i += 2) hm_remove(map, i);
+    printf("Size after removing even keys: %zu\n", hm_size(map));
+
+    hm_rehash(map, 0);
+    printf("map[51] after shrinking rehash: %d\n", hm_get(map, 51, &val) == 0 ? val : -1);
+    hm_free(map);
+
+    return 0;
+}
@@ -0,0 +1,445 @@
+#include "hash_map.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+* Table layout:
+*   ctrl[0..capacity)   one control byte per slot: HASH_CTRL_EMPTY or the top 7 bits of the key's hash (h2)
+*   ctrl[capacity..+16) copy of ctrl[0..16), so a 16-byte group load starting near the end wraps around
+*   keys[], vals[]      slot payloads (vals is NULL for sets)
+*
+* Probing is linear from slot hash & (capacity-1), a group of 16 slots at a time. Because deletion
+* shifts entries back (there are no tombstones), every key sits between its home slot and the first
+* empty slot after it - so a lookup can stop at the first group that contains an empty slot.
+*/
+
+#define HASH_GROUP_WIDTH 16
+#define HASH_CTRL_EMPTY  ((uint8_t)0x80)
+#define HASH_MIN_CAPACITY HASH_GROUP_WIDTH
+
+typedef struct hash_table {
+	uint8_t* ctrl;
+	int* keys;
+	int* vals;
+	size_t capacity;      // Power of two, >= HASH_MIN_CAPACITY
+	size_t size;
+	size_t growth_limit;  // Grow once size reaches this (capacity * max_load)
+	double max_load;
+} hash_table;
+
+typedef struct hash_set {
+	hash_table t;
+} hash_set;
+
+typedef struct hash_map {
+	hash_table t;
+} hash_map;
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Hashing and group matching
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// 64-bit finalizer (splitmix64): every input bit affects both the slot index and the 7-bit tag
+static inline uint64_t hash_int(int key) {
+	uint64_t h = (uint64_t)(uint32_t)key;
+	h ^= h >> 30;
+	h *= 0xBF58476D1CE4E5B9ull;
+	h ^= h >> 27;
+	h *= 0x94D049BB133111EBull;
+	h ^= h >> 31;
+	return h;
+}
+
+static inline uint8_t hash_h2(uint64_t h) {
+	return (uint8_t)(h >> 57);
+}
+
+// Bit i of the result is set if ctrl[i] == byte, for the 16 control bytes at ctrl
+static inline uint32_t hash_group_match(const uint8_t* ctrl, uint8_t byte) {
+#ifdef __SSE2__
+	__m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+#else
+	uint32_t mask = 0;
+	for (int i = 0; i < HASH_GROUP_WIDTH; i++) {
+		if (ctrl[i] == byte) mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
+
+static inline unsigned hash_lowest_bit(uint32_t mask) {
+	return (unsigned)__builtin_ctz(mask);
+}
+
+static inline void hash_set_ctrl(hash_table* t, size_t slot, uint8_t byte) {
+	t->ctrl[slot] = byte;
+	if (slot < HASH_GROUP_WIDTH) t->ctrl[t->capacity + slot] = byte;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Table internals shared by the set and the map
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Smallest power-of-two capacity that holds count keys below max_load
+static size_t hash_capacity_for(size_t count, double max_load) {
+	size_t needed = (size_t)((double)count / max_load) + 1;
+	size_t cap = HASH_MIN_CAPACITY;
+	while (cap < needed) cap <<= 1;
+	return cap;
+}
+
+static void hash_alloc_arrays(hash_table* t, size_t capacity, int with_vals) {
+	t->ctrl = (uint8_t*) malloc(capacity + HASH_GROUP_WIDTH);
+	t->keys = (int*) malloc(sizeof(int) * capacity);
+	t->vals = with_vals ? (int*) malloc(sizeof(int) * capacity) : NULL;
+	if (!t->ctrl || !t->keys || (with_vals && !t->vals)) {
+		printf("Memory allocation failed: couldn't allocate a hash table of %zu slots\n", capacity);
+		exit(1);
+	}
+	memset(t->ctrl, HASH_CTRL_EMPTY, capacity + HASH_GROUP_WIDTH);
+	t->capacity = capacity;
+	t->size = 0;
+	t->growth_limit = (size_t)((double)capacity * t->max_load);
+	if (t->growth_limit >= capacity) t->growth_limit = capacity - 1;
+}
+
+static int hash_init(hash_table* t, size_t expected, double max_load, int with_vals) {
+	// Validate input parameter: max_load
+	if (max_load == 0) max_load = HASH_DEFAULT_MAX_LOAD;
+	if (!(max_load > 0 && max_load < 1)) {
+		printf("hash table: max_load must be in (0, 1), got %f\n", max_load);
+		return -1;
+	}
+	t->max_load = max_load;
+	hash_alloc_arrays(t, hash_capacity_for(expected, max_load), with_vals);
+	return 0;
+}
+
+/*
+ * Finds key. Returns its slot, or -1 if absent; in that case *insert_slot (if given) receives
+ * the first empty slot of the probe sequence, where the key would be inserted.
+ */
+static inline ptrdiff_t hash_find_slot(const hash_table* t, int key, uint64_t h, size_t* insert_slot) {
+	size_t mask = t->capacity - 1;
+	size_t pos = (size_t)h & mask;
+	uint8_t h2 = hash_h2(h);
+
+	for (;;) {
+		const uint8_t* group = t->ctrl + pos;
+		for (uint32_t match = hash_group_match(group, h2); match; match &= match - 1) {
+			size_t slot = (pos + hash_lowest_bit(match)) & mask;
+			if (t->keys[slot] == key) return (ptrdiff_t)slot;
+		}
+		uint32_t empty = hash_group_match(group, HASH_CTRL_EMPTY);
+		if (empty) {
+			if (insert_slot) *insert_slot = (pos + hash_lowest_bit(empty)) & mask;
+			return -1;
+		}
+		pos = (pos + HASH_GROUP_WIDTH) & mask;
+	}
+}
+
+// Places a key that is known to be absent (used by rehash)
+static void hash_place_new(hash_table* t, int key, const int* val) {
+	uint64_t h = hash_int(key);
+	size_t mask = t->capacity - 1;
+	size_t pos = (size_t)h & mask;
+	for (;;) {
+		uint32_t empty = hash_group_match(t->ctrl + pos, HASH_CTRL_EMPTY);
+		if (empty) {
+			size_t slot = (pos + hash_lowest_bit(empty)) & mask;
+			hash_set_ctrl(t, slot, hash_h2(h));
+			t->keys[slot] = key;
+			if (val) t->vals[slot] = *val;
+			t->size++;
+			return;
+		}
+		pos = (pos + HASH_GROUP_WIDTH) & mask;
+	}
+}
+
+static int hash_resize(hash_table* t, size_t new_capacity) {
+	hash_table old = *t;
+	hash_alloc_arrays(t, new_capacity, old.vals != NULL);
+	for (size_t i = 0; i < old.capacity; i++) {
+		if (old.ctrl[i] != HASH_CTRL_EMPTY) hash_place_new(t, old.keys[i], old.vals ? &old.vals[i] : NULL);
+	}
+	free(old.ctrl);
+	free(old.keys);
+	free(old.vals);
+	return 0;
+}
+
+static int hash_rehash(hash_table* t, size_t count) {
+	if (count < t->size) count = t->size;
+	return hash_resize(t, hash_capacity_for(count, t->max_load));
+}
+
+static int hash_reserve(hash_table* t, size_t count) {
+	if (count <= t->growth_limit) return 0;
+	return hash_resize(t, hash_capacity_for(count, t->max_load));
+}
+
+/*
+ * Inserts key (or finds it). Returns the slot and sets *inserted to 1 if the key is new.
+ */
+static size_t hash_insert(hash_table* t, int key, int* inserted) {
+	uint64_t h = hash_int(key);
+	size_t slot = 0;
+	ptrdiff_t found = hash_find_slot(t, key, h, &slot);
+	if (found >= 0) {
+		*inserted = 0;
+		return (size_t)found;
+	}
+
+	// Grow first if the new key would push the table past its load limit
+	if (t->size >= t->growth_limit) {
+		hash_resize(t, t->capacity * 2);
+		hash_find_slot(t, key, h, &slot);
+	}
+
+	hash_set_ctrl(t, slot, hash_h2(h));
+	t->keys[slot] = key;
+	t->size++;
+	*inserted = 1;
+	return slot;
+}
+
+/*
+ * Removes key with backward-shift deletion: every following entry of the cluster that may legally
+ * live in the hole is moved into it, so no tombstone is needed.
+ */
+static int hash_remove(hash_table* t, int key) {
+	ptrdiff_t found = hash_find_slot(t, key, hash_int(key), NULL);
+	if (found < 0) return -1;
+
+	size_t mask = t->capacity - 1;
+	size_t hole = (size_t)found;
+	for (size_t j = (hole + 1) & mask; t->ctrl[j] != HASH_CTRL_EMPTY; j = (j + 1) & mask) {
+		size_t home = (size_t)hash_int(t->keys[j]) & mask;
+		// The entry at j may move to the hole unless its home lies cyclically in (hole, j]
+		if (((j - home) & mask) >= ((j - hole) & mask)) {
+			hash_set_ctrl(t, hole, t->ctrl[j]);
+			t->keys[hole] = t->keys[j];
+			if (t->vals) t->vals[hole] = t->vals[j];
+			hole = j;
+		}
+	}
+	hash_set_ctrl(t, hole, HASH_CTRL_EMPTY);
+	t->size--;
+	return 0;
+}
+
+static void hash_clear(hash_table* t) {
+	memset(t->ctrl, HASH_CTRL_EMPTY, t->capacity + HASH_GROUP_WIDTH);
+	t->size = 0;
+}
+
+static void hash_destroy(hash_table* t) {
+	free(t->ctrl);
+	free(t->keys);
+	free(t->vals);
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Hash set
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+hash_set* hs_create(size_t expected, double max_load) {
+	// Memory allocation: hash_set struct
+	hash_set* set = (hash_set*) malloc(sizeof(hash_set));
+	if (!set) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct hash_set!\n");
+		exit(1);
+	}
+
+	// Initialize the table
+	if (hash_init(&set->t, expected, max_load, 0) != 0) {
+		free(set);
+		return NULL;
+	}
+	return set;
+}
+
+int hs_insert(hash_set* set, int key) {
+	// Validate input parameter: set
+	if (!set) {
+		printf("hs_insert: NULL set pointer\n");
+		return -1;
+	}
+
+	int inserted;
+	hash_insert(&set->t, key, &inserted);
+	return inserted ? 0 : 1;
+}
+
+int hs_contains(const hash_set* set, int key) {
+	// Validate input parameter: set
+	if (!set) {
+		printf("hs_contains: NULL set pointer\n");
+		return 0;
+	}
+	return hash_find_slot(&set->t, key, hash_int(key), NULL) >= 0;
+}
+
+int hs_remove(hash_set* set, int key) {
+	// Validate input parameter: set
+	if (!set) {
+		printf("hs_remove: NULL set pointer\n");
+		return -1;
+	}
+	return hash_remove(&set->t, key);
+}
+
+int hs_reserve(hash_set* set, size_t count) {
+	// Validate input parameter: set
+	if (!set) {
+		printf("hs_reserve: NULL set pointer\n");
+		return -1;
+	}
+	return hash_reserve(&set->t, count);
+}
+
+int hs_rehash(hash_set* set, size_t count) {
+	// Validate input parameter: set
+	if (!set) {
+		printf("hs_rehash: NULL set pointer\n");
+		return -1;
+	}
+	return hash_rehash(&set->t, count);
+}
+
+size_t hs_size(const hash_set* set) {
+	return set ? set->t.size : 0;
+}
+
+void hs_clear(hash_set* set) {
+	if (set) hash_clear(&set->t);
+}
+
+void hs_free(hash_set* set) {
+	// Validate input parameter: set
+	if (!set) return;
+	hash_destroy(&set->t);
+	free(set);
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Hash map
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+hash_map* hm_create(size_t expected, double max_load) {
+	// Memory allocation: hash_map struct
+	hash_map* map = (hash_map*) malloc(sizeof(hash_map));
+	if (!map) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct hash_map!\n");
+		exit(1);
+	}
+
+	// Initialize the table
+	if (hash_init(&map->t, expected, max_load, 1) != 0) {
+		free(map);
+		return NULL;
+	}
+	return map;
+}
+
+int hm_put(hash_map* map, int key, int val) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_put: NULL map pointer\n");
+		return -1;
+	}
+
+	int inserted;
+	size_t slot = hash_insert(&map->t, key, &inserted);
+	map->t.vals[slot] = val;
+	return inserted ? 0 : 1;
+}
+
+int hm_get(const hash_map* map, int key, int* out) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_get: NULL map pointer\n");
+		return -1;
+	}
+
+	ptrdiff_t slot = hash_find_slot(&map->t, key, hash_int(key), NULL);
+	if (slot < 0) return -1;
+	if (out) *out = map->t.vals[slot];
+	return 0;
+}
+
+int* hm_find(hash_map* map, int key) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_find: NULL map pointer\n");
+		return NULL;
+	}
+
+	ptrdiff_t slot = hash_find_slot(&map->t, key, hash_int(key), NULL);
+	return slot < 0 ? NULL : &map->t.vals[slot];
+}
+
+int hm_contains(const hash_map* map, int key) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_contains: NULL map pointer\n");
+		return 0;
+	}
+	return hash_find_slot(&map->t, key, hash_int(key), NULL) >= 0;
+}
+
+int hm_remove(hash_map* map, int key) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_remove: NULL map pointer\n");
+		return -1;
+	}
+	return hash_remove(&map->t, key);
+}
+
+int hm_reserve(hash_map* map, size_t count) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_reserve: NULL map pointer\n");
+		return -1;
+	}
+	return hash_reserve(&map->t, count);
+}
+
+int hm_rehash(hash_map* map, size_t count) {
+	// Validate input parameter: map
+	if (!map) {
+		printf("hm_rehash: NULL map pointer\n");
+		return -1;
+	}
+	return hash_rehash(&map->t, count);
+}
+
+size_t hm_size(const hash_map* map) {
+	return map ? map->t.size : 0;
+}
+
+void hm_clear(hash_map* map) {
+	if (map) hash_clear(&map->t);
+}
+
+void hm_free(hash_map* map) {
+	// Validate input parameter: map
+	if (!map) return;
+	hash_destroy(&map->t);
+	free(map);
+}
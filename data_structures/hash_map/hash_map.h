@@ -0,0 +1,94 @@
+#ifndef DSA_HASH_MAP_H
+#define DSA_HASH_MAP_H
+
+
+#include <stddef.h>
+
+
+/*
+* Open-addressing hash set / hash map with int keys (and int values for the map).
+* Every slot has a one-byte control tag (empty, or 7 bits of the key's hash); lookups compare
+* 16 tags at once with SSE2 (plain loop without SSE2) and only touch keys whose tag matches.
+* Deletion shifts the following entries back instead of leaving tombstones, so lookups never
+* slow down after many removals.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct hash_set hash_set;
+typedef struct hash_map hash_map;
+
+// Load factor used when 0 is passed as max_load
+#define HASH_DEFAULT_MAX_LOAD 0.875
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Hash set
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Create a set sized for `expected` keys. max_load in (0, 1) is the fill ratio that triggers growth (0 -> default)
+hash_set* hs_create(size_t expected, double max_load);
+
+// Insert key - returns 0 if inserted, 1 if it was already present, -1 on error
+int hs_insert(hash_set* set, int key);
+
+// Returns 1 if key is in the set else 0
+int hs_contains(const hash_set* set, int key);
+
+// Remove key - returns 0 if removed else -1 (not present)
+int hs_remove(hash_set* set, int key);
+
+// Make room for `count` keys without further rehashing. Returns 0 on success else -1
+int hs_reserve(hash_set* set, size_t count);
+
+// Rebuild the table with room for max(count, current size) keys (can also shrink). Returns 0 on success else -1
+int hs_rehash(hash_set* set, size_t count);
+
+// Get the current no. of keys
+size_t hs_size(const hash_set* set);
+
+// Remove every key (keeps the allocated table)
+void hs_clear(hash_set* set);
+
+// Delete entire set
+void hs_free(hash_set* set);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Hash map (int -> int)
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Create a map sized for `expected` keys. max_load in (0, 1) is the fill ratio that triggers growth (0 -> default)
+hash_map* hm_create(size_t expected, double max_load);
+
+// Insert or overwrite key -> val - returns 0 if inserted, 1 if an existing value was overwritten, -1 on error
+int hm_put(hash_map* map, int key, int val);
+
+// Look up key - returns 0 and stores the value in *out (if out != NULL) when found, else -1
+int hm_get(const hash_map* map, int key, int* out);
+
+// Pointer to the value stored for key, or NULL. Valid until the next insert/remove/rehash
+int* hm_find(hash_map* map, int key);
+
+// Returns 1 if key is in the map else 0
+int hm_contains(const hash_map* map, int key);
+
+// Remove key - returns 0 if removed else -1 (not present)
+int hm_remove(hash_map* map, int key);
+
+// Make room for `count` keys without further rehashing. Returns 0 on success else -1
+int hm_reserve(hash_map* map, size_t count);
+
+// Rebuild the table with room for max(count, current size) keys (can also shrink). Returns 0 on success else -1
+int hm_rehash(hash_map* map, size_t count);
+
+// Get the current no. of keys
+size_t hm_size(const hash_map* map);
+
+// Remove every key (keeps the allocated table)
+void hm_clear(hash_map* map);
+
+// Delete entire map
+void hm_free(hash_map* map);
+
+
+#endif /* DSA_HASH_MAP_H */
@@ -0,0 +1,188 @@
+/*
+Intrusive list benchmark: il_link embedded in the objects vs ll_node lists referring to the objects.
+
+    Build: gcc -O2 benchmark.c ../linked_list/linked_list.c -o il_bench
+    Usage: ./il_bench [max_objects=1000000]
+
+Objects (64 bytes with the link) live in one pool. ll_node stores an int, so the baseline list holds
+each object's pool index - the same double indirection as a list of pointers: node -> object.
+For n = 1K, 10K, ... up to max_objects:
+    build          : link all n objects (il_push_back, no allocation) vs ll_push_front of n nodes
+    walk (pool)    : sum a field of every object, list in pool order
+    walk (shuffled): the same with the list linked in random order (every hop is a cache miss)
+    unlink         : remove random objects - il_unlink (O(1)) vs ll_search + ll_delete_at (O(n))
+    splice         : append one list to another - il_splice_back (O(1)) vs walking to the ll tail
+Times are ns per object (per removal / per splice for the last two). The ll removals get a bounded
+budget of visited nodes. Both lists must yield the same sums, which the last column reports.
+
+Note on the shuffled walk: ll_node nodes are allocated in list order, so their chain is sequential
+and the object loads are independent of each other (the CPU overlaps the misses). The intrusive
+chain goes through the objects themselves, so each miss waits for the previous one. When the
+link order doesn't follow memory order, the intrusive list's win is in allocations, unlink and splice.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "intrusive_list.h"
+#include "../linked_list/linked_list.h"
+
+#define VISIT_BUDGET 200000000ull    // Nodes visited allowed for the ll removals
+
+typedef struct object {
+    int id;
+    int weight;
+    char payload[40];
+    il_link link;
+} object;
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Link the pool in the given order into both lists; returns the ll head
+static ll_node* build_both(object* pool, const int* order, size_t n, il_link* head) {
+    il_init(head);
+    for (size_t i = 0; i < n; i++) il_push_back(head, &pool[order[i]].link);
+    ll_node* ll = NULL;
+    for (size_t i = n; i-- > 0; ) ll_push_front(&ll, order[i]);
+    return ll;
+}
+
+static long long walk_il(const il_link* head) {
+    long long sum = 0;
+    il_for_each_entry(o, head, object, link) sum += o->weight;
+    return sum;
+}
+
+static long long walk_ll(const ll_node* ll, const object* pool) {
+    long long sum = 0;
+    for (const ll_node* node = ll; node; node = ll_next(node)) sum += pool[ll_get_data(node)].weight;
+    return sum;
+}
+
+static void free_ll(ll_node** ll) {
+    while (*ll) ll_pop_front(ll);
+}
+
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+
+    printf("%9s | %8s %8s | %8s %8s | %8s %8s | %9s %11s | %8s %10s | %6s\n", "n", "il build", "ll build",
+           "il walk", "ll walk", "il shuf", "ll shuf", "il unlink", "ll unlink", "il splc", "ll splc", "check");
+    for (size_t n = 1000; n <= max_n; n *= 10) {
+        object* pool = (object*) malloc(sizeof(object) * n);
+        int* order = (int*) malloc(sizeof(int) * n);
+        if (!pool || !order) {
+            printf("Memory allocation failed!\n");
+            return 1;
+        }
+        for (size_t i = 0; i < n; i++) {
+            pool[i].id = (int)i;
+            pool[i].weight = (int)(next_random() % 1000);
+            il_init(&pool[i].link);
+            order[i] = (int)i;
+        }
+        int ok = 1;
+        il_link head;
+
+        // Build in pool order
+        double t0 = now_seconds();
+        il_init(&head);
+        for (size_t i = 0; i < n; i++) il_push_back(&head, &pool[i].link);
+        double il_build = (now_seconds() - t0) * 1e9 / (double)n;
+        ll_node* ll = NULL;
+        t0 = now_seconds();
+        for (size_t i = n; i-- > 0; ) ll_push_front(&ll, (int)i);
+        double ll_build = (now_seconds() - t0) * 1e9 / (double)n;
+
+        // Walks in pool order
+        t0 = now_seconds();
+        long long il_sum = walk_il(&head);
+        double il_walk = (now_seconds() - t0) * 1e9 / (double)n;
+        t0 = now_seconds();
+        long long ll_sum = walk_ll(ll, pool);
+        double ll_walk = (now_seconds() - t0) * 1e9 / (double)n;
+        if (il_sum != ll_sum) ok = 0;
+        free_ll(&ll);
+
+        // Walks in shuffled order
+        for (size_t i = n - 1; i > 0; i--) {
+            size_t j = (size_t)(next_random() % (i + 1));
+            int t = order[i]; order[i] = order[j]; order[j] = t;
+        }
+        ll = build_both(pool, order, n, &head);
+        t0 = now_seconds();
+        il_sum = walk_il(&head);
+        double il_shuf = (now_seconds() - t0) * 1e9 / (double)n;
+        t0 = now_seconds();
+        ll_sum = walk_ll(ll, pool);
+        double ll_shuf = (now_seconds() - t0) * 1e9 / (double)n;
+        if (il_sum != ll_sum) ok = 0;
+
+        // Remove random objects (the same ones from both lists)
+        size_t removals = VISIT_BUDGET / n;
+        if (removals > n / 2) removals = n / 2;
+        if (removals == 0) removals = 1;
+        int* victims = (int*) malloc(sizeof(int) * removals);
+        if (!victims) {
+            printf("Memory allocation failed!\n");
+            return 1;
+        }
+        for (size_t r = 0; r < removals; r++) victims[r] = order[r * (n / removals)];
+        t0 = now_seconds();
+        for (size_t r = 0; r < removals; r++) il_unlink(&pool[victims[r]].link);
+        double il_unlink_ns = (now_seconds() - t0) * 1e9 / (double)removals;
+        t0 = now_seconds();
+        for (size_t r = 0; r < removals; r++) ll_delete_at(&ll, ll_search(ll, victims[r]));
+        double ll_unlink_ns = (now_seconds() - t0) * 1e9 / (double)removals;
+        if (walk_il(&head) != walk_ll(ll, pool) || il_count(&head) != (size_t)ll_count_nodes(ll)) ok = 0;
+        free(victims);
+
+        // Splice the removed objects (as a second list) onto the back
+        il_link extra;
+        il_init(&extra);
+        ll_node* ll_extra = NULL;
+        for (size_t i = 0; i < n; i++) {
+            if (!il_is_linked(&pool[i].link)) {
+                il_push_back(&extra, &pool[i].link);
+                ll_push_front(&ll_extra, (int)i);
+            }
+        }
+        t0 = now_seconds();
+        il_splice_back(&head, &extra);
+        double il_splice = (now_seconds() - t0) * 1e9;
+        t0 = now_seconds();
+        ll_node* tail = ll;
+        while (ll_next(tail)) tail = ll_next(tail);
+        double ll_splice = (now_seconds() - t0) * 1e9;
+        // ll_node has no public way to link two lists, so the walk to the tail is the measured part
+        long long extra_sum = walk_ll(ll_extra, pool);
+        if (walk_il(&head) != walk_ll(ll, pool) + extra_sum || il_count(&head) != n) ok = 0;
+
+        printf("%9zu | %8.1f %8.1f | %8.2f %8.2f | %8.2f %8.2f | %9.1f %11.1f | %8.0f %10.0f | %6s\n", n,
+               il_build, ll_build, il_walk, ll_walk, il_shuf, ll_shuf, il_unlink_ns, ll_unlink_ns,
+               il_splice, ll_splice, ok ? "ok" : "MISMATCH");
+
+        free_ll(&ll);
+        free_ll(&ll_extra);
+        free(order);
+        free(pool);
+    }
+    return 0;
+}
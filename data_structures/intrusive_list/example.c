@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include "intrusive_list.h"
+
+// A caller-owned object with an embedded link
+typedef struct task {
+    int id;
+    int priority;
+    il_link node;
+} task;
+
+int main(void) {
+
+    printf("\n\n============================| INTRUSIVE LIST EXAMPLE |============================\n\n");
+
+    // Objects live in the caller's storage; the list never allocates
+    task tasks[6];
+    il_link ready, waiting;
+    il_init(&ready);
+    il_init(&waiting);
+    for (int i = 0; i < 6; i++) {
+        tasks[i].id = i;
+        tasks[i].priority = 10 * i;
+        il_init(&tasks[i].node);
+        il_push_back(i % 2 ? &waiting : &ready, &tasks[i].node);
+    }
+
+    printf("Ready: ");
+    il_for_each_entry(t, &ready, task, node) printf("%d ", t->id);
+    printf("\nWaiting: ");
+    il_for_each_entry(t, &waiting, task, node) printf("%d ", t->id);
+    printf("\n");
+
+    // O(1) unlink straight from the object, no search
+    il_unlink(&tasks[2].node);
+    printf("Task 2 linked after unlink: %s\n", il_is_linked(&tasks[2].node) ? "yes" : "no");
+
+    // O(1) splice: move all waiting tasks behind the ready ones
+    il_splice_back(&ready, &waiting);
+    printf("Ready after splice (%zu tasks): ", il_count(&ready));
+    il_for_each_entry(t, &ready, task, node) printf("%d ", t->id);
+    printf("\nWaiting is empty: %s\n", il_is_empty(&waiting) ? "yes" : "no");
+
+    // Back to front
+    printf("Reverse: ");
+    il_for_each_entry_reverse(t, &ready, task, node) printf("%d ", t->id);
+    printf("\n");
+
+    // Unlink while iterating
+    il_for_each_safe(l, &ready) {
+        task* t = il_container_of(l, task, node);
+        if (t->priority >= 30) il_unlink(l);
+    }
+    printf("Priority < 30: ");
+    il_for_each_entry(t, &ready, task, node) printf("%d ", t->id);
+    printf("\n");
+
+    // Pop from the front
+    il_link* first = il_pop_front(&ready);
+    printf("Popped task %d, %zu left\n", il_container_of(first, task, node)->id, il_count(&ready));
+
+    return 0;
+}
@@ -0,0 +1,160 @@
+#ifndef DSA_INTRUSIVE_LIST_H
+#define DSA_INTRUSIVE_LIST_H
+
+
+#include <stddef.h>
+
+
+/*
+* Intrusive doubly linked list (header-only).
+* The caller embeds an il_link in its own struct; the list only links those fields together and
+* never allocates or frees anything. il_container_of turns a link back into the enclosing object.
+*
+* A list is a circular chain through a head link (no element stored in it): an empty list is a head
+* pointing at itself, so insert / unlink never test for NULL and every operation is O(1) except
+* il_count. A link that is not in any list points at itself too (il_is_linked tells which).
+*
+*     typedef struct task { int id; il_link node; } task;
+*     il_link queue;  il_init(&queue);
+*     il_push_back(&queue, &t->node);
+*     il_for_each_entry(it, &queue, task, node) printf("%d\n", it->id);
+*
+* Conventions follow static_array where they apply; there are no error prints, as a link
+* is always valid by construction.
+*/
+
+typedef struct il_link {
+	struct il_link* next;
+	struct il_link* prev;
+} il_link;
+
+// Pointer to the struct of type `type` whose field `member` is the link at ptr
+#define il_container_of(ptr, type, member) ((type*)((char*)(ptr) - offsetof(type, member)))
+
+// Initialize a list head (empty list) or an unlinked element link
+static inline void il_init(il_link* link) {
+	link->next = link;
+	link->prev = link;
+}
+
+// Returns 1 if the list is empty else 0
+static inline int il_is_empty(const il_link* head) {
+	return head->next == head;
+}
+
+// Returns 1 if an element link is currently in a list else 0 (the link must have been initialized)
+static inline int il_is_linked(const il_link* link) {
+	return link->next != link;
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Insert link right after pos (pos may be the head: insert at the front)
+static inline void il_insert_after(il_link* pos, il_link* link) {
+	link->prev = pos;
+	link->next = pos->next;
+	pos->next->prev = link;
+	pos->next = link;
+}
+
+// Insert link right before pos (pos may be the head: insert at the back)
+static inline void il_insert_before(il_link* pos, il_link* link) {
+	il_insert_after(pos->prev, link);
+}
+
+// Insert at the front
+static inline void il_push_front(il_link* head, il_link* link) {
+	il_insert_after(head, link);
+}
+
+// Insert at the back
+static inline void il_push_back(il_link* head, il_link* link) {
+	il_insert_after(head->prev, link);
+}
+
+// Remove link from whatever list it is in, O(1); the link is left unlinked (safe to unlink again)
+static inline void il_unlink(il_link* link) {
+	link->prev->next = link->next;
+	link->next->prev = link->prev;
+	il_init(link);
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// First element link, NULL if the list is empty
+static inline il_link* il_front(const il_link* head) {
+	return il_is_empty(head) ? NULL : head->next;
+}
+
+// Last element link, NULL if the list is empty
+static inline il_link* il_back(const il_link* head) {
+	return il_is_empty(head) ? NULL : head->prev;
+}
+
+// Unlink and return the first element link, NULL if the list is empty
+static inline il_link* il_pop_front(il_link* head) {
+	il_link* link = il_front(head);
+	if (link) il_unlink(link);
+	return link;
+}
+
+// Unlink and return the last element link, NULL if the list is empty
+static inline il_link* il_pop_back(il_link* head) {
+	il_link* link = il_back(head);
+	if (link) il_unlink(link);
+	return link;
+}
+
+// Count the elements, O(n)
+static inline size_t il_count(const il_link* head) {
+	size_t count = 0;
+	for (const il_link* l = head->next; l != head; l = l->next) count++;
+	return count;
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Move every element of src to just after pos (in the same order), O(1). src is left empty
+static inline void il_splice_after(il_link* pos, il_link* src) {
+	if (il_is_empty(src)) return;
+	il_link* first = src->next;
+	il_link* last = src->prev;
+	first->prev = pos;
+	last->next = pos->next;
+	pos->next->prev = last;
+	pos->next = first;
+	il_init(src);
+}
+
+// Move every element of src to the front of dst, O(1). src is left empty
+static inline void il_splice_front(il_link* dst, il_link* src) {
+	il_splice_after(dst, src);
+}
+
+// Move every element of src to the back of dst, O(1). src is left empty
+static inline void il_splice_back(il_link* dst, il_link* src) {
+	il_splice_after(dst->prev, src);
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Iterate over the element links: for every `pos` (an il_link*) from front to back
+#define il_for_each(pos, head) \
+	for (il_link* pos = (head)->next; pos != (head); pos = pos->next)
+
+// Same, but the current link may be unlinked (or freed with its object) inside the loop
+#define il_for_each_safe(pos, head) \
+	for (il_link* pos = (head)->next, *pos##_next = pos->next; pos != (head); pos = pos##_next, pos##_next = pos->next)
+
+// Iterate over the enclosing objects: `obj` is a `type*` whose link field is `member`
+#define il_for_each_entry(obj, head, type, member) \
+	for (type* obj = il_container_of((head)->next, type, member); &obj->member != (head); \
+	     obj = il_container_of(obj->member.next, type, member))
+
+// Iterate over the enclosing objects from back to front
+#define il_for_each_entry_reverse(obj, head, type, member) \
+	for (type* obj = il_container_of((head)->prev, type, member); &obj->member != (head); \
+	     obj = il_container_of(obj->member.prev, type, member))
+
+
+#endif /* DSA_INTRUSIVE_LIST_H */
@@ -0,0 +1,178 @@
+/*
+Batch benchmark: ll_apply_edits / ll_search_many vs one ll_insert_at / ll_delete_at / ll_search per item.
+
+    Build: gcc -O2 benchmark.c linked_list.c -o ll_bench
+    Usage: ./ll_bench [nodes=1000000]
+
+For k = 10, 100, ... 100K items on a list of `nodes` nodes:
+  - edits: k inserts / deletes at distinct random positions, half of each. The batch gets them in
+    random order (so the time includes sorting them) and presorted. One-by-one applies them from the
+    highest position down, so no position needs adjusting; it walks from the head every time, so only
+    an evenly spread sample of the edits fits the visit budget and the total is extrapolated (est.).
+    The batch result is checked against the expected list, and against one-by-one when it ran fully.
+  - search: k keys, half of them in the list. ll_search_many does one traversal; ll_search is timed on
+    a budgeted sample of the keys, whose positions must match.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "linked_list.h"
+
+#define MAX_BATCH 100000
+#define WALK_BUDGET 500000000ull   // Node visits allowed for the one-by-one baselines per measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// List 0, 1, ..., n - 1
+static ll_node* build_list(size_t n) {
+    ll_node* head = NULL;
+    for (size_t i = n; i-- > 0; ) ll_push_front(&head, (int)i);
+    return head;
+}
+
+// Compare a list against an array, returns 1 if equal
+static int list_equals(ll_node* head, const int* values, size_t n) {
+    for (size_t i = 0; i < n; i++, head = ll_next(head)) {
+        if (!head || ll_get_data(head) != values[i]) return 0;
+    }
+    return head == NULL;
+}
+
+static int compare_position(const void* a, const void* b) {
+    const ll_edit* x = (const ll_edit*) a;
+    const ll_edit* y = (const ll_edit*) b;
+    return (x->position > y->position) - (x->position < y->position);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    if (n < 2 * MAX_BATCH || n > 100000000) {
+        printf("nodes must be in %d .. 100000000\n", 2 * MAX_BATCH);
+        return 1;
+    }
+
+    ll_edit* edits = (ll_edit*) malloc(MAX_BATCH * sizeof(ll_edit));
+    ll_edit* sorted = (ll_edit*) malloc(MAX_BATCH * sizeof(ll_edit));
+    int* expected = (int*) malloc((n + MAX_BATCH) * sizeof(int));
+    unsigned char* used = (unsigned char*) malloc(n + 2);
+    int* keys = (int*) malloc(MAX_BATCH * sizeof(int));
+    int* positions = (int*) malloc(MAX_BATCH * sizeof(int));
+    if (!edits || !sorted || !expected || !used || !keys || !positions) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    printf("Edits on a %zu-node list (total ms)\n", n);
+    printf("%8s %14s %14s %16s %9s %6s\n", "k", "batch", "batch sorted", "one-by-one", "speedup", "check");
+    for (size_t k = 10; k <= MAX_BATCH; k *= 10) {
+        // Distinct positions; deletes only hit existing nodes, inserts may append (position n + 1)
+        memset(used, 0, n + 2);
+        for (size_t i = 0; i < k; i++) {
+            int del = i & 1;
+            size_t p;
+            do p = 1 + next_random() % (del ? n : n + 1); while (used[p]);
+            used[p] = 1;
+            edits[i].position = (int)p;
+            edits[i].op = del ? LL_EDIT_DELETE : LL_EDIT_INSERT;
+            edits[i].value = -(int)i - 1;
+        }
+        memcpy(sorted, edits, k * sizeof(ll_edit));
+        qsort(sorted, k, sizeof(ll_edit), compare_position);
+
+        // Expected list: merge the original values with the sorted edits
+        size_t len = 0, e = 0;
+        for (size_t p = 1; p <= n + 1; p++) {
+            int deleted = 0;
+            for (; e < k && (size_t)sorted[e].position == p; e++) {
+                if (sorted[e].op == LL_EDIT_INSERT) expected[len++] = sorted[e].value;
+                else deleted = 1;
+            }
+            if (p <= n && !deleted) expected[len++] = (int)(p - 1);
+        }
+
+        // Batch, random order
+        ll_node* head = build_list(n);
+        double t0 = now_seconds();
+        int status = ll_apply_edits(&head, edits, k);
+        double batch_s = now_seconds() - t0;
+        int ok = status == 0 && list_equals(head, expected, len);
+        ll_free_list_with_allocator(&head, NULL);
+
+        // Batch, presorted
+        head = build_list(n);
+        t0 = now_seconds();
+        status = ll_apply_edits(&head, sorted, k);
+        double sorted_s = now_seconds() - t0;
+        ok &= status == 0 && list_equals(head, expected, len);
+        ll_free_list_with_allocator(&head, NULL);
+
+        // One-by-one on an evenly spread sample, highest position first (lower positions never move)
+        size_t sample = (size_t)(WALK_BUDGET / (n / 2));
+        if (sample > k) sample = k;
+        head = build_list(n);
+        t0 = now_seconds();
+        for (size_t s = sample; s-- > 0; ) {
+            const ll_edit* ed = &sorted[s * k / sample];
+            if (ed->op == LL_EDIT_INSERT) ll_insert_at(&head, ed->value, ed->position);
+            else ll_delete_at(&head, ed->position);
+        }
+        double single_s = (now_seconds() - t0) * (double)k / (double)sample;
+        if (sample == k) ok &= list_equals(head, expected, len);
+        ll_free_list_with_allocator(&head, NULL);
+
+        printf("%8zu %14.3f %14.3f %12.1f %3s %8.0fx %6s\n", k, batch_s * 1e3, sorted_s * 1e3,
+               single_s * 1e3, sample == k ? "" : "est", single_s / batch_s, ok ? "ok" : "MISMATCH");
+    }
+
+    printf("\nSearch on a %zu-node list (total ms, half of the keys present)\n", n);
+    printf("%8s %14s %16s %9s %6s\n", "k", "search_many", "ll_search", "speedup", "check");
+    ll_node* head = build_list(n);
+    for (size_t k = 10; k <= MAX_BATCH; k *= 10) {
+        for (size_t i = 0; i < k; i++) keys[i] = (int)(next_random() % n) + ((i & 1) ? (int)n : 0);
+
+        double t0 = now_seconds();
+        int found = ll_search_many(head, keys, k, positions);
+        double many_s = now_seconds() - t0;
+
+        // ll_search on a sample: a hit scans n / 2 nodes on average, a miss all n
+        size_t sample = (size_t)(WALK_BUDGET / n);
+        if (sample > k) sample = k;
+        int ok = found >= 0;
+        t0 = now_seconds();
+        for (size_t s = 0; s < sample; s++) {
+            size_t i = s * k / sample;
+            ok &= ll_search(head, keys[i]) == positions[i];
+        }
+        double single_s = (now_seconds() - t0) * (double)k / (double)sample;
+
+        printf("%8zu %14.3f %12.1f %3s %8.0fx %6s\n", k, many_s * 1e3, single_s * 1e3,
+               sample == k ? "" : "est", single_s / many_s, ok ? "ok" : "MISMATCH");
+    }
+    ll_free_list_with_allocator(&head, NULL);
+
+    free(edits);
+    free(sorted);
+    free(expected);
+    free(used);
+    free(keys);
+    free(positions);
+    return 0;
+}
@@ -36,5 +36,26 @@ int main(void) {
     ll_delete_at(&head, 2);
     ll_display(head);
 
+    // Batch edits: positions refer to the list before the batch, applied in one pass
+    ll_edit edits[] = {
+        { 3, LL_EDIT_INSERT, 40 },     // Append (the list has 2 nodes)
+        { 1, LL_EDIT_INSERT, 1 },
+        { 2, LL_EDIT_DELETE, 0 },
+        { 2, LL_EDIT_INSERT, 25 },
+    };
+    ll_apply_edits(&head, edits, 4);
+    ll_display(head);
+
+    // Many keys, one traversal
+    int keys[] = { 25, 40, 99, 1 };
+    int positions[4];
+    int found = ll_search_many(head, keys, 4, positions);
+    printf("Found %d of 4 keys:", found);
+    for (int i = 0; i < 4; i++)
+        printf(" %d@%d", keys[i], positions[i]);
+    printf("\n");
+
+    ll_free_list_with_allocator(&head, NULL);
+
     return 0;
 }
\ No newline at end of file
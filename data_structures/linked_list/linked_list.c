@@ -1,7 +1,10 @@
 #include "linked_list.h"
+#include "../fast_io/fast_io.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 
 // Node structure 14
 typedef struct ll_node {
@@ -9,9 +12,20 @@ typedef struct ll_node {
     struct ll_node* next;
 } ll_node;
 
+// Give a node back to its allocator
+static void ll_free_node(ll_node* node, const dsa_allocator* allocator) {
+    allocator->free(allocator->ctx, node, sizeof(ll_node));
+}
+
 // Create a new node
 ll_node* ll_create_node(int data) {
-    ll_node* newNode = (ll_node*) malloc(sizeof(ll_node));
+    return ll_create_node_with_allocator(data, NULL);
+}
+
+// Create a new node from an allocator
+ll_node* ll_create_node_with_allocator(int data, const dsa_allocator* allocator) {
+    allocator = dsa_allocator_or_default(allocator);
+    ll_node* newNode = (ll_node*) allocator->alloc(allocator->ctx, sizeof(ll_node), 0);
     if (!newNode) {
         printf("Memory allocation failed!\n");
         exit(1);
@@ -23,14 +37,22 @@ ll_node* ll_create_node(int data) {
 
 // Insert at beginning
 void ll_push_front(ll_node** headRef, int data) {
-    ll_node* newNode = ll_create_node(data);
+    ll_push_front_with_allocator(headRef, data, NULL);
+}
+
+void ll_push_front_with_allocator(ll_node** headRef, int data, const dsa_allocator* allocator) {
+    ll_node* newNode = ll_create_node_with_allocator(data, allocator);
     newNode->next = *headRef;
     *headRef = newNode;
 }
 
 // Insert at end
 void ll_push_back(ll_node** headRef, int data) {
-    ll_node* newNode = ll_create_node(data);
+    ll_push_back_with_allocator(headRef, data, NULL);
+}
+
+void ll_push_back_with_allocator(ll_node** headRef, int data, const dsa_allocator* allocator) {
+    ll_node* newNode = ll_create_node_with_allocator(data, allocator);
     if (*headRef == NULL) {
         *headRef = newNode;
         return;
@@ -43,21 +65,26 @@ void ll_push_back(ll_node** headRef, int data) {
 
 // Insert at specific position (1-based index)
 void ll_insert_at(ll_node** headRef, int data, int position) {
+    ll_insert_at_with_allocator(headRef, data, position, NULL);
+}
+
+void ll_insert_at_with_allocator(ll_node** headRef, int data, int position, const dsa_allocator* allocator) {
+    allocator = dsa_allocator_or_default(allocator);
     if (position < 1) {
         printf("Invalid position!\n");
         return;
     }
     if (position == 1) {
-        ll_push_front(headRef, data);
+        ll_push_front_with_allocator(headRef, data, allocator);
         return;
     }
-    ll_node* newNode = ll_create_node(data);
+    ll_node* newNode = ll_create_node_with_allocator(data, allocator);
     ll_node* temp = *headRef;
     for (int i = 1; temp != NULL && i < position - 1; i++)
         temp = temp->next;
     if (temp == NULL) {
         printf("Position out of range!\n");
-        free(newNode);
+        ll_free_node(newNode, allocator);
         return;
     }
     newNode->next = temp->next;
@@ -66,41 +93,54 @@ void ll_insert_at(ll_node** headRef, int data, int position) {
 
 // Delete at beginning
 void ll_pop_front(ll_node** headRef) {
+    ll_pop_front_with_allocator(headRef, NULL);
+}
+
+void ll_pop_front_with_allocator(ll_node** headRef, const dsa_allocator* allocator) {
     if (*headRef == NULL) {
         printf("List is empty!\n");
         return;
     }
     ll_node* temp = *headRef;
     *headRef = (*headRef)->next;
-    free(temp);
+    ll_free_node(temp, dsa_allocator_or_default(allocator));
 }
 
 // Delete at end
 void ll_pop_back(ll_node** headRef) {
+    ll_pop_back_with_allocator(headRef, NULL);
+}
+
+void ll_pop_back_with_allocator(ll_node** headRef, const dsa_allocator* allocator) {
+    allocator = dsa_allocator_or_default(allocator);
     if (*headRef == NULL) {
         printf("List is empty!\n");
         return;
     }
     if ((*headRef)->next == NULL) {
-        free(*headRef);
+        ll_free_node(*headRef, allocator);
         *headRef = NULL;
         return;
     }
     ll_node* temp = *headRef;
     while (temp->next->next != NULL)
         temp = temp->next;
-    free(temp->next);
+    ll_free_node(temp->next, allocator);
     temp->next = NULL;
 }
 
 // Delete at specific position
 void ll_delete_at(ll_node** headRef, int position) {
+    ll_delete_at_with_allocator(headRef, position, NULL);
+}
+
+void ll_delete_at_with_allocator(ll_node** headRef, int position, const dsa_allocator* allocator) {
     if (*headRef == NULL) {
         printf("List is empty!\n");
         return;
     }
     if (position == 1) {
-        ll_pop_front(headRef);
+        ll_pop_front_with_allocator(headRef, allocator);
         return;
     }
     ll_node* temp = *headRef;
@@ -112,7 +152,41 @@ void ll_delete_at(ll_node** headRef, int position) {
     }
     ll_node* delNode = temp->next;
     temp->next = temp->next->next;
-    free(delNode);
+    ll_free_node(delNode, dsa_allocator_or_default(allocator));
+}
+
+// Delete every node
+void ll_free_list_with_allocator(ll_node** headRef, const dsa_allocator* allocator) {
+    allocator = dsa_allocator_or_default(allocator);
+    ll_node* node = *headRef;
+    while (node != NULL) {
+        ll_node* next = node->next;
+        ll_free_node(node, allocator);
+        node = next;
+    }
+    *headRef = NULL;
+}
+
+// Build a list from an array
+ll_node* ll_from_array(const int* values, size_t count) {
+    return ll_from_array_with_allocator(values, count, NULL);
+}
+
+ll_node* ll_from_array_with_allocator(const int* values, size_t count, const dsa_allocator* allocator) {
+    if (values == NULL && count > 0) {
+        printf("ll_from_array: NULL values pointer\n");
+        return NULL;
+    }
+    allocator = dsa_allocator_or_default(allocator);
+
+    // Append through the link of the last node, so nodes are allocated in list order
+    ll_node* head = NULL;
+    ll_node** link = &head;
+    for (size_t i = 0; i < count; i++) {
+        *link = ll_create_node_with_allocator(values[i], allocator);
+        link = &(*link)->next;
+    }
+    return head;
 }
 
 // Search an element
@@ -133,12 +207,16 @@ void ll_display(ll_node* head) {
         printf("List is empty!\n");
         return;
     }
+    fio_writer w;
+    fio_writer_init(&w, stdout, NULL, 0);
     ll_node* temp = head;
     while (temp != NULL) {
-        printf("%d -> ", temp->data);
+        fio_put_int(&w, temp->data);
+        fio_put_bytes(&w, " -> ", 4);
         temp = temp->next;
     }
-    printf("NULL\n");
+    fio_put_bytes(&w, "NULL\n", 5);
+    fio_writer_flush(&w);
 }
 
 // Count nodes
@@ -149,4 +227,189 @@ int ll_count_nodes(ll_node* head) {
         head = head->next;
     }
     return count;
-}
\ No newline at end of file
+}
+
+// Next node (NULL at the end)
+ll_node* ll_next(const ll_node* node) {
+    return node ? node->next : NULL;
+}
+
+// Value of a node
+int ll_get_data(const ll_node* node) {
+    return node->data;
+}
+
+// Batch edit with its index in the caller's array, so sorting keeps equal positions in order
+typedef struct ll_indexed_edit {
+    ll_edit edit;
+    size_t index;
+} ll_indexed_edit;
+
+static int ll_compare_edits(const void* a, const void* b) {
+    const ll_indexed_edit* x = (const ll_indexed_edit*) a;
+    const ll_indexed_edit* y = (const ll_indexed_edit*) b;
+    if (x->edit.position != y->edit.position) return x->edit.position < y->edit.position ? -1 : 1;
+    return x->index < y->index ? -1 : (x->index > y->index);
+}
+
+// Apply a batch of edits (positions in the original list) in one pass
+int ll_apply_edits(ll_node** headRef, const ll_edit* edits, size_t count) {
+    return ll_apply_edits_with_allocator(headRef, edits, count, NULL);
+}
+
+int ll_apply_edits_with_allocator(ll_node** headRef, const ll_edit* edits, size_t count, const dsa_allocator* allocator) {
+    if (headRef == NULL || (edits == NULL && count > 0)) {
+        printf("ll_apply_edits: NULL pointer\n");
+        return -1;
+    }
+    allocator = dsa_allocator_or_default(allocator);
+
+    // Sort a copy unless the positions are already non-decreasing
+    size_t unsorted = 0;
+    for (size_t i = 1; i < count && !unsorted; i++)
+        unsorted = edits[i].position < edits[i - 1].position;
+    ll_edit* sorted = NULL;
+    if (unsorted) {
+        ll_indexed_edit* tagged = (ll_indexed_edit*) malloc(count * sizeof(ll_indexed_edit));
+        sorted = (ll_edit*) malloc(count * sizeof(ll_edit));
+        if (!tagged || !sorted) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        for (size_t i = 0; i < count; i++) {
+            tagged[i].edit = edits[i];
+            tagged[i].index = i;
+        }
+        qsort(tagged, count, sizeof(ll_indexed_edit), ll_compare_edits);
+        for (size_t i = 0; i < count; i++) sorted[i] = tagged[i].edit;
+        free(tagged);
+        edits = sorted;
+    }
+
+    // Reject what can be checked without walking: bad positions / ops and a node deleted twice
+    int status = 0;
+    int deleted = 0;     // A delete was seen at the current position
+    for (size_t i = 0; i < count && status == 0; i++) {
+        if (i > 0 && edits[i].position != edits[i - 1].position)
+            deleted = 0;
+        if (edits[i].position < 1 || (edits[i].op != LL_EDIT_INSERT && edits[i].op != LL_EDIT_DELETE)
+            || (edits[i].op == LL_EDIT_DELETE && deleted)) {
+            printf("ll_apply_edits: invalid edit at position %d\n", edits[i].position);
+            status = -1;
+        }
+        deleted |= edits[i].op == LL_EDIT_DELETE;
+    }
+
+    // Range check against the length (one walk, like the pass itself), so an error leaves the list unchanged:
+    // inserts may append at length + 1, deletes need an original node. Sorted, so only the last entries matter
+    if (status == 0 && count > 0) {
+        int length = ll_count_nodes(*headRef);
+        for (size_t i = count; i-- > 0 && edits[i].position > length; ) {
+            if (edits[i].position > length + 1 || edits[i].op == LL_EDIT_DELETE) {
+                printf("ll_apply_edits: position %d out of range!\n", edits[i].position);
+                status = -1;
+                break;
+            }
+        }
+    }
+
+    // One forward pass: link is the pointer to the original node at position pos (inserted nodes go
+    // in front of it, a delete unlinks it and moves on to the next original node)
+    ll_node** link = headRef;
+    int pos = 1;
+    for (size_t i = 0; i < count && status == 0; i++) {
+        const ll_edit* e = &edits[i];
+        while (pos < e->position) {
+            link = &(*link)->next;
+            pos++;
+        }
+
+        if (e->op == LL_EDIT_INSERT) {
+            ll_node* newNode = ll_create_node_with_allocator(e->value, allocator);
+            newNode->next = *link;
+            *link = newNode;
+            link = &newNode->next;
+        } else {
+            ll_node* delNode = *link;
+            *link = delNode->next;
+            ll_free_node(delNode, allocator);
+            pos++;
+        }
+    }
+
+    free(sorted);
+    return status;
+}
+
+// Key -> index of its first occurrence in the keys of ll_search_many (open addressing, linear probing)
+typedef struct ll_key_slot {
+    int key;
+    int index;      // -1 = empty slot
+} ll_key_slot;
+
+static size_t ll_key_probe(const ll_key_slot* table, size_t mask, int shift, int key) {
+    size_t s = (size_t)(((uint32_t)key * 0x9E3779B1u) >> shift) & mask;
+    while (table[s].index >= 0 && table[s].key != key)
+        s = (s + 1) & mask;
+    return s;
+}
+
+// Search many keys in one traversal
+int ll_search_many(ll_node* head, const int* keys, size_t count, int* positions) {
+    if ((keys == NULL || positions == NULL) && count > 0) {
+        printf("ll_search_many: NULL pointer\n");
+        return -1;
+    }
+    if (count > INT_MAX / 2) {
+        printf("ll_search_many: too many keys (%zu)\n", count);
+        return -1;
+    }
+    if (count == 0)
+        return 0;
+
+    // Table of at least 2 * count slots, indexed by the top bits of a multiplicative hash
+    size_t slots = 16;
+    int shift = 28;
+    while (slots < 2 * count) {
+        slots <<= 1;
+        shift--;
+    }
+    ll_key_slot* table = (ll_key_slot*) malloc(slots * sizeof(ll_key_slot));
+    if (!table) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t s = 0; s < slots; s++)
+        table[s].index = -1;
+
+    // Distinct keys still to be found
+    size_t pending = 0;
+    for (size_t i = 0; i < count; i++) {
+        positions[i] = -1;
+        size_t s = ll_key_probe(table, slots - 1, shift, keys[i]);
+        if (table[s].index < 0) {
+            table[s].key = keys[i];
+            table[s].index = (int)i;
+            pending++;
+        }
+    }
+
+    // Walk until every distinct key has its first position
+    int pos = 1;
+    for (ll_node* node = head; node != NULL && pending > 0; node = node->next, pos++) {
+        size_t s = ll_key_probe(table, slots - 1, shift, node->data);
+        if (table[s].index >= 0 && positions[table[s].index] == -1) {
+            positions[table[s].index] = pos;
+            pending--;
+        }
+    }
+
+    // Duplicate keys share the answer of their first occurrence
+    int found = 0;
+    for (size_t i = 0; i < count; i++) {
+        positions[i] = positions[table[ll_key_probe(table, slots - 1, shift, keys[i])].index];
+        found += positions[i] != -1;
+    }
+    free(table);
+    return found;
+}
@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include "../allocator/allocator.h"
 
 
 typedef struct ll_node ll_node;
@@ -76,5 +77,158 @@ void ll_display(ll_node* head);
  */
 int ll_count_nodes(ll_node* head);
 
+/**
+ * @brief Gets the node after the given one, for walking the list from outside.
+ * @param node Pointer to a node of the list.
+ * @return Pointer to the next node, or NULL at the end of the list (or if node is NULL).
+ */
+ll_node* ll_next(const ll_node* node);
+
+/**
+ * @brief Gets the value stored in a node.
+ * @param node Pointer to a node of the list (must not be NULL).
+ * @return The integer value of the node.
+ */
+int ll_get_data(const ll_node* node);
+
+/**
+ * @brief Builds a list holding values[0], ..., values[count - 1] in that order, in O(count).
+ * @param values Array of count values.
+ * @param count The number of values.
+ * @return Pointer to the head of the new list (NULL if count is 0).
+ */
+ll_node* ll_from_array(const int* values, size_t count);
+
+
+/*
+ * Batch operations: many edits or lookups done in one forward traversal instead of one walk from the
+ * head per item, so k items on an n-node list cost O(n + k log k) instead of O(n * k).
+ */
+
+typedef enum { LL_EDIT_INSERT, LL_EDIT_DELETE } ll_edit_op;
+
+typedef struct ll_edit {
+    int position;      // 1-based position in the list as it was before the batch
+    ll_edit_op op;
+    int value;         // Value to insert (ignored by deletes)
+} ll_edit;
+
+/**
+ * @brief Applies a batch of inserts and deletes in one forward pass.
+ *
+ * Positions refer to the list before the batch: an insert at p places its node before the original
+ * p-th node (p = length + 1 appends), a delete at p removes the original p-th node. Several inserts at
+ * the same position keep their order in the array. Entries may come in any order; if their positions
+ * are not non-decreasing they are sorted first (stable, on a copy).
+ * Every entry is checked (against the list length too) before the list is touched, so on error the
+ * list is unchanged.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param edits Array of count edits.
+ * @param count The number of edits.
+ * @return 0 on success, -1 on error (invalid position, two deletes of one node, or out of range) with
+ *         the list unchanged.
+ */
+int ll_apply_edits(ll_node** headRef, const ll_edit* edits, size_t count);
+
+/**
+ * @brief Searches for many keys in one traversal.
+ * @param head Pointer to the head of the list.
+ * @param keys Array of count keys to search for (duplicates allowed).
+ * @param count The number of keys.
+ * @param positions Output array: positions[i] receives the position (1-based) of the first node
+ *                  holding keys[i], or -1 if it is not in the list.
+ * @return The number of keys found, or -1 on error.
+ */
+int ll_search_many(ll_node* head, const int* keys, size_t count, int* positions);
+
+
+/*
+ * Allocator variants: the same operations with nodes allocated from and freed to `allocator`
+ * (NULL = libc, which is what the functions above use). A node must be freed with the allocator
+ * it was created with, so use one allocator per list.
+ */
+
+/**
+ * @brief Creates a new node with the given data, allocated from allocator.
+ * @param data The integer value to store in the node.
+ * @param allocator The allocator to take the node from (NULL for libc).
+ * @return Pointer to the newly created node.
+ */
+ll_node* ll_create_node_with_allocator(int data, const dsa_allocator* allocator);
+
+/**
+ * @brief Inserts a new node, allocated from allocator, at the beginning of the linked list.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param data The integer value to insert.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_push_front_with_allocator(ll_node** headRef, int data, const dsa_allocator* allocator);
+
+/**
+ * @brief Inserts a new node, allocated from allocator, at the end of the linked list.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param data The integer value to insert.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_push_back_with_allocator(ll_node** headRef, int data, const dsa_allocator* allocator);
+
+/**
+ * @brief Inserts a new node, allocated from allocator, at a specific position (1-based index).
+ * @param headRef Pointer to the head pointer of the list.
+ * @param data The integer value to insert.
+ * @param position The position (1-based) to insert the new node.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_insert_at_with_allocator(ll_node** headRef, int data, int position, const dsa_allocator* allocator);
+
+/**
+ * @brief Deletes the first node, returning it to allocator.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_pop_front_with_allocator(ll_node** headRef, const dsa_allocator* allocator);
+
+/**
+ * @brief Deletes the last node, returning it to allocator.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_pop_back_with_allocator(ll_node** headRef, const dsa_allocator* allocator);
+
+/**
+ * @brief Deletes the node at a specific position (1-based index), returning it to allocator.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param position The position (1-based) of the node to delete.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_delete_at_with_allocator(ll_node** headRef, int position, const dsa_allocator* allocator);
+
+/**
+ * @brief Deletes every node, returning them to allocator, and sets the head to NULL.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param allocator The allocator of the list (NULL for libc).
+ */
+void ll_free_list_with_allocator(ll_node** headRef, const dsa_allocator* allocator);
+
+/**
+ * @brief Builds a list from an array in O(count), nodes allocated from allocator in list order
+ *        (with an arena the nodes end up contiguous, in traversal order).
+ * @param values Array of count values.
+ * @param count The number of values.
+ * @param allocator The allocator of the list (NULL for libc).
+ * @return Pointer to the head of the new list (NULL if count is 0).
+ */
+ll_node* ll_from_array_with_allocator(const int* values, size_t count, const dsa_allocator* allocator);
+
+/**
+ * @brief Applies a batch of inserts and deletes in one forward pass, see ll_apply_edits.
+ * @param headRef Pointer to the head pointer of the list.
+ * @param edits Array of count edits.
+ * @param count The number of edits.
+ * @param allocator The allocator of the list (NULL for libc).
+ * @return 0 on success, -1 on error.
+ */
+int ll_apply_edits_with_allocator(ll_node** headRef, const ll_edit* edits, size_t count, const dsa_allocator* allocator);
+
 
 #endif
\ No newline at end of file
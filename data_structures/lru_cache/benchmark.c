@@ -0,0 +1,154 @@
+/*
+Cache benchmark: lru_cache (LRU and CLOCK) vs a linked-list LRU on Zipf-distributed keys.
+
+    Build: gcc -O2 benchmark.c lru_cache.c ../hash_map/hash_map.c ../linked_list/linked_list.c -lm -o lru_bench
+    Usage: ./lru_bench [universe=1000000] [ops=5000000]
+
+Keys are drawn from a Zipf distribution over `universe` keys (skew s = 0.8, 0.99, 1.2; ranks are
+scattered over the int range so popular keys aren't neighbours). Every operation is a get, followed by
+a put of the key on a miss. Caches hold 1% and 10% of the universe. Reported: ns per operation, hit ratio
+and evictions. The list LRU (ll_search, ll_delete_at + ll_push_front on a hit, ll_pop_back when full)
+scans up to `capacity` nodes per operation, so it only runs a budgeted prefix of the stream; an
+lru_cache LRU replays the same prefix and its hit count must match.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "lru_cache.h"
+#include "../linked_list/linked_list.h"
+
+#define LIST_BUDGET 300000000ull   // Node visits allowed for the list LRU per configuration
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Fill keys[0 .. ops) with Zipf(s) samples over `universe` ranks, sampled by binary search on the CDF
+static void zipf_stream(int* keys, size_t ops, size_t universe, double s, double* cdf) {
+    double sum = 0;
+    for (size_t r = 0; r < universe; r++) {
+        sum += 1.0 / pow((double)(r + 1), s);
+        cdf[r] = sum;
+    }
+    for (size_t i = 0; i < ops; i++) {
+        double u = (double)(next_random() >> 11) * 0x1.0p-53 * sum;
+        size_t lo = 0, hi = universe - 1;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (cdf[mid] < u) lo = mid + 1;
+            else hi = mid;
+        }
+        // Multiplying by an odd constant is a bijection mod 2^31: distinct ranks stay distinct keys
+        keys[i] = (int)(((uint32_t)lo * 2654435761u) & 0x7FFFFFFFu);
+    }
+}
+
+// Run the get / put-on-miss workload, returns elapsed seconds
+static double run_cache(lru_cache* cache, const int* keys, size_t ops) {
+    double t0 = now_seconds();
+    for (size_t i = 0; i < ops; i++) {
+        if (lru_get(cache, keys[i], NULL) != 0) lru_put(cache, keys[i], (int)i);
+    }
+    return now_seconds() - t0;
+}
+
+// Same workload on a linked list kept in recency order (front = most recent), returns hits
+static size_t run_list(const int* keys, size_t ops, size_t capacity, double* seconds) {
+    ll_node* head = NULL;
+    size_t length = 0, hits = 0;
+    double t0 = now_seconds();
+    for (size_t i = 0; i < ops; i++) {
+        int pos = ll_search(head, keys[i]);
+        if (pos > 0) {
+            hits++;
+            ll_delete_at(&head, pos);
+        } else if (length == capacity) {
+            ll_pop_back(&head);
+        } else {
+            length++;
+        }
+        ll_push_front(&head, keys[i]);
+    }
+    *seconds = now_seconds() - t0;
+    ll_free_list_with_allocator(&head, NULL);
+    return hits;
+}
+
+int main(int argc, char** argv) {
+    size_t universe = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    size_t ops = argc > 2 ? strtoull(argv[2], NULL, 10) : 5000000;
+    if (universe < 100 || ops == 0) {
+        printf("universe must be >= 100 and ops > 0\n");
+        return 1;
+    }
+
+    int* keys = (int*) malloc(ops * sizeof(int));
+    double* cdf = (double*) malloc(universe * sizeof(double));
+    if (!keys || !cdf) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    const double skews[] = { 0.8, 0.99, 1.2 };
+    const size_t percents[] = { 1, 10 };
+
+    printf("%6s %9s | %9s %7s %11s | %9s %7s %11s | %9s %8s %9s %6s\n", "skew", "capacity",
+           "LRU ns", "hit %", "evictions", "CLOCK ns", "hit %", "evictions", "list ns", "prefix", "hit %", "check");
+    for (size_t si = 0; si < sizeof(skews) / sizeof(skews[0]); si++) {
+        zipf_stream(keys, ops, universe, skews[si], cdf);
+
+        for (size_t pi = 0; pi < sizeof(percents) / sizeof(percents[0]); pi++) {
+            size_t capacity = universe * percents[pi] / 100;
+            lru_counters lru_stats_out, clock_stats_out;
+
+            lru_cache* lru = lru_create(capacity, CACHE_LRU);
+            double lru_s = run_cache(lru, keys, ops);
+            lru_stats(lru, &lru_stats_out);
+            lru_free(lru);
+
+            lru_cache* clock = lru_create(capacity, CACHE_CLOCK);
+            double clock_s = run_cache(clock, keys, ops);
+            lru_stats(clock, &clock_stats_out);
+            lru_free(clock);
+
+            // List LRU on a prefix, checked against lru_cache on the same prefix
+            size_t prefix = (size_t)(LIST_BUDGET / capacity);
+            if (prefix > ops) prefix = ops;
+            double list_s;
+            size_t list_hits = run_list(keys, prefix, capacity, &list_s);
+
+            lru_cache* ref = lru_create(capacity, CACHE_LRU);
+            lru_counters ref_stats;
+            run_cache(ref, keys, prefix);
+            lru_stats(ref, &ref_stats);
+            lru_free(ref);
+
+            printf("%6.2f %9zu | %9.1f %7.2f %11zu | %9.1f %7.2f %11zu | %9.1f %8zu %9.2f %6s\n",
+                   skews[si], capacity,
+                   lru_s * 1e9 / ops, 100.0 * lru_stats_out.hits / ops, lru_stats_out.evictions,
+                   clock_s * 1e9 / ops, 100.0 * clock_stats_out.hits / ops, clock_stats_out.evictions,
+                   list_s * 1e9 / prefix, prefix, 100.0 * list_hits / prefix,
+                   list_hits == ref_stats.hits ? "ok" : "MISMATCH");
+        }
+    }
+
+    free(keys);
+    free(cdf);
+    return 0;
+}
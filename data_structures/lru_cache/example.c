@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include "lru_cache.h"
+
+static void show(lru_cache* cache, const char* name, int key) {
+    int val;
+    if (lru_peek(cache, key, &val) == 0) printf("  %s: %d -> %d\n", name, key, val);
+    else printf("  %s: %d not cached\n", name, key);
+}
+
+int main(void) {
+
+    printf("\n\n============================| LRU CACHE EXAMPLE |============================\n\n");
+
+    // LRU: capacity 3
+    lru_cache* lru = lru_create(3, CACHE_LRU);
+    lru_put(lru, 1, 100);
+    lru_put(lru, 2, 200);
+    lru_put(lru, 3, 300);
+
+    int val;
+    if (lru_get(lru, 1, &val) == 0) printf("get(1) = %d (1 is now the most recent)\n", val);
+    lru_put(lru, 4, 400);   // Evicts 2, the least recently used
+    printf("After put(4) in a full cache:\n");
+    for (int k = 1; k <= 4; k++) show(lru, "LRU", k);
+
+    printf("put(3) again returns %d (overwritten)\n", lru_put(lru, 3, 333));
+    lru_remove(lru, 1);
+    printf("After remove(1): size %zu / capacity %zu\n", lru_size(lru), lru_capacity(lru));
+
+    if (lru_get(lru, 2, &val) != 0) printf("get(2) misses\n");
+
+    lru_counters stats;
+    lru_stats(lru, &stats);
+    printf("LRU stats: hits %zu, misses %zu, evictions %zu\n\n", stats.hits, stats.misses, stats.evictions);
+    lru_free(lru);
+
+    // CLOCK: referenced entries get a second chance
+    lru_cache* clock = lru_create(3, CACHE_CLOCK);
+    lru_put(clock, 1, 100);
+    lru_put(clock, 2, 200);
+    lru_put(clock, 3, 300);
+    lru_get(clock, 1, NULL);
+    lru_get(clock, 3, NULL);
+    lru_put(clock, 4, 400);   // 1 and 3 are referenced, so 2 goes
+    printf("CLOCK after referencing 1 and 3, then put(4):\n");
+    for (int k = 1; k <= 4; k++) show(clock, "CLOCK", k);
+
+    lru_stats(clock, &stats);
+    printf("CLOCK stats: hits %zu, misses %zu, evictions %zu\n", stats.hits, stats.misses, stats.evictions);
+    lru_free(clock);
+
+    return 0;
+}
@@ -0,0 +1,248 @@
+#include "lru_cache.h"
+#include "../hash_map/hash_map.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define LRU_NIL UINT32_MAX
+
+// CLOCK state of a node
+#define CLOCK_FREE 0
+#define CLOCK_LIVE 1
+#define CLOCK_REFERENCED 2
+
+/*
+* nodes[0 .. capacity) hold the entries; nodes[capacity] is the head of the LRU recency list
+* (circular: head.next is the most recent entry, head.prev the least recent). Unused nodes are
+* chained through next from free_head. CLOCK caches don't use prev / the recency list; their
+* state[] byte says whether a node is free, live, or live and referenced since the hand last passed.
+*/
+
+typedef struct lru_node {
+	int key;
+	int val;
+	uint32_t prev;
+	uint32_t next;
+} lru_node;
+
+typedef struct lru_cache {
+	lru_node* nodes;
+	uint8_t* state;         // CLOCK only
+	hash_map* index;        // key -> node index
+	uint32_t capacity;
+	uint32_t size;
+	uint32_t free_head;
+	uint32_t hand;          // CLOCK only: next node to examine
+	cache_policy policy;
+	lru_counters counters;
+} lru_cache;
+
+
+static inline void lru_unlink(lru_cache* c, uint32_t i) {
+	lru_node* n = &c->nodes[i];
+	c->nodes[n->prev].next = n->next;
+	c->nodes[n->next].prev = n->prev;
+}
+
+static inline void lru_link_front(lru_cache* c, uint32_t i) {
+	uint32_t head = c->capacity;
+	lru_node* n = &c->nodes[i];
+	n->prev = head;
+	n->next = c->nodes[head].next;
+	c->nodes[n->next].prev = i;
+	c->nodes[head].next = i;
+}
+
+// Mark node i as just used
+static inline void lru_touch(lru_cache* c, uint32_t i) {
+	if (c->policy == CACHE_CLOCK) {
+		c->state[i] = CLOCK_REFERENCED;
+	} else if (c->nodes[c->capacity].next != i) {
+		lru_unlink(c, i);
+		lru_link_front(c, i);
+	}
+}
+
+// Pick the node to evict: the back of the recency list, or the first unreferenced node under the hand
+static uint32_t lru_victim(lru_cache* c) {
+	if (c->policy == CACHE_LRU) return c->nodes[c->capacity].prev;
+
+	for (;;) {
+		uint32_t i = c->hand;
+		c->hand = c->hand + 1 == c->capacity ? 0 : c->hand + 1;
+		if (c->state[i] == CLOCK_LIVE) return i;
+		if (c->state[i] == CLOCK_REFERENCED) c->state[i] = CLOCK_LIVE;   // Second chance
+	}
+}
+
+// Take node i out of the cache structure (list / clock) and put it on the free list
+static void lru_release_node(lru_cache* c, uint32_t i) {
+	if (c->policy == CACHE_LRU) lru_unlink(c, i);
+	else c->state[i] = CLOCK_FREE;
+	c->nodes[i].next = c->free_head;
+	c->free_head = i;
+	c->size--;
+}
+
+
+lru_cache* lru_create(size_t capacity, cache_policy policy) {
+	// Validate input parameters: capacity and policy
+	if (capacity == 0 || capacity > (size_t)INT32_MAX - 1) {   // Node indices are stored as int in the index
+		printf("lru_create: capacity must be in 1 .. 2^31 - 2 (capacity=%zu)\n", capacity);
+		return NULL;
+	}
+	if (policy != CACHE_LRU && policy != CACHE_CLOCK) {
+		printf("lru_create: unknown policy %d\n", (int)policy);
+		return NULL;
+	}
+
+	// Memory allocation: lru_cache struct
+	lru_cache* c = (lru_cache*) malloc(sizeof(lru_cache));
+	if (!c) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct lru_cache!\n");
+		exit(1);
+	}
+
+	// Memory allocation: nodes (+1 for the list head), CLOCK states, and an index that never needs to grow
+	c->nodes = (lru_node*) malloc(sizeof(lru_node) * (capacity + 1));
+	c->state = policy == CACHE_CLOCK ? (uint8_t*) calloc(capacity, 1) : NULL;
+	if (!c->nodes || (policy == CACHE_CLOCK && !c->state)) {
+		printf("Memory allocation failed: couldn't allocate %zu cache nodes\n", capacity);
+		exit(1);
+	}
+	c->index = hm_create(capacity, 0);
+
+	c->capacity = (uint32_t)capacity;
+	c->size = 0;
+	c->hand = 0;
+	c->policy = policy;
+	c->counters = (lru_counters){ 0, 0, 0 };
+
+	// Empty recency list, every node free
+	c->nodes[capacity].prev = c->nodes[capacity].next = (uint32_t)capacity;
+	for (uint32_t i = 0; i < c->capacity; i++) c->nodes[i].next = i + 1 < c->capacity ? i + 1 : LRU_NIL;
+	c->free_head = 0;
+	return c;
+}
+
+
+int lru_get(lru_cache* cache, int key, int* out) {
+	// Validate input parameter: cache
+	if (!cache) {
+		printf("lru_get: NULL cache pointer\n");
+		return -1;
+	}
+
+	int i;
+	if (hm_get(cache->index, key, &i) != 0) {
+		cache->counters.misses++;
+		return -1;
+	}
+	cache->counters.hits++;
+	lru_touch(cache, (uint32_t)i);
+	if (out) *out = cache->nodes[i].val;
+	return 0;
+}
+
+
+int lru_peek(const lru_cache* cache, int key, int* out) {
+	// Validate input parameter: cache
+	if (!cache) {
+		printf("lru_peek: NULL cache pointer\n");
+		return -1;
+	}
+
+	int i;
+	if (hm_get(cache->index, key, &i) != 0) return -1;
+	if (out) *out = cache->nodes[i].val;
+	return 0;
+}
+
+
+int lru_put(lru_cache* cache, int key, int val) {
+	// Validate input parameter: cache
+	if (!cache) {
+		printf("lru_put: NULL cache pointer\n");
+		return -1;
+	}
+
+	// Present: overwrite in place
+	int* slot = hm_find(cache->index, key);
+	if (slot) {
+		cache->nodes[*slot].val = val;
+		lru_touch(cache, (uint32_t)*slot);
+		return 1;
+	}
+
+	// Full: evict to free a node
+	if (cache->size == cache->capacity) {
+		uint32_t victim = lru_victim(cache);
+		hm_remove(cache->index, cache->nodes[victim].key);
+		lru_release_node(cache, victim);
+		cache->counters.evictions++;
+	}
+
+	// Take a free node; new entries start as most recent (LRU) / unreferenced (CLOCK)
+	uint32_t i = cache->free_head;
+	cache->free_head = cache->nodes[i].next;
+	cache->nodes[i].key = key;
+	cache->nodes[i].val = val;
+	if (cache->policy == CACHE_LRU) lru_link_front(cache, i);
+	else cache->state[i] = CLOCK_LIVE;
+	hm_put(cache->index, key, (int)i);
+	cache->size++;
+	return 0;
+}
+
+
+int lru_remove(lru_cache* cache, int key) {
+	// Validate input parameter: cache
+	if (!cache) {
+		printf("lru_remove: NULL cache pointer\n");
+		return -1;
+	}
+
+	int i;
+	if (hm_get(cache->index, key, &i) != 0) return -1;
+	hm_remove(cache->index, key);
+	lru_release_node(cache, (uint32_t)i);
+	return 0;
+}
+
+
+void lru_stats(const lru_cache* cache, lru_counters* out) {
+	// Validate input parameters: cache and out
+	if (!cache || !out) {
+		printf("lru_stats: NULL pointer\n");
+		return;
+	}
+
+	*out = cache->counters;
+}
+
+
+void lru_reset_stats(lru_cache* cache) {
+	if (cache) cache->counters = (lru_counters){ 0, 0, 0 };
+}
+
+
+size_t lru_size(const lru_cache* cache) {
+	return cache ? cache->size : 0;
+}
+
+
+size_t lru_capacity(const lru_cache* cache) {
+	return cache ? cache->capacity : 0;
+}
+
+
+void lru_free(lru_cache* cache) {
+	// Validate input parameter: cache
+	if (!cache) return;
+
+	hm_free(cache->index);
+	free(cache->nodes);
+	free(cache->state);
+	free(cache);
+}
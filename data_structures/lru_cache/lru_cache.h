@@ -0,0 +1,72 @@
+#ifndef DSA_LRU_CACHE_H
+#define DSA_LRU_CACHE_H
+
+
+#include <stddef.h>
+
+
+/*
+* Fixed-capacity key -> value cache (int keys and values) with O(1) get / put and eviction.
+* Entries live in one preallocated node array, linked by 32-bit indices instead of pointers; a hash_map
+* (open addressing) maps each key to its node index. Nothing is allocated after creation.
+*
+* Policies:
+*   CACHE_LRU   - the nodes form a doubly linked recency list; a hit moves the node to the front and
+*                 the back node is evicted.
+*   CACHE_CLOCK - second-chance approximation of LRU: a hit only sets the node's reference bit, and
+*                 eviction sweeps a hand over the nodes, clearing set bits until it finds a clear one.
+*                 Hits write one byte instead of relinking two nodes.
+*
+* Hit / miss / eviction counters are kept for every cache (see lru_stats).
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct lru_cache lru_cache;
+
+typedef enum { CACHE_LRU, CACHE_CLOCK } cache_policy;
+
+typedef struct lru_counters {
+	size_t hits;        // lru_get calls that found the key
+	size_t misses;      // lru_get calls that didn't
+	size_t evictions;   // Entries dropped by lru_put to make room
+} lru_counters;
+
+// Create a cache holding up to capacity entries (1 .. 2^31 - 2)
+lru_cache* lru_create(size_t capacity, cache_policy policy);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Look up key and mark it used - returns 0 and stores the value in *out (if out != NULL) on a hit, -1 on a miss
+int lru_get(lru_cache* cache, int key, int* out);
+
+// Look up key without marking it used or counting a hit / miss - returns 0 if found else -1
+int lru_peek(const lru_cache* cache, int key, int* out);
+
+// Insert or overwrite key -> val and mark it used, evicting an entry if the cache is full.
+// Returns 0 if inserted, 1 if an existing value was overwritten, -1 on error
+int lru_put(lru_cache* cache, int key, int val);
+
+// Remove key - returns 0 if removed else -1 (not present)
+int lru_remove(lru_cache* cache, int key);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Copy the hit / miss / eviction counters into *out
+void lru_stats(const lru_cache* cache, lru_counters* out);
+
+// Set the counters back to 0
+void lru_reset_stats(lru_cache* cache);
+
+// Get the current no. of entries
+size_t lru_size(const lru_cache* cache);
+
+// Get the capacity
+size_t lru_capacity(const lru_cache* cache);
+
+// Delete the cache
+void lru_free(lru_cache* cache);
+
+
+#endif /* DSA_LRU_CACHE_H */
@@ -0,0 +1,249 @@
+/*
+Matrix multiply and transpose: matrix (one aligned buffer, packed and register-blocked kernels) vs
+int** / float** jagged arrays with the textbook loops.
+
+    Build: gcc -O2 -pthread benchmark.c matrix.c -o matrix_bench
+    Usage: ./matrix_bench [max_n=2048] [threads=online CPUs]
+
+For n = 32, 64, ... max_n (three n x n matrices of 4-byte elements: 12 KB at n = 32 fits L1, 192 KB
+at n = 128 spills it, 3 MB at n = 512 spills L2, 48 MB at n = 2048 and up spills most L3s) reports
+    multiply   : GFLOP/s (2n^3 operations; GOP/s for int) of the jagged i-j-k loop, mat_multiply on
+                 one thread and on `threads` threads
+    transpose  : GB/s (bytes read + written) of the jagged loop vs mat_transpose
+The jagged multiply only runs while n^3 <= NAIVE_BUDGET. Elements are small integers so float sums
+are exact; results are compared with the jagged one (or sampled dot products above the budget)
+and the row is marked "ok" when they agree.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "matrix.h"
+
+#define NAIVE_BUDGET  (1ull << 30)   // Largest n^3 for the jagged multiply
+#define MIN_SECONDS   0.2            // Repeat each measurement until it took this long
+#define SAMPLES       64             // Dot products checked when the jagged multiply is skipped
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Jagged n x n matrix: one allocation per row, as the code it replaces does it
+static void** jagged_create(size_t n) {
+    void** rows = (void**) malloc(sizeof(void*) * n);
+    if (!rows) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < n; i++) {
+        rows[i] = calloc(n, 4);
+        if (!rows[i]) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+    }
+    return rows;
+}
+
+static void jagged_free(void** rows, size_t n) {
+    for (size_t i = 0; i < n; i++) free(rows[i]);
+    free(rows);
+}
+
+static void naive_multiply_int(int** c, int** a, int** b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            int sum = 0;
+            for (size_t k = 0; k < n; k++) sum += a[i][k] * b[k][j];
+            c[i][j] = sum;
+        }
+    }
+}
+
+static void naive_multiply_float(float** c, float** a, float** b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            float sum = 0;
+            for (size_t k = 0; k < n; k++) sum += a[i][k] * b[k][j];
+            c[i][j] = sum;
+        }
+    }
+}
+
+static void naive_transpose(int** dst, int** src, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) dst[j][i] = src[i][j];
+    }
+}
+
+// Element (i, j) of m as a double, either type
+static double element(matrix* m, size_t i, size_t j) {
+    return mat_elem_type(m) == MAT_INT ? (double)mat_get_int(m, i, j) : (double)mat_get_float(m, i, j);
+}
+
+// Returns 1 if c matches the jagged result (or, without one, SAMPLES recomputed dot products)
+static int check_product(matrix* c, matrix* a, matrix* b, void** naive, size_t n) {
+    int is_int = mat_elem_type(c) == MAT_INT;
+    if (naive) {
+        for (size_t i = 0; i < n; i++) {
+            const void* row = is_int ? (const void*)mat_row_int(c, i) : (const void*)mat_row_float(c, i);
+            if (memcmp(row, naive[i], n * 4) != 0) return 0;
+        }
+        return 1;
+    }
+    for (int s = 0; s < SAMPLES; s++) {
+        size_t i = next_random() % n, j = next_random() % n;
+        double sum = 0;
+        for (size_t k = 0; k < n; k++) sum += element(a, i, k) * element(b, k, j);
+        if (sum != element(c, i, j)) return 0;
+    }
+    return 1;
+}
+
+// Seconds per call of mat_multiply, repeated until MIN_SECONDS have passed
+static double time_multiply(matrix* c, matrix* a, matrix* b, int threads) {
+    int reps = 0;
+    double t0 = now_seconds(), elapsed;
+    do {
+        mat_multiply(c, a, b, threads);
+        reps++;
+        elapsed = now_seconds() - t0;
+    } while (elapsed < MIN_SECONDS);
+    return elapsed / reps;
+}
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? strtoull(argv[1], NULL, 10) : 2048;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = argc > 2 ? atoi(argv[2]) : (online > 0 ? (int)online : 1);
+
+    printf("multiply: GFLOP/s (GOP/s for int), %d threads\n", threads);
+    printf("%6s %6s %9s | %9s %9s %9s %8s | %6s\n", "type", "n", "data MB", "jagged", "1 thread", "threads", "speedup", "check");
+    for (int t = 0; t < 2; t++) {
+        mat_type type = t == 0 ? MAT_INT : MAT_FLOAT;
+        for (size_t n = 32; n <= max_n; n *= 2) {
+            matrix* a = mat_create(n, n, type);
+            matrix* b = mat_create(n, n, type);
+            matrix* c = mat_create(n, n, type);
+            void** ja = jagged_create(n);
+            void** jb = jagged_create(n);
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < n; j++) {
+                    int x = (int)(next_random() % 8), y = (int)(next_random() % 8);
+                    if (type == MAT_INT) {
+                        mat_set_int(a, i, j, x);
+                        mat_set_int(b, i, j, y);
+                        ((int*)ja[i])[j] = x;
+                        ((int*)jb[i])[j] = y;
+                    } else {
+                        mat_set_float(a, i, j, (float)x);
+                        mat_set_float(b, i, j, (float)y);
+                        ((float*)ja[i])[j] = (float)x;
+                        ((float*)jb[i])[j] = (float)y;
+                    }
+                }
+            }
+            double ops = 2.0 * (double)n * (double)n * (double)n;
+
+            // Jagged baseline, within budget
+            void** jc = NULL;
+            double naive_s = 0;
+            if ((uint64_t)n * n * n <= NAIVE_BUDGET) {
+                jc = jagged_create(n);
+                int reps = 0;
+                double t0 = now_seconds();
+                do {
+                    if (type == MAT_INT) naive_multiply_int((int**)jc, (int**)ja, (int**)jb, n);
+                    else naive_multiply_float((float**)jc, (float**)ja, (float**)jb, n);
+                    reps++;
+                    naive_s = now_seconds() - t0;
+                } while (naive_s < MIN_SECONDS);
+                naive_s /= reps;
+            }
+
+            double single_s = time_multiply(c, a, b, 1);
+            int ok = check_product(c, a, b, jc, n);
+            double multi_s = time_multiply(c, a, b, threads);
+            ok &= check_product(c, a, b, jc, n);
+
+            char naive_text[16] = "-", speedup_text[16] = "-";
+            if (jc) {
+                snprintf(naive_text, sizeof(naive_text), "%.2f", ops / naive_s * 1e-9);
+                snprintf(speedup_text, sizeof(speedup_text), "%.1fx", naive_s / single_s);
+            }
+            printf("%6s %6zu %9.2f | %9s %9.2f %9.2f %8s | %6s\n", type == MAT_INT ? "int" : "float", n,
+                   3.0 * (double)n * (double)n * 4 / 1e6, naive_text, ops / single_s * 1e-9, ops / multi_s * 1e-9,
+                   speedup_text, ok ? "ok" : "MISMATCH");
+
+            if (jc) jagged_free(jc, n);
+            jagged_free(ja, n);
+            jagged_free(jb, n);
+            mat_free(a);
+            mat_free(b);
+            mat_free(c);
+        }
+    }
+
+    printf("\ntranspose: GB/s (bytes read + written)\n");
+    printf("%6s %9s | %9s %9s %8s | %6s\n", "n", "data MB", "jagged", "matrix", "speedup", "check");
+    for (size_t n = 32; n <= 2 * max_n; n *= 2) {
+        matrix* src = mat_create(n, n, MAT_INT);
+        matrix* dst = mat_create(n, n, MAT_INT);
+        void** jsrc = jagged_create(n);
+        void** jdst = jagged_create(n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                int v = (int)next_random();
+                mat_set_int(src, i, j, v);
+                ((int*)jsrc[i])[j] = v;
+            }
+        }
+        double bytes = 2.0 * (double)n * (double)n * 4;
+
+        int reps = 0;
+        double t0 = now_seconds(), naive_s;
+        do {
+            naive_transpose((int**)jdst, (int**)jsrc, n);
+            reps++;
+            naive_s = now_seconds() - t0;
+        } while (naive_s < MIN_SECONDS);
+        naive_s /= reps;
+
+        reps = 0;
+        t0 = now_seconds();
+        double blocked_s;
+        do {
+            mat_transpose(dst, src);
+            reps++;
+            blocked_s = now_seconds() - t0;
+        } while (blocked_s < MIN_SECONDS);
+        blocked_s /= reps;
+
+        int ok = 1;
+        for (size_t i = 0; i < n && ok; i++) ok = memcmp(mat_row_int(dst, i), jdst[i], n * 4) == 0;
+        printf("%6zu %9.2f | %9.2f %9.2f %7.1fx | %6s\n", n, bytes / 1e6, bytes / naive_s * 1e-9, bytes / blocked_s * 1e-9,
+               naive_s / blocked_s, ok ? "ok" : "MISMATCH");
+
+        jagged_free(jsrc, n);
+        jagged_free(jdst, n);
+        mat_free(src);
+        mat_free(dst);
+    }
+    return 0;
+}
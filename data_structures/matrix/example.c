@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include "matrix.h"
+
+int main(void) {
+
+    printf("\n\n============================| MATRIX EXAMPLE |============================\n\n");
+
+    // 2 x 3 int matrix filled through row pointers (rows are contiguous, stride >= cols)
+    matrix* a = mat_create(2, 3, MAT_INT);
+    for (size_t i = 0; i < mat_rows(a); i++) {
+        int* row = mat_row_int(a, i);
+        for (size_t j = 0; j < mat_cols(a); j++) row[j] = (int)(i * 3 + j + 1);
+    }
+    printf("A:\n");
+    mat_display(a);
+
+    // Transpose into a 3 x 2 matrix, then multiply A * A^T
+    matrix* at = mat_create(3, 2, MAT_INT);
+    mat_transpose(at, a);
+    printf("A^T:\n");
+    mat_display(at);
+
+    matrix* product = mat_create(2, 2, MAT_INT);
+    mat_multiply(product, a, at, 1);
+    printf("A * A^T:\n");
+    mat_display(product);
+
+    // A view shares the buffer: writing through it changes the parent
+    matrix* grid = mat_create(4, 4, MAT_FLOAT);
+    matrix* centre = mat_view(grid, 1, 1, 2, 2);
+    mat_set_float(centre, 0, 0, 1.5f);
+    mat_set_float(centre, 1, 1, -2.25f);
+    printf("4 x 4 grid after writing to its 2 x 2 centre view:\n");
+    mat_display(grid);
+
+    // Shape errors are reported and nothing is computed
+    if (mat_multiply(product, a, a, 1) != 0) printf("2 x 3 times 2 x 3 was rejected\n");
+
+    mat_free(centre);
+    mat_free(grid);
+    mat_free(product);
+    mat_free(at);
+    mat_free(a);
+    return 0;
+}
@@ -0,0 +1,613 @@
+#include "matrix.h"
+#include "../fast_io/fast_io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+#define MAT_ALIGNMENT 64            // Buffer alignment (one cache line)
+#define MAT_LINE_ELEMS 16           // Elements per cache line: strides are a multiple of this
+#define MAT_PAGE 4096               // Strides that are a multiple of this get one more line of padding
+#define MAT_TRANSPOSE_TILE 32       // mat_transpose works on TILE x TILE blocks
+
+#define MAT_MR 4                    // Rows of C per register block
+#define MAT_NR 8                    // Columns of C per register block (two SSE registers)
+#define MAT_KC 256                  // Depth of a packed block of B
+#define MAT_NC 256                  // Columns of B packed at once: KC x NC x 4 bytes = 256 KB, sized for L2
+#define MAT_THREAD_WORK (1u << 22)  // Multiply-adds per thread below which starting another one doesn't pay
+
+_Static_assert(sizeof(int) == 4 && sizeof(float) == 4, "matrix elements are 4 bytes");
+#define MAT_ELEM_SIZE 4
+
+/*
+* Every matrix (and view) points at a mat_storage holding the buffer and the no. of matrices
+* using it. data is element (0, 0) of this matrix, so a view is just another data pointer with
+* fewer rows / cols and the stride of the matrix it was taken from.
+*/
+typedef struct mat_storage {
+	void* buffer;
+	size_t bytes;
+	_Atomic size_t users;
+} mat_storage;
+
+typedef struct matrix {
+	char* data;
+	size_t rows;
+	size_t cols;
+	size_t stride;
+	mat_type type;
+	mat_storage* storage;
+	const dsa_allocator* allocator;   // Struct, storage and buffer all come from here
+} matrix;
+
+
+// Address of element (row, col)
+static inline char* mat_elem(const matrix* m, size_t row, size_t col) {
+	return m->data + (row * m->stride + col) * MAT_ELEM_SIZE;
+}
+
+// Row stride for cols elements: whole cache lines, and not a multiple of the page size (such strides
+// put every element of a column in the same few cache sets)
+static size_t mat_padded_stride(size_t cols) {
+	size_t stride = (cols + MAT_LINE_ELEMS - 1) / MAT_LINE_ELEMS * MAT_LINE_ELEMS;
+	if (stride * MAT_ELEM_SIZE % MAT_PAGE == 0) stride += MAT_LINE_ELEMS;
+	return stride;
+}
+
+// Allocate the struct from the allocator. Exits on failure
+static matrix* mat_alloc_struct(const dsa_allocator* allocator) {
+	matrix* m = (matrix*) allocator->alloc(allocator->ctx, sizeof(matrix), 0);
+	if (!m) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct matrix!\n");
+		exit(1);
+	}
+	m->allocator = allocator;
+	return m;
+}
+
+
+matrix* mat_create(size_t rows, size_t cols, mat_type type) {
+	return mat_create_with_allocator(rows, cols, type, NULL);
+}
+
+
+matrix* mat_create_with_allocator(size_t rows, size_t cols, mat_type type, const dsa_allocator* allocator) {
+	// Validate input parameters: rows, cols and type
+	if (rows == 0 || cols == 0 || (type != MAT_INT && type != MAT_FLOAT)) {
+		printf("mat_create: need rows > 0, cols > 0 and a valid type (rows=%zu, cols=%zu)\n", rows, cols);
+		return NULL;
+	}
+	size_t stride = mat_padded_stride(cols);
+	if (stride > SIZE_MAX / MAT_ELEM_SIZE / rows) {
+		printf("mat_create: %zu x %zu elements don't fit in memory\n", rows, cols);
+		return NULL;
+	}
+
+	// Memory allocation: matrix struct, storage and the aligned buffer
+	allocator = dsa_allocator_or_default(allocator);
+	matrix* m = mat_alloc_struct(allocator);
+	mat_storage* storage = (mat_storage*) allocator->alloc(allocator->ctx, sizeof(mat_storage), 0);
+	size_t bytes = rows * stride * MAT_ELEM_SIZE;
+	void* buffer = storage ? allocator->alloc(allocator->ctx, bytes, MAT_ALIGNMENT) : NULL;
+	if (!buffer) {
+		printf("Memory allocation failed: couldn't allocate memory for a %zu x %zu matrix\n", rows, cols);
+		exit(1);
+	}
+	memset(buffer, 0, bytes);
+	storage->buffer = buffer;
+	storage->bytes = bytes;
+	atomic_init(&storage->users, 1);
+
+	// Initialize struct members
+	m->data = (char*)buffer;
+	m->rows = rows;
+	m->cols = cols;
+	m->stride = stride;
+	m->type = type;
+	m->storage = storage;
+	return m;
+}
+
+
+matrix* mat_view(matrix* m, size_t row, size_t col, size_t rows, size_t cols) {
+	// Validate input parameters: m and the window
+	if (!m) {
+		printf("mat_view: NULL matrix pointer\n");
+		return NULL;
+	}
+	if (rows == 0 || cols == 0 || row > m->rows || rows > m->rows - row || col > m->cols || cols > m->cols - col) {
+		printf("mat_view: %zu x %zu at (%zu, %zu) is not inside a %zu x %zu matrix\n", rows, cols, row, col, m->rows, m->cols);
+		return NULL;
+	}
+
+	// Memory allocation: matrix struct (views use the allocator of their source)
+	matrix* view = mat_alloc_struct(m->allocator);
+	atomic_fetch_add_explicit(&m->storage->users, 1, memory_order_relaxed);
+	view->data = mat_elem(m, row, col);
+	view->rows = rows;
+	view->cols = cols;
+	view->stride = m->stride;
+	view->type = m->type;
+	view->storage = m->storage;
+	return view;
+}
+
+
+void mat_free(matrix* m) {
+	// Validate input parameter: m
+	if (!m) return;
+
+	// The last user frees the buffer
+	const dsa_allocator* allocator = m->allocator;
+	mat_storage* storage = m->storage;
+	if (atomic_fetch_sub_explicit(&storage->users, 1, memory_order_acq_rel) == 1) {
+		allocator->free(allocator->ctx, storage->buffer, storage->bytes);
+		allocator->free(allocator->ctx, storage, sizeof(mat_storage));
+	}
+	allocator->free(allocator->ctx, m, sizeof(matrix));
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+size_t mat_rows(const matrix* m) {
+	return m ? m->rows : 0;
+}
+
+size_t mat_cols(const matrix* m) {
+	return m ? m->cols : 0;
+}
+
+size_t mat_stride(const matrix* m) {
+	return m ? m->stride : 0;
+}
+
+mat_type mat_elem_type(const matrix* m) {
+	return m ? m->type : MAT_INT;
+}
+
+
+// Validate m, its type and (row, col) for an element access by func - returns 0 if valid else -1
+static int mat_check(const matrix* m, mat_type type, size_t row, size_t col, const char* func) {
+	if (!m) {
+		printf("%s: NULL matrix pointer\n", func);
+		return -1;
+	}
+	if (m->type != type) {
+		printf("%s: wrong element type for this matrix\n", func);
+		return -1;
+	}
+	if (row >= m->rows || col >= m->cols) {
+		printf("%s: (%zu, %zu) out of range for a %zu x %zu matrix\n", func, row, col, m->rows, m->cols);
+		return -1;
+	}
+	return 0;
+}
+
+int* mat_row_int(matrix* m, size_t row) {
+	if (mat_check(m, MAT_INT, row, 0, "mat_row_int") != 0) return NULL;
+	return (int*)mat_elem(m, row, 0);
+}
+
+float* mat_row_float(matrix* m, size_t row) {
+	if (mat_check(m, MAT_FLOAT, row, 0, "mat_row_float") != 0) return NULL;
+	return (float*)mat_elem(m, row, 0);
+}
+
+int mat_get_int(const matrix* m, size_t row, size_t col) {
+	if (mat_check(m, MAT_INT, row, col, "mat_get_int") != 0) return 0;
+	return *(const int*)mat_elem(m, row, col);
+}
+
+float mat_get_float(const matrix* m, size_t row, size_t col) {
+	if (mat_check(m, MAT_FLOAT, row, col, "mat_get_float") != 0) return 0;
+	return *(const float*)mat_elem(m, row, col);
+}
+
+int mat_set_int(matrix* m, size_t row, size_t col, int val) {
+	if (mat_check(m, MAT_INT, row, col, "mat_set_int") != 0) return -1;
+	*(int*)mat_elem(m, row, col) = val;
+	return 0;
+}
+
+int mat_set_float(matrix* m, size_t row, size_t col, float val) {
+	if (mat_check(m, MAT_FLOAT, row, col, "mat_set_float") != 0) return -1;
+	*(float*)mat_elem(m, row, col) = val;
+	return 0;
+}
+
+
+void mat_zero(matrix* m) {
+	// Validate input parameter: m
+	if (!m) {
+		printf("mat_zero: NULL matrix pointer\n");
+		return;
+	}
+	for (size_t i = 0; i < m->rows; i++) memset(mat_elem(m, i, 0), 0, m->cols * MAT_ELEM_SIZE);
+}
+
+
+// Returns 1 if a and b are non-NULL with the same shape and type else 0 (with a message from func)
+static int mat_same_shape(const matrix* a, const matrix* b, const char* func) {
+	if (!a || !b) {
+		printf("%s: NULL matrix pointer\n", func);
+		return 0;
+	}
+	if (a->type != b->type || a->rows != b->rows || a->cols != b->cols) {
+		printf("%s: matrices differ in shape or type (%zu x %zu vs %zu x %zu)\n", func, a->rows, a->cols, b->rows, b->cols);
+		return 0;
+	}
+	return 1;
+}
+
+int mat_copy(matrix* dst, const matrix* src) {
+	// Validate input parameters: dst and src
+	if (!mat_same_shape(dst, src, "mat_copy")) return -1;
+
+	// Row by row: the strides may differ (e.g. copying into a view)
+	for (size_t i = 0; i < src->rows; i++) memmove(mat_elem(dst, i, 0), mat_elem(src, i, 0), src->cols * MAT_ELEM_SIZE);
+	return 0;
+}
+
+int mat_equal(const matrix* a, const matrix* b) {
+	if (!a || !b || a->type != b->type || a->rows != b->rows || a->cols != b->cols) return 0;
+	for (size_t i = 0; i < a->rows; i++) {
+		if (a->type == MAT_INT) {
+			if (memcmp(mat_elem(a, i, 0), mat_elem(b, i, 0), a->cols * MAT_ELEM_SIZE) != 0) return 0;
+			continue;
+		}
+		// Floats compare by value (0.0 == -0.0, NaN != NaN)
+		const float* x = (const float*)mat_elem(a, i, 0);
+		const float* y = (const float*)mat_elem(b, i, 0);
+		for (size_t j = 0; j < a->cols; j++) {
+			if (x[j] != y[j]) return 0;
+		}
+	}
+	return 1;
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+int mat_transpose(matrix* dst, const matrix* src) {
+	// Validate input parameters: dst and src
+	if (!dst || !src) {
+		printf("mat_transpose: NULL matrix pointer\n");
+		return -1;
+	}
+	if (dst->type != src->type || dst->rows != src->cols || dst->cols != src->rows) {
+		printf("mat_transpose: destination must be %zu x %zu of the same type\n", src->cols, src->rows);
+		return -1;
+	}
+	if (dst->storage == src->storage) {
+		printf("mat_transpose: destination shares the source's buffer\n");
+		return -1;
+	}
+
+	// Elements are moved as 4-byte values, so one loop serves both types
+	for (size_t i0 = 0; i0 < src->rows; i0 += MAT_TRANSPOSE_TILE) {
+		size_t i1 = src->rows - i0 < MAT_TRANSPOSE_TILE ? src->rows : i0 + MAT_TRANSPOSE_TILE;
+		for (size_t j0 = 0; j0 < src->cols; j0 += MAT_TRANSPOSE_TILE) {
+			size_t j1 = src->cols - j0 < MAT_TRANSPOSE_TILE ? src->cols : j0 + MAT_TRANSPOSE_TILE;
+			size_t i = i0;
+#ifdef __SSE2__
+			// 4 x 4 blocks: four row loads, shuffle, four row stores
+			for (; i + 4 <= i1; i += 4) {
+				size_t j = j0;
+				for (; j + 4 <= j1; j += 4) {
+					__m128 r0 = _mm_loadu_ps((const float*)mat_elem(src, i, j));
+					__m128 r1 = _mm_loadu_ps((const float*)mat_elem(src, i + 1, j));
+					__m128 r2 = _mm_loadu_ps((const float*)mat_elem(src, i + 2, j));
+					__m128 r3 = _mm_loadu_ps((const float*)mat_elem(src, i + 3, j));
+					_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+					_mm_storeu_ps((float*)mat_elem(dst, j, i), r0);
+					_mm_storeu_ps((float*)mat_elem(dst, j + 1, i), r1);
+					_mm_storeu_ps((float*)mat_elem(dst, j + 2, i), r2);
+					_mm_storeu_ps((float*)mat_elem(dst, j + 3, i), r3);
+				}
+				for (; j < j1; j++) {
+					for (size_t r = i; r < i + 4; r++) memcpy(mat_elem(dst, j, r), mat_elem(src, r, j), MAT_ELEM_SIZE);
+				}
+			}
+#endif
+			for (; i < i1; i++) {
+				for (size_t j = j0; j < j1; j++) memcpy(mat_elem(dst, j, i), mat_elem(src, i, j), MAT_ELEM_SIZE);
+			}
+		}
+	}
+	return 0;
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+/*
+* Multiply: for every NC-column block of B and KC-row slice of it, the slice is packed into panels of
+* NR columns stored k-major (panel[k * NR + j]), zero-padded at the right edge. A register block of
+* MR rows x NR columns of C then walks one panel sequentially: per k it loads NR elements of B,
+* broadcasts one element of each of the MR rows of A and does MR x NR multiply-adds in registers.
+* The block is added into C once per panel. Rows past the end of C repeat the last row and are
+* not stored.
+*/
+
+// Add the MR x NR block of products of a_rows[.][0 .. kc) and a packed panel into the first mr rows
+// and nr columns of c_rows[.] + col
+typedef void (*mat_kernel)(const char* const* a_rows, const char* panel, size_t kc, char* const* c_rows, size_t col, size_t mr, size_t nr);
+
+#ifdef __SSE2__
+// Low 32 bits of the four lane products (SSE2 has no 32-bit lane multiply: two 64-bit ones instead)
+static inline __m128i mat_mullo_epi32(__m128i a, __m128i b) {
+#ifdef __SSE4_1__
+	return _mm_mullo_epi32(a, b);
+#else
+	__m128i even = _mm_mul_epu32(a, b);
+	__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+#endif
+
+static void mat_kernel_float(const char* const* a_rows, const char* panel, size_t kc, char* const* c_rows, size_t col, size_t mr, size_t nr) {
+	const float* a0 = (const float*)a_rows[0];
+	const float* a1 = (const float*)a_rows[1];
+	const float* a2 = (const float*)a_rows[2];
+	const float* a3 = (const float*)a_rows[3];
+	const float* bp = (const float*)panel;
+	float block[MAT_MR][MAT_NR];
+
+#ifdef __SSE2__
+	__m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps(), c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+	__m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps(), c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+	for (size_t k = 0; k < kc; k++, bp += MAT_NR) {
+		__m128 b0 = _mm_load_ps(bp);
+		__m128 b1 = _mm_load_ps(bp + 4);
+		__m128 x = _mm_set1_ps(a0[k]);
+		c00 = _mm_add_ps(c00, _mm_mul_ps(x, b0));
+		c01 = _mm_add_ps(c01, _mm_mul_ps(x, b1));
+		x = _mm_set1_ps(a1[k]);
+		c10 = _mm_add_ps(c10, _mm_mul_ps(x, b0));
+		c11 = _mm_add_ps(c11, _mm_mul_ps(x, b1));
+		x = _mm_set1_ps(a2[k]);
+		c20 = _mm_add_ps(c20, _mm_mul_ps(x, b0));
+		c21 = _mm_add_ps(c21, _mm_mul_ps(x, b1));
+		x = _mm_set1_ps(a3[k]);
+		c30 = _mm_add_ps(c30, _mm_mul_ps(x, b0));
+		c31 = _mm_add_ps(c31, _mm_mul_ps(x, b1));
+	}
+	_mm_storeu_ps(&block[0][0], c00);
+	_mm_storeu_ps(&block[0][4], c01);
+	_mm_storeu_ps(&block[1][0], c10);
+	_mm_storeu_ps(&block[1][4], c11);
+	_mm_storeu_ps(&block[2][0], c20);
+	_mm_storeu_ps(&block[2][4], c21);
+	_mm_storeu_ps(&block[3][0], c30);
+	_mm_storeu_ps(&block[3][4], c31);
+#else
+	const float* a[MAT_MR] = { a0, a1, a2, a3 };
+	memset(block, 0, sizeof(block));
+	for (size_t k = 0; k < kc; k++, bp += MAT_NR) {
+		for (size_t r = 0; r < MAT_MR; r++) {
+			for (size_t j = 0; j < MAT_NR; j++) block[r][j] += a[r][k] * bp[j];
+		}
+	}
+#endif
+
+	for (size_t r = 0; r < mr; r++) {
+		float* c = (float*)c_rows[r] + col;
+		for (size_t j = 0; j < nr; j++) c[j] += block[r][j];
+	}
+}
+
+static void mat_kernel_int(const char* const* a_rows, const char* panel, size_t kc, char* const* c_rows, size_t col, size_t mr, size_t nr) {
+	const int* a0 = (const int*)a_rows[0];
+	const int* a1 = (const int*)a_rows[1];
+	const int* a2 = (const int*)a_rows[2];
+	const int* a3 = (const int*)a_rows[3];
+	const int* bp = (const int*)panel;
+	unsigned int block[MAT_MR][MAT_NR];
+
+#ifdef __SSE2__
+	__m128i c00 = _mm_setzero_si128(), c01 = _mm_setzero_si128(), c10 = _mm_setzero_si128(), c11 = _mm_setzero_si128();
+	__m128i c20 = _mm_setzero_si128(), c21 = _mm_setzero_si128(), c30 = _mm_setzero_si128(), c31 = _mm_setzero_si128();
+	for (size_t k = 0; k < kc; k++, bp += MAT_NR) {
+		__m128i b0 = _mm_load_si128((const __m128i*)bp);
+		__m128i b1 = _mm_load_si128((const __m128i*)(bp + 4));
+		__m128i x = _mm_set1_epi32(a0[k]);
+		c00 = _mm_add_epi32(c00, mat_mullo_epi32(x, b0));
+		c01 = _mm_add_epi32(c01, mat_mullo_epi32(x, b1));
+		x = _mm_set1_epi32(a1[k]);
+		c10 = _mm_add_epi32(c10, mat_mullo_epi32(x, b0));
+		c11 = _mm_add_epi32(c11, mat_mullo_epi32(x, b1));
+		x = _mm_set1_epi32(a2[k]);
+		c20 = _mm_add_epi32(c20, mat_mullo_epi32(x, b0));
+		c21 = _mm_add_epi32(c21, mat_mullo_epi32(x, b1));
+		x = _mm_set1_epi32(a3[k]);
+		c30 = _mm_add_epi32(c30, mat_mullo_epi32(x, b0));
+		c31 = _mm_add_epi32(c31, mat_mullo_epi32(x, b1));
+	}
+	_mm_storeu_si128((__m128i*)&block[0][0], c00);
+	_mm_storeu_si128((__m128i*)&block[0][4], c01);
+	_mm_storeu_si128((__m128i*)&block[1][0], c10);
+	_mm_storeu_si128((__m128i*)&block[1][4], c11);
+	_mm_storeu_si128((__m128i*)&block[2][0], c20);
+	_mm_storeu_si128((__m128i*)&block[2][4], c21);
+	_mm_storeu_si128((__m128i*)&block[3][0], c30);
+	_mm_storeu_si128((__m128i*)&block[3][4], c31);
+#else
+	// Unsigned arithmetic: products and sums wrap instead of overflowing
+	const int* a[MAT_MR] = { a0, a1, a2, a3 };
+	memset(block, 0, sizeof(block));
+	for (size_t k = 0; k < kc; k++, bp += MAT_NR) {
+		for (size_t r = 0; r < MAT_MR; r++) {
+			for (size_t j = 0; j < MAT_NR; j++) block[r][j] += (unsigned int)a[r][k] * (unsigned int)bp[j];
+		}
+	}
+#endif
+
+	for (size_t r = 0; r < mr; r++) {
+		int* c = (int*)c_rows[r] + col;
+		for (size_t j = 0; j < nr; j++) c[j] = (int)((unsigned int)c[j] + block[r][j]);
+	}
+}
+
+// Pack rows [pc, pc + kc) and columns [jc, jc + nc) of b into NR-column panels
+static void mat_pack_b(char* pack, const matrix* b, size_t pc, size_t kc, size_t jc, size_t nc) {
+	for (size_t k = 0; k < kc; k++) {
+		const char* row = mat_elem(b, pc + k, jc);
+		for (size_t p = 0; p * MAT_NR < nc; p++) {
+			size_t nr = nc - p * MAT_NR < MAT_NR ? nc - p * MAT_NR : MAT_NR;
+			char* dst = pack + ((p * kc + k) * MAT_NR) * MAT_ELEM_SIZE;
+			memcpy(dst, row + p * MAT_NR * MAT_ELEM_SIZE, nr * MAT_ELEM_SIZE);
+			if (nr < MAT_NR) memset(dst + nr * MAT_ELEM_SIZE, 0, (MAT_NR - nr) * MAT_ELEM_SIZE);
+		}
+	}
+}
+
+typedef struct mat_multiply_job {
+	matrix* c;
+	const matrix* a;
+	const matrix* b;
+	size_t row_begin;
+	size_t row_end;
+	int started;      // Set when the job runs on its own thread
+} mat_multiply_job;
+
+// Compute rows [row_begin, row_end) of c = a * b
+static void* mat_multiply_rows(void* arg) {
+	mat_multiply_job* job = (mat_multiply_job*) arg;
+	matrix* c = job->c;
+	const matrix* a = job->a;
+	const matrix* b = job->b;
+	size_t depth = a->cols;
+	size_t n = b->cols;
+	mat_kernel kernel = c->type == MAT_FLOAT ? mat_kernel_float : mat_kernel_int;
+
+	// Memory allocation: packed block of B (one per thread)
+	const dsa_allocator* libc = dsa_default_allocator();
+	size_t pack_bytes = (size_t)MAT_KC * MAT_NC * MAT_ELEM_SIZE;
+	char* pack = (char*) libc->alloc(libc->ctx, pack_bytes, MAT_ALIGNMENT);
+	if (!pack) {
+		printf("Memory allocation failed: couldn't allocate the mat_multiply packing buffer\n");
+		exit(1);
+	}
+
+	for (size_t i = job->row_begin; i < job->row_end; i++) memset(mat_elem(c, i, 0), 0, n * MAT_ELEM_SIZE);
+
+	for (size_t jc = 0; jc < n; jc += MAT_NC) {
+		size_t nc = n - jc < MAT_NC ? n - jc : MAT_NC;
+		for (size_t pc = 0; pc < depth; pc += MAT_KC) {
+			size_t kc = depth - pc < MAT_KC ? depth - pc : MAT_KC;
+			mat_pack_b(pack, b, pc, kc, jc, nc);
+
+			for (size_t i = job->row_begin; i < job->row_end; i += MAT_MR) {
+				size_t mr = job->row_end - i < MAT_MR ? job->row_end - i : MAT_MR;
+				const char* a_rows[MAT_MR];
+				char* c_rows[MAT_MR];
+				for (size_t r = 0; r < MAT_MR; r++) {
+					size_t row = i + (r < mr ? r : mr - 1);
+					a_rows[r] = mat_elem(a, row, pc);
+					c_rows[r] = mat_elem(c, row, jc);
+				}
+				for (size_t p = 0; p * MAT_NR < nc; p++) {
+					size_t nr = nc - p * MAT_NR < MAT_NR ? nc - p * MAT_NR : MAT_NR;
+					kernel(a_rows, pack + p * kc * MAT_NR * MAT_ELEM_SIZE, kc, c_rows, p * MAT_NR, mr, nr);
+				}
+			}
+		}
+	}
+
+	libc->free(libc->ctx, pack, pack_bytes);
+	return NULL;
+}
+
+
+int mat_multiply(matrix* c, const matrix* a, const matrix* b, int nthreads) {
+	// Validate input parameters: c, a and b
+	if (!c || !a || !b) {
+		printf("mat_multiply: NULL matrix pointer\n");
+		return -1;
+	}
+	if (a->type != b->type || c->type != a->type) {
+		printf("mat_multiply: matrices must have one element type\n");
+		return -1;
+	}
+	if (a->cols != b->rows || c->rows != a->rows || c->cols != b->cols) {
+		printf("mat_multiply: can't multiply %zu x %zu by %zu x %zu into %zu x %zu\n", a->rows, a->cols, b->rows, b->cols, c->rows, c->cols);
+		return -1;
+	}
+	if (c->storage == a->storage || c->storage == b->storage) {
+		printf("mat_multiply: result shares a buffer with an operand\n");
+		return -1;
+	}
+
+	// At most one thread per register block of rows, and per MAT_THREAD_WORK multiply-adds
+	size_t row_blocks = (c->rows + MAT_MR - 1) / MAT_MR;
+	double work = (double)a->rows * (double)a->cols * (double)b->cols / MAT_THREAD_WORK;
+	size_t threads_used = nthreads > 1 ? (size_t)nthreads : 1;
+	if (threads_used > row_blocks) threads_used = row_blocks;
+	if ((double)threads_used > work) threads_used = work >= 1 ? (size_t)work : 1;
+	if (threads_used == 1) {
+		mat_multiply_job whole = { c, a, b, 0, c->rows, 0 };
+		mat_multiply_rows(&whole);
+		return 0;
+	}
+
+	pthread_t* threads = (pthread_t*) malloc(sizeof(pthread_t) * threads_used);
+	mat_multiply_job* jobs = (mat_multiply_job*) malloc(sizeof(mat_multiply_job) * threads_used);
+	if (!threads || !jobs) {
+		printf("Memory allocation failed: couldn't allocate %zu mat_multiply threads\n", threads_used);
+		exit(1);
+	}
+	for (size_t t = 0; t < threads_used; t++) {
+		size_t lo = row_blocks * t / threads_used * MAT_MR;
+		size_t hi = row_blocks * (t + 1) / threads_used * MAT_MR;
+		jobs[t] = (mat_multiply_job){ c, a, b, lo, hi < c->rows ? hi : c->rows, 1 };
+		// A thread that can't be started leaves its rows to the calling thread
+		if (pthread_create(&threads[t], NULL, mat_multiply_rows, &jobs[t]) != 0) {
+			jobs[t].started = 0;
+			mat_multiply_rows(&jobs[t]);
+		}
+	}
+	for (size_t t = 0; t < threads_used; t++) {
+		if (jobs[t].started) pthread_join(threads[t], NULL);
+	}
+	free(threads);
+	free(jobs);
+	return 0;
+}
+
+
+void mat_display(const matrix* m) {
+	// Validate input parameter: m
+	if (!m) {
+		printf("mat_display: NULL matrix pointer\n");
+		return;
+	}
+
+	// One "[a, b, c]" line per row, formatted into the writer's buffer
+	fio_writer w;
+	fio_writer_init(&w, stdout, NULL, 0);
+	for (size_t i = 0; i < m->rows; i++) {
+		fio_put_char(&w, '[');
+		for (size_t j = 0; j < m->cols; j++) {
+			if (m->type == MAT_INT) {
+				fio_put_int(&w, *(const int*)mat_elem(m, i, j));
+			} else {
+				char text[32];
+				snprintf(text, sizeof(text), "%g", (double)*(const float*)mat_elem(m, i, j));
+				fio_put_str(&w, text);
+			}
+			if (j + 1 < m->cols) fio_put_bytes(&w, ", ", 2);
+		}
+		fio_put_bytes(&w, "]\n", 2);
+	}
+	fio_writer_flush(&w);
+	printf("(rows=%zu, cols=%zu, stride=%zu)\n", m->rows, m->cols, m->stride);
+}
@@ -0,0 +1,96 @@
+#ifndef DSA_MATRIX_H
+#define DSA_MATRIX_H
+
+
+#include <stddef.h>
+#include "../allocator/allocator.h"
+
+
+/*
+* Dense row-major matrix of ints or floats in one 64-byte aligned allocation, replacing int** jagged
+* arrays (one allocation and one pointer hop per row). Rows are padded to a stride that is a multiple
+* of 16 elements (one cache line) and never a multiple of 4 KB, so row starts are aligned and the rows
+* of a column don't all map to the same cache sets.
+*
+* Views: mat_view gives a sub-matrix that shares the parent's buffer (no copy); writes through either
+* are seen by both. The buffer is freed when the last matrix or view using it is freed.
+*
+* Operations:
+*   mat_transpose   - 32x32 tiles (4x4 SSE2 transposes inside), so reads and writes both stay within
+*                     a few cache lines per tile instead of striding over the whole destination
+*   mat_multiply    - tiles of B are packed into contiguous 8-column panels sized for L2, and a 4x8
+*                     block of C is kept in SSE2 registers while walking a panel. Optional threads
+*                     split the rows of C. int products wrap modulo 2^32
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef enum { MAT_INT, MAT_FLOAT } mat_type;
+
+typedef struct matrix matrix;
+
+// Create a zero-filled rows x cols matrix
+matrix* mat_create(size_t rows, size_t cols, mat_type type);
+
+// Create a zero-filled matrix whose struct and buffer come from allocator (NULL -> libc)
+matrix* mat_create_with_allocator(size_t rows, size_t cols, mat_type type, const dsa_allocator* allocator);
+
+// View of rows x cols elements starting at (row, col) of m, sharing its buffer. Free it with mat_free
+matrix* mat_view(matrix* m, size_t row, size_t col, size_t rows, size_t cols);
+
+// Free a matrix or view (the buffer goes when its last user is freed)
+void mat_free(matrix* m);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// No. of rows
+size_t mat_rows(const matrix* m);
+
+// No. of columns
+size_t mat_cols(const matrix* m);
+
+// Elements from the start of one row to the start of the next (>= cols)
+size_t mat_stride(const matrix* m);
+
+// Element type
+mat_type mat_elem_type(const matrix* m);
+
+// Pointer to the first element of a row (cols valid elements) - NULL on error (wrong type, row out of range)
+int* mat_row_int(matrix* m, size_t row);
+float* mat_row_float(matrix* m, size_t row);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get element (row, col) - returns 0 on error
+int mat_get_int(const matrix* m, size_t row, size_t col);
+float mat_get_float(const matrix* m, size_t row, size_t col);
+
+// Set element (row, col) - returns 0 on success else -1
+int mat_set_int(matrix* m, size_t row, size_t col, int val);
+int mat_set_float(matrix* m, size_t row, size_t col, float val);
+
+// Set every element to zero
+void mat_zero(matrix* m);
+
+// Copy src into dst (same shape and type, e.g. into a view) - returns 0 on success else -1
+int mat_copy(matrix* dst, const matrix* src);
+
+// Returns 1 if a and b have the same shape, type and elements else 0
+int mat_equal(const matrix* a, const matrix* b);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// dst = transpose of src. dst must be cols x rows of src, same type, and not share src's buffer.
+// Returns 0 on success else -1
+int mat_transpose(matrix* dst, const matrix* src);
+
+// c = a * b with a m x k, b k x n and c m x n, all of one type; c must not share a buffer with a or b.
+// nthreads > 1 splits the rows of c over that many threads. Returns 0 on success else -1
+int mat_multiply(matrix* c, const matrix* a, const matrix* b, int nthreads);
+
+// Display the matrix, one row per line
+void mat_display(const matrix* m);
+
+
+#endif /* DSA_MATRIX_H */
@@ -0,0 +1,176 @@
+/*
+Snapshot benchmark: persistent list (structural sharing) vs deep-copied linked list snapshots.
+
+    Build: gcc -O2 benchmark.c persistent_list.c ../linked_list/linked_list.c -o pl_bench
+    Usage: ./pl_bench [max_elements=1000000]
+
+Part 1 - snapshot latency: for n = 1K, 10K, ... up to max_elements, the time to take and drop one
+         snapshot of an n-element list: pl_snapshot + pl_release vs an O(n) deep copy of an ll_node list.
+Part 2 - versioned workload: starting from n elements, every step pushes or pops at the front and
+         keeps a snapshot of the result; the last KEEP snapshots stay alive. Reports the time per step
+         and the nodes alive at the end (shared nodes are counted once for the persistent list).
+The deep copies get a bounded budget of copied elements per size; the last snapshot of both variants
+must hold the same elements, which the last column reports.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "persistent_list.h"
+#include "../linked_list/linked_list.h"
+
+#define KEEP         64
+#define STEPS        100000
+#define COPY_BUDGET  200000000ull   // Elements copied allowed for one deep-copy measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Deep copy in O(n): gather the values, then push them back to front
+static ll_node* ll_deep_copy(ll_node* head, int* scratch) {
+    int n = 0;
+    for (ll_node* node = head; node; node = ll_next(node)) scratch[n++] = ll_get_data(node);
+    ll_node* copy = NULL;
+    while (n-- > 0) ll_push_front(&copy, scratch[n]);
+    return copy;
+}
+
+static void ll_free_all(ll_node** head) {
+    while (*head) ll_pop_front(head);
+}
+
+static int same_elements(pl_node* list, ll_node* head) {
+    size_t n = pl_length(list);
+    if ((int)n != ll_count_nodes(head)) return 0;
+    // Walk the persistent version by popping, comparing element by element
+    pl_node* cur = pl_snapshot(list);
+    for (ll_node* node = head; node; node = ll_next(node)) {
+        if (pl_front(cur) != ll_get_data(node)) { pl_release(cur); return 0; }
+        pl_node* next = pl_pop_front(cur);
+        pl_release(cur);
+        cur = next;
+    }
+    pl_release(cur);
+    return 1;
+}
+
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    int* scratch = (int*) malloc(sizeof(int) * (max_n + STEPS + 1));
+    if (!scratch) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    printf("Part 1 - take and drop one snapshot\n");
+    printf("%10s %14s %14s %10s\n", "n", "pl ns/snap", "copy ns/snap", "speedup");
+    for (size_t n = 1000; n <= max_n; n *= 10) {
+        pl_node* list = NULL;
+        ll_node* head = NULL;
+        for (size_t i = 0; i < n; i++) {
+            int v = (int)(next_random() >> 33);
+            pl_node* next = pl_push_front(list, v);
+            pl_release(list);
+            list = next;
+            ll_push_front(&head, v);
+        }
+
+        size_t reps = 1000000;
+        double t0 = now_seconds();
+        for (size_t r = 0; r < reps; r++) pl_release(pl_snapshot(list));
+        double pl_ns = (now_seconds() - t0) * 1e9 / (double)reps;
+
+        size_t copies = COPY_BUDGET / n / 4;
+        if (copies == 0) copies = 1;
+        t0 = now_seconds();
+        for (size_t r = 0; r < copies; r++) {
+            ll_node* copy = ll_deep_copy(head, scratch);
+            ll_free_all(&copy);
+        }
+        double copy_ns = (now_seconds() - t0) * 1e9 / (double)copies;
+
+        printf("%10zu %14.1f %14.1f %9.0fx\n", n, pl_ns, copy_ns, copy_ns / pl_ns);
+        pl_release(list);
+        ll_free_all(&head);
+    }
+
+    printf("\nPart 2 - push/pop at the front, snapshot every step, keep the last %d snapshots\n", KEEP);
+    printf("%10s %8s %12s %12s %14s %14s %10s\n", "n", "steps", "pl ns/step", "copy ns/step",
+           "pl nodes", "copy nodes", "check");
+    for (size_t n = 1000; n <= max_n; n *= 10) {
+        size_t steps = COPY_BUDGET / n;
+        if (steps > STEPS) steps = STEPS;
+        if (steps < KEEP) steps = KEEP;
+
+        // Same sequence of operations for both variants
+        uint64_t seed = next_random();
+
+        // Persistent list: every version is a snapshot
+        rng_state = seed;
+        pl_node* current = NULL;
+        for (size_t i = 0; i < n; i++) {
+            pl_node* next = pl_push_front(current, (int)i);
+            pl_release(current);
+            current = next;
+        }
+        pl_node* kept[KEEP] = {0};
+        double t0 = now_seconds();
+        for (size_t s = 0; s < steps; s++) {
+            pl_node* next;
+            if ((next_random() & 1) && current) next = pl_pop_front(current);
+            else next = pl_push_front(current, (int)s);
+            pl_release(current);
+            current = next;
+            pl_release(kept[s % KEEP]);
+            kept[s % KEEP] = pl_snapshot(current);
+        }
+        double pl_ns = (now_seconds() - t0) * 1e9 / (double)steps;
+        size_t pl_nodes = pl_live_nodes();
+
+        // Mutable list: a snapshot is a deep copy
+        rng_state = seed;
+        ll_node* head = NULL;
+        for (size_t i = 0; i < n; i++) ll_push_front(&head, (int)i);
+        ll_node* copies[KEEP] = {0};
+        t0 = now_seconds();
+        for (size_t s = 0; s < steps; s++) {
+            if ((next_random() & 1) && head) ll_pop_front(&head);
+            else ll_push_front(&head, (int)s);
+            ll_free_all(&copies[s % KEEP]);
+            copies[s % KEEP] = ll_deep_copy(head, scratch);
+        }
+        double copy_ns = (now_seconds() - t0) * 1e9 / (double)steps;
+        size_t copy_nodes = (size_t)ll_count_nodes(head);
+        for (int k = 0; k < KEEP; k++) copy_nodes += (size_t)ll_count_nodes(copies[k]);
+
+        int ok = same_elements(kept[(steps - 1) % KEEP], copies[(steps - 1) % KEEP]);
+        printf("%10zu %8zu %12.1f %12.1f %14zu %14zu %10s\n", n, steps, pl_ns, copy_ns,
+               pl_nodes, copy_nodes, ok ? "ok" : "MISMATCH");
+
+        pl_release(current);
+        ll_free_all(&head);
+        for (int k = 0; k < KEEP; k++) {
+            pl_release(kept[k]);
+            ll_free_all(&copies[k]);
+        }
+    }
+
+    free(scratch);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include "persistent_list.h"
+
+int main(void) {
+
+    printf("\n\n============================| PERSISTENT LIST EXAMPLE |============================\n\n");
+
+    // Every push returns a new version; older versions stay valid
+    pl_node* v1 = pl_push_front(NULL, 3);
+    pl_node* v2 = pl_push_front(v1, 2);
+    pl_node* v3 = pl_push_front(v2, 1);
+    printf("v1: "); pl_display(v1);
+    printf("v2: "); pl_display(v2);
+    printf("v3: "); pl_display(v3);
+    printf("Live nodes for 3 versions: %zu\n", pl_live_nodes());
+
+    // Two versions branching from the same tail
+    pl_node* other = pl_push_front(v2, 42);
+    printf("Branch of v2: "); pl_display(other);
+    printf("Length %zu, 42 at position %d, front %d\n", pl_length(other), pl_search(other, 42), pl_front(other));
+
+    // O(1) snapshot, then drop the original handle: the snapshot keeps the nodes alive
+    pl_node* snap = pl_snapshot(v3);
+    pl_release(v3);
+    printf("Snapshot of v3 after release: "); pl_display(snap);
+
+    // Pop returns the tail version
+    pl_node* tail = pl_pop_front(snap);
+    printf("Popped snapshot: "); pl_display(tail);
+
+    // Build from a mutable linked list
+    ll_node* head = NULL;
+    ll_push_back(&head, 7);
+    ll_push_back(&head, 8);
+    ll_push_back(&head, 9);
+    pl_node* copy = pl_from_list(head);
+    ll_pop_front(&head);
+    printf("From linked list (after the list changed): "); pl_display(copy);
+    while (head) ll_pop_front(&head);
+
+    pl_release(v1);
+    pl_release(v2);
+    pl_release(other);
+    pl_release(snap);
+    pl_release(tail);
+    pl_release(copy);
+    printf("Live nodes after releasing every version: %zu\n", pl_live_nodes());
+
+    return 0;
+}
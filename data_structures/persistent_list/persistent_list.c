@@ -0,0 +1,131 @@
+#include "persistent_list.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+// Immutable after creation except for the reference count
+typedef struct pl_node {
+	int data;
+	_Atomic size_t refs;        // Versions and nodes pointing here
+	size_t length;              // Elements from this node to the end
+	struct pl_node* next;       // Holds one reference to next
+} pl_node;
+
+static _Atomic size_t live_nodes = 0;
+
+
+// Add a reference
+static inline pl_node* pl_retain(pl_node* node) {
+	if (node) atomic_fetch_add_explicit(&node->refs, 1, memory_order_relaxed);
+	return node;
+}
+
+// Create a node in front of next, taking over the caller's reference to next
+static pl_node* pl_new_node(int data, pl_node* next) {
+	pl_node* node = (pl_node*) malloc(sizeof(pl_node));
+	if (!node) {
+		printf("Memory allocation failed!\n");
+		exit(1);
+	}
+	node->data = data;
+	atomic_init(&node->refs, 1);
+	node->length = next ? next->length + 1 : 1;
+	node->next = next;
+	atomic_fetch_add_explicit(&live_nodes, 1, memory_order_relaxed);
+	return node;
+}
+
+// New version with data in front
+pl_node* pl_push_front(pl_node* list, int data) {
+	return pl_new_node(data, pl_retain(list));
+}
+
+// Tail version
+pl_node* pl_pop_front(pl_node* list) {
+	if (list == NULL) {
+		printf("List is empty!\n");
+		return NULL;
+	}
+	return pl_retain(list->next);
+}
+
+// O(1) snapshot
+pl_node* pl_snapshot(pl_node* list) {
+	return pl_retain(list);
+}
+
+// Drop a reference; free the chain of nodes that nothing else references (iteratively, no recursion)
+void pl_release(pl_node* list) {
+	while (list != NULL) {
+		// acq_rel: the thread that frees must see every other thread's use of the node
+		if (atomic_fetch_sub_explicit(&list->refs, 1, memory_order_acq_rel) != 1) return;
+		pl_node* next = list->next;
+		free(list);
+		atomic_fetch_sub_explicit(&live_nodes, 1, memory_order_relaxed);
+		list = next;
+	}
+}
+
+// Copy a mutable list: collect the values, then push them back to front
+pl_node* pl_from_list(ll_node* head) {
+	int count = ll_count_nodes(head);
+	if (count == 0) return NULL;
+
+	int* values = (int*) malloc(sizeof(int) * (size_t)count);
+	if (!values) {
+		printf("Memory allocation failed!\n");
+		exit(1);
+	}
+	int i = 0;
+	for (ll_node* node = head; node != NULL; node = ll_next(node)) values[i++] = ll_get_data(node);
+
+	pl_node* list = NULL;
+	while (i-- > 0) list = pl_new_node(values[i], list);
+	free(values);
+	return list;
+}
+
+// First value
+int pl_front(const pl_node* list) {
+	if (list == NULL) {
+		printf("List is empty!\n");
+		return -1;
+	}
+	return list->data;
+}
+
+// Search for an element
+int pl_search(const pl_node* list, int key) {
+	int pos = 1;
+	while (list != NULL) {
+		if (list->data == key)
+			return pos;
+		list = list->next;
+		pos++;
+	}
+	return -1; // Not found
+}
+
+// Length
+size_t pl_length(const pl_node* list) {
+	return list ? list->length : 0;
+}
+
+// Display version
+void pl_display(const pl_node* list) {
+	if (list == NULL) {
+		printf("List is empty!\n");
+		return;
+	}
+	while (list != NULL) {
+		printf("%d -> ", list->data);
+		list = list->next;
+	}
+	printf("NULL\n");
+}
+
+// Live node count
+size_t pl_live_nodes(void) {
+	return atomic_load_explicit(&live_nodes, memory_order_relaxed);
+}
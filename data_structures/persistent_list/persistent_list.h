@@ -0,0 +1,58 @@
+#ifndef DSA_PERSISTENT_LIST_H
+#define DSA_PERSISTENT_LIST_H
+
+
+#include <stddef.h>
+#include "../linked_list/linked_list.h"
+
+
+/*
+* Persistent (immutable, structurally shared) singly linked list of ints.
+* A version is a pointer to its first node (NULL is the empty list). Nodes never change after
+* creation, so pl_push_front / pl_pop_front return a new version that shares the whole tail with
+* the old one, and a snapshot is one more reference to the same head: O(1) time and no copying.
+*
+* Nodes are reference counted with atomic counts, so versions can be handed to other threads.
+* Every function returning a pl_node* gives the caller one reference, which must be dropped with
+* pl_release; the last release of a node frees it (iteratively, so long lists cannot overflow the stack).
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct pl_node pl_node;
+
+// New version with data in front of list. The caller keeps its own reference to list, which stays unchanged
+pl_node* pl_push_front(pl_node* list, int data);
+
+// Version without the first element of list, caller keeps its reference to list (NULL with a message if empty)
+pl_node* pl_pop_front(pl_node* list);
+
+// O(1) snapshot: one more reference to the same version
+pl_node* pl_snapshot(pl_node* list);
+
+// Drop one reference to a version; nodes no other version shares are freed (NULL is ignored)
+void pl_release(pl_node* list);
+
+// Build a version holding the elements of a mutable linked list, in the same order
+pl_node* pl_from_list(ll_node* head);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the first element (-1 with a message if the list is empty)
+int pl_front(const pl_node* list);
+
+// Position (1-based) of key, or -1 if not found
+int pl_search(const pl_node* list, int key);
+
+// Get the no. of elements in O(1) (every node stores the length of its suffix)
+size_t pl_length(const pl_node* list);
+
+// Display the version
+void pl_display(const pl_node* list);
+
+// No. of nodes currently alive across all versions
+size_t pl_live_nodes(void);
+
+
+#endif /* DSA_PERSISTENT_LIST_H */
@@ -0,0 +1,96 @@
+/*
+Priority queue throughput: binary heap vs cache-aligned 4-ary heap.
+
+    Build: gcc -O2 benchmark.c priority_queue.c ../arrays/static_array.c ../../algorithms/sortingAlgorithms.c -o pq_bench
+    Usage: ./pq_bench [max_elements=10000000]
+
+For n = 1K, 32K, 1M, ... up to max_elements and arity 2 and 4 it measures
+    fill+drain : n pushes of random keys followed by n pops (pop order is checked)
+    hold       : n pops each followed by a push of a larger key (the classic event-queue "hold" model)
+    decrease   : n decrease-key operations on random handles
+and prints ns per operation.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "priority_queue.h"
+#include "../../algorithms/sortingAlgorithms.h"
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (uint32_t)((rng_state * 0x2545F4914F6CDD1Dull) >> 33);
+}
+
+static void run(size_t n, int arity) {
+    priority_queue* pq = pq_create(n, arity, ascending);
+    int* handles = (int*) malloc(n * sizeof(int));
+    if (!pq || !handles) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    // fill + drain
+    double t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) pq_push(pq, (int)next_random());
+    int ok = 1, prev = -1;
+    for (size_t i = 0; i < n; i++) {
+        int v = pq_pop(pq);
+        if (v < prev) ok = 0;
+        prev = v;
+    }
+    double fill_drain = (now_seconds() - t0) * 1e9 / (2.0 * n);
+
+    // hold: the queue stays at n elements, every popped key is re-inserted a little later
+    for (size_t i = 0; i < n; i++) pq_push(pq, (int)next_random());
+    t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int v = pq_pop(pq);
+        pq_push(pq, v + (int)(next_random() & 0xFFFF));
+    }
+    double hold = (now_seconds() - t0) * 1e9 / (2.0 * n);
+    while (!pq_is_empty(pq)) pq_pop(pq);
+
+    // decrease-key
+    for (size_t i = 0; i < n; i++) handles[i] = pq_push(pq, (int)(next_random() | 0x40000000));
+    t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int h = handles[next_random() % n];
+        pq_update_key(pq, h, pq_get_key(pq, h) - (int)(next_random() & 0xFFFFF));
+    }
+    double decrease = (now_seconds() - t0) * 1e9 / n;
+    prev = -2147483647 - 1;
+    for (size_t i = 0; i < n; i++) {
+        int v = pq_pop(pq);
+        if (v < prev) ok = 0;
+        prev = v;
+    }
+
+    printf("%10zu %6d %14.1f %10.1f %12.1f %6s\n", n, arity, fill_drain, hold, decrease, ok ? "ok" : "BAD");
+    free(handles);
+    pq_free(pq);
+}
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+
+    printf("%10s %6s %14s %10s %12s %6s\n", "elements", "arity", "fill+drain ns", "hold ns", "decrease ns", "order");
+    for (size_t n = 1000; n <= max_n; n *= 32) {
+        run(n, 2);
+        run(n, 4);
+    }
+    return 0;
+}
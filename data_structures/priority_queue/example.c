@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include "priority_queue.h"
+#include "../arrays/static_array.h"
+#include "../../algorithms/sortingAlgorithms.h"
+
+int main(void) {
+
+    printf("\n\n============================| PRIORITY QUEUE EXAMPLE |============================\n\n");
+
+    // Min-queue (ascending) with a 4-ary heap
+    priority_queue* pq = pq_create(16, 4, ascending);
+    int h30 = pq_push(pq, 30);
+    pq_push(pq, 10);
+    pq_push(pq, 50);
+    int h40 = pq_push(pq, 40);
+    printf("Top after pushing 30, 10, 50, 40: %d (size=%zu)\n", pq_peek(pq), pq_size(pq));
+
+    // Decrease-key: 40 -> 5 moves it to the top
+    pq_update_key(pq, h40, 5);
+    printf("Top after decreasing 40 to 5: %d\n", pq_peek(pq));
+    printf("Key behind the handle of 30: %d\n", pq_get_key(pq, h30));
+
+    printf("Pop order: ");
+    while (!pq_is_empty(pq)) printf("%d ", pq_pop(pq));
+    printf("\n");
+    pq_free(pq);
+
+    // Max-queue (descending) heapified from an existing static_array in O(n)
+    static_array* arr = sa_create_array(8);
+    sa_insert_last(arr, 7);
+    sa_insert_last(arr, 2);
+    sa_insert_last(arr, 9);
+    sa_insert_last(arr, 4);
+    sa_insert_last(arr, 6);
+    printf("Source array: ");
+    sa_display(arr);
+
+    pq = pq_create_from_array(arr, 2, descending);
+    pq_update_key(pq, 1, 100);   // Handle 1 is the element at index 1 (the 2)
+    printf("Pop order (max-queue, element 2 raised to 100): ");
+    while (!pq_is_empty(pq)) printf("%d ", pq_pop(pq));
+    printf("\n");
+
+    pq_free(pq);
+    sa_free(arr);
+    return 0;
+}
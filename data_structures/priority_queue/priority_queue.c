@@ -0,0 +1,271 @@
+#include "priority_queue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+* Heap layout inside the static_array buffer:
+*   [pad unused slots][root][level 1 ...][level 2 ...]...
+* With pad = arity - 1 the first child of the node at physical index p is arity * (p - pad + 1),
+* a multiple of arity - for arity 4 every sibling group fills one aligned 16-byte block.
+*/
+
+#define PQ_NO_SLOT ((size_t)-1)
+
+typedef struct priority_queue {
+	static_array* heap;      // Element storage, root at index pad
+	int* data;               // sa_data(heap), cached
+	size_t pad;              // arity - 1 unused slots before the root
+	size_t arity;
+	size_t capacity;
+	int (*cmp)(int, int);
+	int* slot_handle;        // Handle of the element stored at each physical slot
+	size_t* handle_slot;     // Physical slot of every handle, PQ_NO_SLOT if the handle is free
+	int* free_handles;       // Stack of unused handles
+	size_t free_count;
+} priority_queue;
+
+
+static inline size_t pq_first_child(const priority_queue* pq, size_t p) {
+	return pq->arity * (p - pq->pad) + 1 + pq->pad;
+}
+
+static inline size_t pq_parent(const priority_queue* pq, size_t p) {
+	return (p - pq->pad - 1) / pq->arity + pq->pad;
+}
+
+static inline size_t pq_end(const priority_queue* pq) {
+	return sa_size(pq->heap);
+}
+
+// Store val with handle h at physical slot p
+static inline void pq_place(priority_queue* pq, size_t p, int val, int h) {
+	pq->data[p] = val;
+	pq->slot_handle[p] = h;
+	pq->handle_slot[h] = p;
+}
+
+// Move the element at p towards the root while it comes before its parent
+static void pq_sift_up(priority_queue* pq, size_t p) {
+	int val = pq->data[p];
+	int h = pq->slot_handle[p];
+	while (p > pq->pad) {
+		size_t parent = pq_parent(pq, p);
+		if (!pq->cmp(val, pq->data[parent])) break;
+		pq_place(pq, p, pq->data[parent], pq->slot_handle[parent]);
+		p = parent;
+	}
+	pq_place(pq, p, val, h);
+}
+
+// Move the element at p towards the leaves while one of its children comes before it
+static void pq_sift_down(priority_queue* pq, size_t p) {
+	int* data = pq->data;
+	size_t end = pq_end(pq);
+	int val = data[p];
+	int h = pq->slot_handle[p];
+	for (;;) {
+		size_t child = pq_first_child(pq, p);
+		if (child >= end) break;
+
+		// Pick the child that comes first among the (up to arity) siblings
+		size_t last = child + pq->arity < end ? child + pq->arity : end;
+		size_t best = child;
+		for (size_t c = child + 1; c < last; c++) {
+			if (pq->cmp(data[c], data[best])) best = c;
+		}
+		if (!pq->cmp(data[best], val)) break;
+		pq_place(pq, p, data[best], pq->slot_handle[best]);
+		p = best;
+	}
+	pq_place(pq, p, val, h);
+}
+
+// Allocates the queue with its heap array and padding, but no elements
+static priority_queue* pq_alloc(size_t capacity, int arity, int (*cmp)(int, int), const char* caller) {
+	// Validate input parameters
+	if (capacity == 0 || arity < 2 || !cmp) {
+		printf("%s: capacity must be > 0, arity >= 2 and cmp non-NULL\n", caller);
+		return NULL;
+	}
+
+	// Memory allocation: priority_queue struct
+	priority_queue* pq = (priority_queue*) malloc(sizeof(priority_queue));
+	if (!pq) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct priority_queue!\n");
+		exit(1);
+	}
+
+	pq->arity = (size_t)arity;
+	pq->pad = (size_t)arity - 1;
+	pq->capacity = capacity;
+	pq->cmp = cmp;
+
+	// Element storage: padding slots first, so the root sits at index pad
+	pq->heap = sa_create_array(capacity + pq->pad);
+	for (size_t i = 0; i < pq->pad; i++) sa_insert_last(pq->heap, 0);
+	pq->data = sa_data(pq->heap);
+
+	// Memory allocation: handle bookkeeping
+	pq->slot_handle = (int*) malloc(sizeof(int) * (capacity + pq->pad));
+	pq->handle_slot = (size_t*) malloc(sizeof(size_t) * capacity);
+	pq->free_handles = (int*) malloc(sizeof(int) * capacity);
+	if (!pq->slot_handle || !pq->handle_slot || !pq->free_handles) {
+		printf("Memory allocation failed: couldn't allocate handles for %zu elements\n", capacity);
+		exit(1);
+	}
+	for (size_t h = 0; h < capacity; h++) pq->handle_slot[h] = PQ_NO_SLOT;
+	pq->free_count = 0;
+	return pq;
+}
+
+
+priority_queue* pq_create(size_t capacity, int arity, int (*cmp)(int, int)) {
+	priority_queue* pq = pq_alloc(capacity, arity, cmp, "pq_create");
+	if (!pq) return NULL;
+
+	// All handles are free, lowest handed out first
+	for (size_t h = capacity; h-- > 0; ) pq->free_handles[pq->free_count++] = (int)h;
+	return pq;
+}
+
+
+priority_queue* pq_create_from_array(static_array* src, int arity, int (*cmp)(int, int)) {
+	// Validate input parameter: src
+	if (!src) {
+		printf("pq_create_from_array: NULL array pointer\n");
+		return NULL;
+	}
+
+	size_t n = sa_size(src);
+	priority_queue* pq = pq_alloc(sa_capacity(src), arity, cmp, "pq_create_from_array");
+	if (!pq) return NULL;
+
+	// Bulk copy behind the padding; element i keeps handle i
+	const int* values = sa_const_data(src);
+	for (size_t i = 0; i < n; i++) {
+		sa_insert_last(pq->heap, values[i]);
+		pq->slot_handle[pq->pad + i] = (int)i;
+		pq->handle_slot[i] = pq->pad + i;
+	}
+	for (size_t h = pq->capacity; h-- > n; ) pq->free_handles[pq->free_count++] = (int)h;
+
+	// Bottom-up heapify: sift down every internal node, last one first - O(n)
+	size_t end = pq_end(pq);
+	if (end > pq->pad + 1) {
+		for (size_t p = pq_parent(pq, end - 1) + 1; p-- > pq->pad; ) pq_sift_down(pq, p);
+	}
+	return pq;
+}
+
+
+int pq_push(priority_queue* pq, int val) {
+	// Validate input parameter: pq
+	if (!pq) {
+		printf("pq_push: NULL queue pointer\n");
+		return -1;
+	}
+
+	// Check if queue is full
+	if (pq->free_count == 0) {
+		printf("pq_push: queue is full (capacity=%zu)\n", pq->capacity);
+		return -1;
+	}
+
+	// Append as a new leaf and let it rise
+	int h = pq->free_handles[--pq->free_count];
+	sa_insert_last(pq->heap, val);
+	size_t p = pq_end(pq) - 1;
+	pq_place(pq, p, val, h);
+	pq_sift_up(pq, p);
+	return h;
+}
+
+
+int pq_peek(priority_queue* pq) {
+	// Validate input parameter: pq and check if queue is empty
+	if (!pq || pq_end(pq) == pq->pad) {
+		printf("pq_peek: queue is empty or NULL\n");
+		return -1;
+	}
+
+	return pq->data[pq->pad];
+}
+
+
+int pq_pop(priority_queue* pq) {
+	// Validate input parameter: pq and check if queue is empty
+	if (!pq || pq_end(pq) == pq->pad) {
+		printf("pq_pop: queue is empty or NULL\n");
+		return -1;
+	}
+
+	// Release the root's handle
+	size_t root = pq->pad;
+	int top = pq->data[root];
+	int h = pq->slot_handle[root];
+	pq->handle_slot[h] = PQ_NO_SLOT;
+	pq->free_handles[pq->free_count++] = h;
+
+	// Move the last leaf to the root and let it sink
+	size_t last = pq_end(pq) - 1;
+	if (last != root) pq_place(pq, root, pq->data[last], pq->slot_handle[last]);
+	sa_remove_last(pq->heap);
+	if (last != root) pq_sift_down(pq, root);
+	return top;
+}
+
+
+int pq_update_key(priority_queue* pq, int handle, int val) {
+	// Validate input parameters: pq and handle
+	if (!pq) {
+		printf("pq_update_key: NULL queue pointer\n");
+		return -1;
+	}
+	if (handle < 0 || (size_t)handle >= pq->capacity || pq->handle_slot[handle] == PQ_NO_SLOT) {
+		printf("pq_update_key: handle %d is not in the queue\n", handle);
+		return -1;
+	}
+
+	// Replace the key, then restore the heap in whichever direction it moved
+	size_t p = pq->handle_slot[handle];
+	int old = pq->data[p];
+	pq->data[p] = val;
+	if (pq->cmp(val, old)) pq_sift_up(pq, p);
+	else if (pq->cmp(old, val)) pq_sift_down(pq, p);
+	return 0;
+}
+
+
+int pq_get_key(priority_queue* pq, int handle) {
+	// Validate input parameters: pq and handle
+	if (!pq || handle < 0 || (size_t)handle >= pq->capacity || pq->handle_slot[handle] == PQ_NO_SLOT) {
+		printf("pq_get_key: handle %d is not in the queue\n", handle);
+		return -1;
+	}
+
+	return pq->data[pq->handle_slot[handle]];
+}
+
+
+size_t pq_size(priority_queue* pq) {
+	return pq ? pq_end(pq) - pq->pad : 0;
+}
+
+
+int pq_is_empty(priority_queue* pq) {
+	return pq_size(pq) == 0;
+}
+
+
+void pq_free(priority_queue* pq) {
+	// Validate input parameter: pq
+	if (!pq) return;
+
+	sa_free(pq->heap);
+	free(pq->slot_handle);
+	free(pq->handle_slot);
+	free(pq->free_handles);
+	free(pq);
+}
@@ -0,0 +1,58 @@
+#ifndef DSA_PRIORITY_QUEUE_H
+#define DSA_PRIORITY_QUEUE_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Fixed-capacity d-ary heap priority queue of ints, stored in a static_array.
+* The comparison callback follows sortingAlgorithms.c: cmp(a, b) returns 1 if a must come
+* before b, so `ascending` gives a min-queue and `descending` a max-queue.
+*
+* With arity 4 the root is stored at index 3, so the 4 children of every node start at an index
+* that is a multiple of 4: a sibling group is 16 bytes and never straddles a cache line.
+*
+* Every pushed element gets a handle (>= 0) that stays valid until the element is popped,
+* so its key can be changed later with pq_update_key (decrease-key).
+*/
+
+typedef struct priority_queue priority_queue;
+
+// Create an empty queue for `capacity` elements. arity >= 2 (2 = binary heap, 4 = cache-aligned 4-ary heap)
+priority_queue* pq_create(size_t capacity, int arity, int (*cmp)(int, int));
+
+// Create a queue holding the elements of src (heapified in O(n)). The element at src index i gets handle i
+priority_queue* pq_create_from_array(static_array* src, int arity, int (*cmp)(int, int));
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Insert val - returns its handle (>= 0) or -1 if the queue is full
+int pq_push(priority_queue* pq, int val);
+
+// Get the element that comes first (-1 with a message if the queue is empty)
+int pq_peek(priority_queue* pq);
+
+// Remove and return the element that comes first (-1 with a message if the queue is empty)
+int pq_pop(priority_queue* pq);
+
+// Change the key of a queued element (decrease-key, or increase-key). Returns 0 on success else -1
+int pq_update_key(priority_queue* pq, int handle, int val);
+
+// Get the current key of a queued element (-1 with a message if the handle is not queued)
+int pq_get_key(priority_queue* pq, int handle);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the current no. of elements
+size_t pq_size(priority_queue* pq);
+
+// Returns 1 if the queue is empty else 0
+int pq_is_empty(priority_queue* pq);
+
+// Delete the queue
+void pq_free(priority_queue* pq);
+
+
+#endif /* DSA_PRIORITY_QUEUE_H */
@@ -0,0 +1,299 @@
+/*
+Queue throughput, latency and stress check: SPSC ring, MPMC ring and a mutex-guarded static_array FIFO.
+
+    Build: gcc -O2 -pthread benchmark.c spsc_queue.c mpmc_queue.c ../arrays/static_array.c -o queue_bench
+    Usage: ./queue_bench [ops=2000000] [max_threads=4]
+
+Runs
+    spsc / spsc_batch : one producer and one consumer move `ops` ints, singly or in batches of 64;
+                        the consumer checks every value arrives in order
+    ping-pong         : round trips between two threads over a pair of SPSC queues (one-way latency = RTT / 2)
+    mpmc P x C        : P producers and C consumers for P, C = 1, 2, 4, ... max_threads. Each value encodes
+                        (producer, sequence); consumers check per-producer order and a global checksum
+    mutex P x C       : same workload on a static_array FIFO guarded by one pthread mutex (the baseline)
+and prints Mops/s. Every run prints "ok" only if no value was lost, duplicated or reordered.
+Waiting threads call sched_yield, so results stay meaningful with fewer cores than threads.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "spsc_queue.h"
+#include "mpmc_queue.h"
+#include "../arrays/static_array.h"
+
+#define QUEUE_SLOTS 1024
+#define BATCH 64
+#define SEQ_BITS 24   // Values are (producer << SEQ_BITS) | sequence
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// SPSC throughput and latency
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+typedef struct {
+    spsc_queue* q;
+    spsc_queue* back;   // Reply queue for ping-pong
+    size_t ops;
+    int batched;
+} spsc_args;
+
+static void* spsc_producer(void* p) {
+    spsc_args* a = (spsc_args*) p;
+    if (!a->batched) {
+        for (size_t i = 0; i < a->ops; i++) {
+            while (spsc_enqueue(a->q, (int)i) != 0) sched_yield();
+        }
+        return NULL;
+    }
+    int buf[BATCH];
+    size_t i = 0;
+    while (i < a->ops) {
+        size_t n = a->ops - i < BATCH ? a->ops - i : BATCH;
+        for (size_t k = 0; k < n; k++) buf[k] = (int)(i + k);
+        size_t done = 0;
+        while (done < n) {
+            size_t m = spsc_enqueue_batch(a->q, buf + done, n - done);
+            if (m == 0) sched_yield();
+            done += m;
+        }
+        i += n;
+    }
+    return NULL;
+}
+
+static void run_spsc(size_t ops, int batched) {
+    spsc_args a = { spsc_create(QUEUE_SLOTS), NULL, ops, batched };
+    pthread_t t;
+    int ok = 1;
+    int buf[BATCH];
+
+    double t0 = now_seconds();
+    pthread_create(&t, NULL, spsc_producer, &a);
+    size_t expected = 0;
+    while (expected < ops) {
+        size_t n;
+        if (batched) n = spsc_dequeue_batch(a.q, buf, BATCH);
+        else n = spsc_dequeue(a.q, buf) == 0 ? 1 : 0;
+        if (n == 0) { sched_yield(); continue; }
+        for (size_t k = 0; k < n; k++) {
+            if (buf[k] != (int)expected) ok = 0;
+            expected++;
+        }
+    }
+    pthread_join(t, NULL);
+    double secs = now_seconds() - t0;
+
+    printf("%-12s %-7s %10.2f Mops/s   %s\n", batched ? "spsc_batch" : "spsc", "1 x 1",
+           ops / secs / 1e6, ok ? "ok" : "FAILED");
+    spsc_free(a.q);
+}
+
+static void* pong(void* p) {
+    spsc_args* a = (spsc_args*) p;
+    int v;
+    for (size_t i = 0; i < a->ops; i++) {
+        while (spsc_dequeue(a->q, &v) != 0) sched_yield();
+        while (spsc_enqueue(a->back, v + 1) != 0) sched_yield();
+    }
+    return NULL;
+}
+
+static void run_ping_pong(size_t rounds) {
+    spsc_args a = { spsc_create(2), spsc_create(2), rounds, 0 };
+    pthread_t t;
+    int ok = 1, v;
+
+    double t0 = now_seconds();
+    pthread_create(&t, NULL, pong, &a);
+    for (size_t i = 0; i < rounds; i++) {
+        while (spsc_enqueue(a.q, (int)i) != 0) sched_yield();
+        while (spsc_dequeue(a.back, &v) != 0) sched_yield();
+        if (v != (int)i + 1) ok = 0;
+    }
+    pthread_join(t, NULL);
+    double secs = now_seconds() - t0;
+
+    printf("%-12s %-7s %10.1f ns one-way (%zu round trips)   %s\n", "ping-pong", "1 x 1",
+           secs * 1e9 / rounds / 2.0, rounds, ok ? "ok" : "FAILED");
+    spsc_free(a.q);
+    spsc_free(a.back);
+}
+
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Multi-producer / multi-consumer: lock-free ring vs mutex-guarded static_array
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+typedef struct {
+    static_array* arr;
+    pthread_mutex_t lock;
+} locked_fifo;
+
+static int locked_enqueue(locked_fifo* f, int val) {
+    pthread_mutex_lock(&f->lock);
+    int rc = -1;
+    if (sa_size(f->arr) < sa_capacity(f->arr)) rc = sa_insert_last(f->arr, val);
+    pthread_mutex_unlock(&f->lock);
+    return rc;
+}
+
+static int locked_dequeue(locked_fifo* f, int* out) {
+    pthread_mutex_lock(&f->lock);
+    int rc = -1;
+    if (sa_size(f->arr) > 0) {
+        *out = sa_get_first(f->arr);
+        rc = sa_remove_first(f->arr);
+    }
+    pthread_mutex_unlock(&f->lock);
+    return rc;
+}
+
+typedef struct {
+    mpmc_queue* mq;           // NULL selects the mutex FIFO
+    locked_fifo* fifo;
+    int id;
+    int producers;
+    size_t per_producer;
+    size_t* remaining;        // Values still to be consumed, shared by consumers
+    pthread_mutex_t* remaining_lock;
+    unsigned long long checksum;
+    int ok;
+} mp_args;
+
+static void* mp_producer(void* p) {
+    mp_args* a = (mp_args*) p;
+    for (size_t i = 0; i < a->per_producer; i++) {
+        int v = (a->id << SEQ_BITS) | (int)i;
+        if (a->mq) { while (mpmc_enqueue(a->mq, v) != 0) sched_yield(); }
+        else       { while (locked_enqueue(a->fifo, v) != 0) sched_yield(); }
+    }
+    return NULL;
+}
+
+// Claims up to BATCH values from the shared remaining counter, so consumers know when to stop
+static size_t claim(mp_args* a) {
+    pthread_mutex_lock(a->remaining_lock);
+    size_t n = *a->remaining < BATCH ? *a->remaining : BATCH;
+    *a->remaining -= n;
+    pthread_mutex_unlock(a->remaining_lock);
+    return n;
+}
+
+static void* mp_consumer(void* p) {
+    mp_args* a = (mp_args*) p;
+    long long last[64];
+    for (int i = 0; i < a->producers; i++) last[i] = -1;
+
+    size_t n;
+    while ((n = claim(a)) > 0) {
+        for (size_t k = 0; k < n; k++) {
+            int v;
+            if (a->mq) { while (mpmc_dequeue(a->mq, &v) != 0) sched_yield(); }
+            else       { while (locked_dequeue(a->fifo, &v) != 0) sched_yield(); }
+            int producer = v >> SEQ_BITS;
+            long long seq = v & ((1 << SEQ_BITS) - 1);
+            // Values from one producer must reach any single consumer in increasing order
+            if (producer >= a->producers || seq <= last[producer]) a->ok = 0;
+            else last[producer] = seq;
+            a->checksum += (unsigned long long)v;
+        }
+    }
+    return NULL;
+}
+
+static void run_mp(size_t ops, int producers, int consumers, int use_mutex) {
+    size_t per_producer = ops / (size_t)producers;
+    size_t remaining = per_producer * (size_t)producers;
+    pthread_mutex_t remaining_lock = PTHREAD_MUTEX_INITIALIZER;
+    locked_fifo fifo;
+    mpmc_queue* mq = NULL;
+    if (use_mutex) {
+        fifo.arr = sa_create_array(QUEUE_SLOTS);
+        pthread_mutex_init(&fifo.lock, NULL);
+    } else {
+        mq = mpmc_create(QUEUE_SLOTS);
+    }
+
+    int total = producers + consumers;
+    pthread_t* threads = (pthread_t*) malloc(sizeof(pthread_t) * (size_t)total);
+    mp_args* args = (mp_args*) malloc(sizeof(mp_args) * (size_t)total);
+    if (!threads || !args) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    double t0 = now_seconds();
+    for (int i = 0; i < total; i++) {
+        mp_args a = { mq, &fifo, i < producers ? i : -1, producers, per_producer,
+                      &remaining, &remaining_lock, 0, 1 };
+        args[i] = a;
+        pthread_create(&threads[i], NULL, i < producers ? mp_producer : mp_consumer, &args[i]);
+    }
+    for (int i = 0; i < total; i++) pthread_join(threads[i], NULL);
+    double secs = now_seconds() - t0;
+
+    // Expected checksum: sum over producers of (id << SEQ_BITS) * per_producer + 0 + 1 + ... + per_producer - 1
+    unsigned long long expected = 0, got = 0;
+    int ok = 1;
+    for (int p = 0; p < producers; p++) {
+        expected += ((unsigned long long)p << SEQ_BITS) * per_producer
+                  + (unsigned long long)per_producer * (per_producer - 1) / 2;
+    }
+    for (int i = producers; i < total; i++) {
+        got += args[i].checksum;
+        if (!args[i].ok) ok = 0;
+    }
+    if (got != expected) ok = 0;
+    if (use_mutex ? sa_size(fifo.arr) != 0 : mpmc_size(mq) != 0) ok = 0;
+
+    char label[16];
+    snprintf(label, sizeof(label), "%d x %d", producers, consumers);
+    printf("%-12s %-7s %10.2f Mops/s   %s\n", use_mutex ? "mutex" : "mpmc", label,
+           (double)(per_producer * (size_t)producers) / secs / 1e6,
+           ok ? "ok" : "FAILED");
+
+    if (use_mutex) {
+        sa_free(fifo.arr);
+        pthread_mutex_destroy(&fifo.lock);
+    } else {
+        mpmc_free(mq);
+    }
+    free(threads);
+    free(args);
+}
+
+
+int main(int argc, char** argv) {
+    size_t ops = argc > 1 ? strtoull(argv[1], NULL, 10) : 2000000;
+    int max_threads = argc > 2 ? atoi(argv[2]) : 4;
+    if (ops == 0 || max_threads < 1 || max_threads > 64) {
+        printf("Usage: %s [ops > 0] [max_threads 1..64]\n", argv[0]);
+        return 1;
+    }
+    if (ops >= ((size_t)1 << SEQ_BITS)) ops = ((size_t)1 << SEQ_BITS) - 1;
+
+    printf("%-12s %-7s %s\n", "queue", "P x C", "result");
+    run_spsc(ops, 0);
+    run_spsc(ops, 1);
+    run_ping_pong(ops / 20 > 0 ? ops / 20 : 1);
+    for (int p = 1; p <= max_threads; p *= 2) {
+        for (int c = 1; c <= max_threads; c *= 2) {
+            run_mp(ops, p, c, 0);
+            run_mp(ops, p, c, 1);
+        }
+    }
+    return 0;
+}
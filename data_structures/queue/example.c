@@ -0,0 +1,67 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include "spsc_queue.h"
+#include "mpmc_queue.h"
+
+#define ITEMS 100000
+
+static void* producer(void* arg) {
+    spsc_queue* q = (spsc_queue*) arg;
+    for (int i = 1; i <= ITEMS; i++) {
+        while (spsc_enqueue(q, i) != 0) sched_yield();
+    }
+    return NULL;
+}
+
+int main(void) {
+
+    printf("\n\n============================| QUEUE EXAMPLE |============================\n\n");
+
+    // Single-threaded use: FIFO order, full and empty reports
+    spsc_queue* q = spsc_create(5);
+    printf("SPSC capacity (5 rounded up): %zu\n", spsc_capacity(q));
+    int vals[10] = {1,2,3,4,5,6,7,8,9,10};
+    size_t pushed = spsc_enqueue_batch(q, vals, 10);
+    printf("Batch enqueue of 10 values accepted %zu, size=%zu\n", pushed, spsc_size(q));
+    printf("Enqueue into full queue returns %d\n", spsc_enqueue(q, 99));
+
+    int out[10];
+    size_t popped = spsc_dequeue_batch(q, out, 3);
+    printf("Batch dequeue of 3: ");
+    for (size_t i = 0; i < popped; i++) printf("%d ", out[i]);
+    printf("\n");
+    int v;
+    printf("Remaining: ");
+    while (spsc_dequeue(q, &v) == 0) printf("%d ", v);
+    printf("\n");
+
+    // Two threads: one producer, the main thread consumes and checks the order
+    pthread_t t;
+    pthread_create(&t, NULL, producer, q);
+    long long sum = 0;
+    int expected = 1, in_order = 1;
+    while (expected <= ITEMS) {
+        if (spsc_dequeue(q, &v) != 0) { sched_yield(); continue; }
+        if (v != expected) in_order = 0;
+        sum += v;
+        expected++;
+    }
+    pthread_join(t, NULL);
+    printf("Threaded SPSC: received %d values, sum=%lld, in order=%s\n", ITEMS, sum, in_order ? "yes" : "no");
+    spsc_free(q);
+
+    // MPMC queue used from a single thread
+    mpmc_queue* mq = mpmc_create(4);
+    for (int i = 10; i <= 50; i += 10) {
+        if (mpmc_enqueue(mq, i) != 0) printf("MPMC full, %d rejected\n", i);
+    }
+    printf("MPMC contents: ");
+    while (mpmc_dequeue(mq, &v) == 0) printf("%d ", v);
+    printf("\n");
+    mpmc_free(mq);
+
+    return 0;
+}
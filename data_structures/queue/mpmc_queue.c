@@ -0,0 +1,135 @@
+#include "mpmc_queue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define MPMC_CACHE_LINE 64
+
+/*
+* Slot protocol: slot i of lap L (position pos = L * capacity + i) is
+*   free for the producer of pos   when seq == pos
+*   full for the consumer of pos   when seq == pos + 1
+* A producer claims pos with a CAS on enqueue_pos, writes the value and sets seq = pos + 1.
+* A consumer claims pos with a CAS on dequeue_pos, reads the value and sets seq = pos + capacity,
+* which frees the slot for the producer of the next lap.
+*/
+
+typedef struct mpmc_cell {
+	_Atomic size_t seq;
+	int val;
+} mpmc_cell;
+
+typedef struct mpmc_queue {
+	_Alignas(MPMC_CACHE_LINE) mpmc_cell* buffer;
+	size_t mask;
+	_Alignas(MPMC_CACHE_LINE) _Atomic size_t enqueue_pos;
+	_Alignas(MPMC_CACHE_LINE) _Atomic size_t dequeue_pos;
+} mpmc_queue;
+
+
+mpmc_queue* mpmc_create(size_t capacity) {
+	// Validate input parameter: capacity
+	if (capacity == 0) {
+		printf("Requested capacity must be > 0\n");
+		return NULL;
+	}
+
+	// Memory allocation: mpmc_queue struct, cache-line aligned
+	mpmc_queue* q = (mpmc_queue*) aligned_alloc(MPMC_CACHE_LINE, sizeof(mpmc_queue));
+	if (!q) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct mpmc_queue!\n");
+		exit(1);
+	}
+
+	// Memory allocation: q->buffer (power-of-two slots so positions wrap with a mask)
+	size_t slots = 2;
+	while (slots < capacity) slots <<= 1;
+	q->buffer = (mpmc_cell*) malloc(sizeof(mpmc_cell) * slots);
+	if (!q->buffer) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu slots in the queue\n", slots);
+		free(q);
+		exit(1);
+	}
+
+	// Every slot starts free for lap 0
+	for (size_t i = 0; i < slots; i++) atomic_init(&q->buffer[i].seq, i);
+	q->mask = slots - 1;
+	atomic_init(&q->enqueue_pos, 0);
+	atomic_init(&q->dequeue_pos, 0);
+	return q;
+}
+
+
+int mpmc_enqueue(mpmc_queue* q, int val) {
+	size_t pos = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed);
+	mpmc_cell* cell;
+	for (;;) {
+		cell = &q->buffer[pos & q->mask];
+		size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+		intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+		if (diff == 0) {
+			// Slot is free for this lap: try to claim the position
+			if (atomic_compare_exchange_weak_explicit(&q->enqueue_pos, &pos, pos + 1,
+			                                          memory_order_relaxed, memory_order_relaxed)) break;
+		} else if (diff < 0) {
+			// The consumer of the previous lap has not freed the slot: queue full
+			return -1;
+		} else {
+			// Another producer took pos: retry with the current position
+			pos = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed);
+		}
+	}
+
+	cell->val = val;
+	atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+	return 0;
+}
+
+
+int mpmc_dequeue(mpmc_queue* q, int* out) {
+	size_t pos = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed);
+	mpmc_cell* cell;
+	for (;;) {
+		cell = &q->buffer[pos & q->mask];
+		size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+		intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+		if (diff == 0) {
+			// Slot is full for this lap: try to claim the position
+			if (atomic_compare_exchange_weak_explicit(&q->dequeue_pos, &pos, pos + 1,
+			                                          memory_order_relaxed, memory_order_relaxed)) break;
+		} else if (diff < 0) {
+			// The producer of this lap has not written the slot yet: queue empty
+			return -1;
+		} else {
+			// Another consumer took pos: retry with the current position
+			pos = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed);
+		}
+	}
+
+	*out = cell->val;
+	atomic_store_explicit(&cell->seq, pos + q->mask + 1, memory_order_release);
+	return 0;
+}
+
+
+size_t mpmc_size(mpmc_queue* q) {
+	if (!q) return 0;
+	size_t head = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed);
+	size_t tail = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed);
+	return tail > head ? tail - head : 0;
+}
+
+
+size_t mpmc_capacity(mpmc_queue* q) {
+	return q ? q->mask + 1 : 0;
+}
+
+
+void mpmc_free(mpmc_queue* q) {
+	// Validate input parameter: q
+	if (!q) return;
+	free(q->buffer);
+	free(q);
+}
@@ -0,0 +1,36 @@
+#ifndef DSA_MPMC_QUEUE_H
+#define DSA_MPMC_QUEUE_H
+
+
+#include <stddef.h>
+
+
+/*
+* Bounded multi-producer / multi-consumer queue of ints (Dmitry Vyukov's array queue).
+* Every slot carries a sequence number that tells producers and consumers whether it is free
+* for the current lap, so each operation costs one CAS on the shared enqueue or dequeue
+* index and no locks. FIFO order holds per producer.
+*/
+
+typedef struct mpmc_queue mpmc_queue;
+
+// Create a queue for at least `capacity` elements (rounded up to a power of two, minimum 2)
+mpmc_queue* mpmc_create(size_t capacity);
+
+// Append val - returns 0 on success else -1 (queue full). Safe from any thread
+int mpmc_enqueue(mpmc_queue* q, int val);
+
+// Take the oldest element into *out - returns 0 on success else -1 (queue empty). Safe from any thread
+int mpmc_dequeue(mpmc_queue* q, int* out);
+
+// Approximate no. of queued elements
+size_t mpmc_size(mpmc_queue* q);
+
+// Get the capacity
+size_t mpmc_capacity(mpmc_queue* q);
+
+// Delete the queue (no thread may be using it)
+void mpmc_free(mpmc_queue* q);
+
+
+#endif /* DSA_MPMC_QUEUE_H */
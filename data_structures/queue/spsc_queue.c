@@ -0,0 +1,142 @@
+#include "spsc_queue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#define SPSC_CACHE_LINE 64
+
+typedef struct spsc_queue {
+	// Producer's cache line
+	_Alignas(SPSC_CACHE_LINE) _Atomic size_t tail;  // Next slot to write
+	size_t cached_head;                              // Producer's last view of head
+
+	// Consumer's cache line
+	_Alignas(SPSC_CACHE_LINE) _Atomic size_t head;  // Next slot to read
+	size_t cached_tail;                              // Consumer's last view of tail
+
+	// Read-only after creation
+	_Alignas(SPSC_CACHE_LINE) int* buffer;
+	size_t mask;
+} spsc_queue;
+
+
+spsc_queue* spsc_create(size_t capacity) {
+	// Validate input parameter: capacity
+	if (capacity == 0) {
+		printf("Requested capacity must be > 0\n");
+		return NULL;
+	}
+
+	// Memory allocation: spsc_queue struct, cache-line aligned
+	spsc_queue* q = (spsc_queue*) aligned_alloc(SPSC_CACHE_LINE, sizeof(spsc_queue));
+	if (!q) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct spsc_queue!\n");
+		exit(1);
+	}
+
+	// Memory allocation: q->buffer (power-of-two slots so indices wrap with a mask)
+	size_t slots = 1;
+	while (slots < capacity) slots <<= 1;
+	q->buffer = (int*) malloc(sizeof(int) * slots);
+	if (!q->buffer) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu integers in the queue\n", slots);
+		free(q);
+		exit(1);
+	}
+
+	// Initialize struct members
+	atomic_init(&q->tail, 0);
+	atomic_init(&q->head, 0);
+	q->cached_head = 0;
+	q->cached_tail = 0;
+	q->mask = slots - 1;
+	return q;
+}
+
+
+// Free slots as seen by the producer; refreshes the cached head only when the cached view says full
+static inline size_t spsc_free_slots(spsc_queue* q, size_t tail, size_t want) {
+	size_t capacity = q->mask + 1;
+	size_t free_slots = capacity - (tail - q->cached_head);
+	if (free_slots < want) {
+		q->cached_head = atomic_load_explicit(&q->head, memory_order_acquire);
+		free_slots = capacity - (tail - q->cached_head);
+	}
+	return free_slots;
+}
+
+// Filled slots as seen by the consumer; refreshes the cached tail only when the cached view says empty
+static inline size_t spsc_filled_slots(spsc_queue* q, size_t head, size_t want) {
+	size_t filled = q->cached_tail - head;
+	if (filled < want) {
+		q->cached_tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+		filled = q->cached_tail - head;
+	}
+	return filled;
+}
+
+
+int spsc_enqueue(spsc_queue* q, int val) {
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	if (spsc_free_slots(q, tail, 1) == 0) return -1;
+
+	q->buffer[tail & q->mask] = val;
+	atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+	return 0;
+}
+
+
+size_t spsc_enqueue_batch(spsc_queue* q, const int* vals, size_t n) {
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	size_t free_slots = spsc_free_slots(q, tail, n);
+	if (n > free_slots) n = free_slots;
+
+	// Copy everything first, then publish all n elements with a single store
+	for (size_t i = 0; i < n; i++) q->buffer[(tail + i) & q->mask] = vals[i];
+	atomic_store_explicit(&q->tail, tail + n, memory_order_release);
+	return n;
+}
+
+
+int spsc_dequeue(spsc_queue* q, int* out) {
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+	if (spsc_filled_slots(q, head, 1) == 0) return -1;
+
+	*out = q->buffer[head & q->mask];
+	atomic_store_explicit(&q->head, head + 1, memory_order_release);
+	return 0;
+}
+
+
+size_t spsc_dequeue_batch(spsc_queue* q, int* out, size_t n) {
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+	size_t filled = spsc_filled_slots(q, head, n);
+	if (n > filled) n = filled;
+
+	// Copy everything first, then release all n slots with a single store
+	for (size_t i = 0; i < n; i++) out[i] = q->buffer[(head + i) & q->mask];
+	atomic_store_explicit(&q->head, head + n, memory_order_release);
+	return n;
+}
+
+
+size_t spsc_size(spsc_queue* q) {
+	if (!q) return 0;
+	size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+	return tail - head;
+}
+
+
+size_t spsc_capacity(spsc_queue* q) {
+	return q ? q->mask + 1 : 0;
+}
+
+
+void spsc_free(spsc_queue* q) {
+	// Validate input parameter: q
+	if (!q) return;
+	free(q->buffer);
+	free(q);
+}
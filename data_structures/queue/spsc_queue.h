@@ -0,0 +1,43 @@
+#ifndef DSA_SPSC_QUEUE_H
+#define DSA_SPSC_QUEUE_H
+
+
+#include <stddef.h>
+
+
+/*
+* Bounded wait-free single-producer / single-consumer ring buffer of ints.
+* Exactly one thread may enqueue and exactly one (other) thread may dequeue at a time.
+* Head and tail indices live on separate cache lines, and each side keeps a cached copy of
+* the other side's index, so in steady state an operation touches no shared cache line
+* except the slot itself. Batch operations publish many elements with one index update.
+*/
+
+typedef struct spsc_queue spsc_queue;
+
+// Create a queue for at least `capacity` elements (rounded up to a power of two)
+spsc_queue* spsc_create(size_t capacity);
+
+// Producer: append val - returns 0 on success else -1 (queue full)
+int spsc_enqueue(spsc_queue* q, int val);
+
+// Producer: append up to n values - returns how many were enqueued
+size_t spsc_enqueue_batch(spsc_queue* q, const int* vals, size_t n);
+
+// Consumer: take the oldest element into *out - returns 0 on success else -1 (queue empty)
+int spsc_dequeue(spsc_queue* q, int* out);
+
+// Consumer: take up to n elements into out - returns how many were dequeued
+size_t spsc_dequeue_batch(spsc_queue* q, int* out, size_t n);
+
+// Approximate no. of queued elements (exact when neither side is running)
+size_t spsc_size(spsc_queue* q);
+
+// Get the capacity
+size_t spsc_capacity(spsc_queue* q);
+
+// Delete the queue (no thread may be using it)
+void spsc_free(spsc_queue* q);
+
+
+#endif /* DSA_SPSC_QUEUE_H */
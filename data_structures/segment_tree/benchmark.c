@@ -0,0 +1,183 @@
+/*
+Range-query benchmark: segment tree vs rescanning the static_array.
+
+    Build: gcc -O2 benchmark.c segment_tree.c ../arrays/static_array.c -o segment_bench
+    Usage: ./segment_bench [max_elements=10000000]
+
+For n = 1K, 10K, ... up to max_elements random ints it measures
+    build     : seg_create_from_array (ms)
+    min query : seg_query on a SEG_MIN tree vs a min over the range of sa_data
+    sum query : seg_query on a SEG_SUM tree vs a sum over the range of sa_data
+    range add : seg_range_add vs adding to every element of the range
+    mixed     : 1/3 point sets (sa_modify_at + seg_set), 1/3 range adds, 1/3 min queries
+and prints ns per operation over random ranges. The rescans get a bounded budget of element
+visits per size. Both sides must produce the same answers, checked in the last column.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "segment_tree.h"
+#include "../arrays/static_array.h"
+
+#define OPS            1000000
+#define SCAN_BUDGET    300000000ull   // Element visits allowed for one rescan measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Random inclusive range [*lo, *hi] in [0, n)
+static void random_range(size_t n, size_t* lo, size_t* hi) {
+    size_t a = next_random() % n, b = next_random() % n;
+    *lo = a < b ? a : b;
+    *hi = a < b ? b : a;
+}
+
+static long long scan_min(const int* d, size_t lo, size_t hi) {
+    int m = d[lo];
+    for (size_t i = lo + 1; i <= hi; i++) m = d[i] < m ? d[i] : m;
+    return m;
+}
+
+static long long scan_sum(const int* d, size_t lo, size_t hi) {
+    long long sum = 0;
+    for (size_t i = lo; i <= hi; i++) sum += d[i];
+    return sum;
+}
+
+static void scan_add(int* d, size_t lo, size_t hi, int delta) {
+    for (size_t i = lo; i <= hi; i++) d[i] += delta;
+}
+
+static void run(size_t n) {
+    static_array* arr = sa_create_array(n);
+    for (size_t i = 0; i < n; i++) sa_insert_last(arr, (int)(next_random() % 2000001) - 1000000);
+    int ok = 1;
+    size_t lo, hi;
+
+    // build
+    double t0 = now_seconds();
+    segment_tree* mins = seg_create_from_array(arr, SEG_MIN);
+    double build = (now_seconds() - t0) * 1e3;
+    segment_tree* sums = seg_create_from_array(arr, SEG_SUM);
+
+    size_t scans = (size_t)(SCAN_BUDGET / (n / 3 + 1));
+    if (scans > OPS) scans = OPS;
+    if (scans == 0) scans = 1;
+
+    // min and sum queries: the tree runs OPS queries, the rescan the first `scans` of the same ranges
+    double q_tree[2], q_scan[2];
+    for (int kind = 0; kind < 2; kind++) {
+        segment_tree* st = kind == 0 ? mins : sums;
+        uint64_t saved = rng_state;
+        long long check_tree = 0, check_scan = 0;
+        t0 = now_seconds();
+        for (size_t i = 0; i < OPS; i++) {
+            random_range(n, &lo, &hi);
+            long long r = seg_query(st, lo, hi);
+            if (i < scans) check_tree += r;
+        }
+        q_tree[kind] = (now_seconds() - t0) * 1e9 / OPS;
+        rng_state = saved;
+        const int* d = sa_data(arr);
+        t0 = now_seconds();
+        for (size_t i = 0; i < scans; i++) {
+            random_range(n, &lo, &hi);
+            check_scan += kind == 0 ? scan_min(d, lo, hi) : scan_sum(d, lo, hi);
+        }
+        q_scan[kind] = (now_seconds() - t0) * 1e9 / scans;
+        if (check_tree != check_scan) ok = 0;
+    }
+
+    // range add: same ranges and deltas on both sides (the array then holds the same values as the tree)
+    uint64_t saved = rng_state;
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        random_range(n, &lo, &hi);
+        seg_range_add(mins, lo, hi, (long long)(next_random() % 21) - 10);
+    }
+    double add_tree = (now_seconds() - t0) * 1e9 / scans;
+    rng_state = saved;
+    int* d = sa_data(arr);
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        random_range(n, &lo, &hi);
+        scan_add(d, lo, hi, (int)(next_random() % 21) - 10);
+    }
+    double add_scan = (now_seconds() - t0) * 1e9 / scans;
+    if (seg_query(mins, 0, n - 1) != scan_min(d, 0, n - 1)) ok = 0;
+
+    // mixed: both sides replay the same stream from the same contents
+    int* before = (int*) malloc(n * sizeof(int));
+    if (!before) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    memcpy(before, d, n * sizeof(int));
+    long long check_tree = 0, check_scan = 0;
+    saved = rng_state;
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        int op = (int)(next_random() % 3);
+        random_range(n, &lo, &hi);
+        int val = (int)(next_random() % 21) - 10;
+        if (op == 0) {
+            sa_modify_at(arr, lo, val);
+            seg_set(mins, lo, val);
+        } else if (op == 1) {
+            seg_range_add(mins, lo, hi, val);
+        } else {
+            check_tree += seg_query(mins, lo, hi);
+        }
+    }
+    double mixed_tree = (now_seconds() - t0) * 1e9 / scans;
+    memcpy(d, before, n * sizeof(int));
+    rng_state = saved;
+    t0 = now_seconds();
+    for (size_t i = 0; i < scans; i++) {
+        int op = (int)(next_random() % 3);
+        random_range(n, &lo, &hi);
+        int val = (int)(next_random() % 21) - 10;
+        if (op == 0) sa_modify_at(arr, lo, val);
+        else if (op == 1) scan_add(d, lo, hi, val);
+        else check_scan += scan_min(d, lo, hi);
+    }
+    double mixed_scan = (now_seconds() - t0) * 1e9 / scans;
+    if (check_tree != check_scan) ok = 0;
+
+    printf("%10zu | %7.2f | %7.1f %11.1f | %7.1f %11.1f | %7.1f %11.1f | %7.1f %11.1f | %s\n", n, build,
+           q_tree[0], q_scan[0], q_tree[1], q_scan[1], add_tree, add_scan, mixed_tree, mixed_scan,
+           ok ? "ok" : "MISMATCH");
+
+    free(before);
+    seg_free(mins);
+    seg_free(sums);
+    sa_free(arr);
+}
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+
+    printf("%10s | %7s | %19s | %19s | %19s | %19s |\n", "", "build", "min query ns", "sum query ns",
+           "range add ns", "mixed ns");
+    printf("%10s | %7s | %7s %11s | %7s %11s | %7s %11s | %7s %11s |\n", "elements", "ms",
+           "tree", "rescan", "tree", "rescan", "tree", "rescan", "tree", "rescan");
+    for (size_t n = 1000; n <= max_elements; n *= 10) run(n);
+    return 0;
+}
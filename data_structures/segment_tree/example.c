@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include "segment_tree.h"
+#include "../arrays/static_array.h"
+
+int main(void) {
+
+    printf("\n\n============================| SEGMENT TREE EXAMPLE |============================\n\n");
+
+    static_array* arr = sa_create_array(10);
+    int values[10] = {4, 8, 1, 9, 3, 7, 2, 6, 5, 0};
+    for (int i = 0; i < 10; i++) sa_insert_last(arr, values[i]);
+    printf("Array: ");
+    sa_display(arr);
+
+    segment_tree* mins = seg_create_from_array(arr, SEG_MIN);
+    segment_tree* maxs = seg_create_from_array(arr, SEG_MAX);
+    segment_tree* sums = seg_create_from_array(arr, SEG_SUM);
+    printf("Indices 1..5: min=%lld max=%lld sum=%lld\n",
+           seg_query(mins, 1, 5), seg_query(maxs, 1, 5), seg_query(sums, 1, 5));
+
+    // Point update, mirrored into the array
+    sa_modify_at(arr, 2, 20);
+    seg_set(mins, 2, 20);
+    seg_set(maxs, 2, 20);
+    seg_set(sums, 2, 20);
+    printf("After arr[2] = 20, indices 1..5: min=%lld max=%lld sum=%lld\n",
+           seg_query(mins, 1, 5), seg_query(maxs, 1, 5), seg_query(sums, 1, 5));
+
+    // Lazy range add: +100 to indices 4..7
+    seg_range_add(mins, 4, 7, 100);
+    seg_range_add(maxs, 4, 7, 100);
+    seg_range_add(sums, 4, 7, 100);
+    printf("After adding 100 to indices 4..7, indices 0..9: min=%lld max=%lld sum=%lld, element 5=%lld\n",
+           seg_query(mins, 0, 9), seg_query(maxs, 0, 9), seg_query(sums, 0, 9), seg_get(sums, 5));
+
+    seg_free(mins);
+    seg_free(maxs);
+    seg_free(sums);
+    sa_free(arr);
+    return 0;
+}
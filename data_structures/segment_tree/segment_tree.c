@@ -0,0 +1,204 @@
+#include "segment_tree.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+* Layout: tree[n + i] is element i, tree[p] = combine(tree[2p], tree[2p + 1]) + pending add of p.
+* lazy[p] (p < n) is an add that has been applied to tree[p] but not yet to p's children.
+* For sums a pending add counts once per leaf under the node, so the loops track the node
+* width k (1 at the leaves, doubling per level); for min/max it counts once.
+* Queries push pending adds down along the two boundary paths first, then combine the
+* nodes that exactly cover the range while walking both ends up.
+*/
+
+typedef struct segment_tree {
+	long long* tree;    // 2n entries, tree[0] unused
+	long long* lazy;    // n entries, lazy[0] unused
+	size_t n;
+	int height;         // No. of bits in n: the leaf-to-root path length for push
+	seg_op op;
+} segment_tree;
+
+
+static inline long long seg_combine(seg_op op, long long a, long long b) {
+	switch (op) {
+		case SEG_MIN: return a < b ? a : b;
+		case SEG_MAX: return a > b ? a : b;
+		default:      return a + b;
+	}
+}
+
+// Apply an add of v to node p covering k leaves
+static inline void seg_apply(segment_tree* st, size_t p, long long v, size_t k) {
+	st->tree[p] += st->op == SEG_SUM ? v * (long long)k : v;
+	if (p < st->n) st->lazy[p] += v;
+}
+
+// Recompute the ancestors of p from their children
+static void seg_rebuild(segment_tree* st, size_t p) {
+	size_t k = 2;
+	while (p > 1) {
+		p >>= 1;
+		long long pending = st->op == SEG_SUM ? st->lazy[p] * (long long)k : st->lazy[p];
+		st->tree[p] = seg_combine(st->op, st->tree[2 * p], st->tree[2 * p + 1]) + pending;
+		k <<= 1;
+	}
+}
+
+// Push the pending adds of every ancestor of p down to their children, root first
+static void seg_push(segment_tree* st, size_t p) {
+	size_t k = (size_t)1 << (st->height - 1);
+	for (int s = st->height; s > 0; s--, k >>= 1) {
+		size_t i = p >> s;
+		if (i > 0 && st->lazy[i] != 0) {
+			seg_apply(st, 2 * i, st->lazy[i], k);
+			seg_apply(st, 2 * i + 1, st->lazy[i], k);
+			st->lazy[i] = 0;
+		}
+	}
+}
+
+static segment_tree* seg_alloc(size_t n, seg_op op) {
+	// Memory allocation: segment_tree struct
+	segment_tree* st = (segment_tree*) malloc(sizeof(segment_tree));
+	if (!st) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct segment_tree!\n");
+		exit(1);
+	}
+
+	// Memory allocation: st->tree and st->lazy, zeroed
+	st->tree = (long long*) calloc(2 * n, sizeof(long long));
+	st->lazy = (long long*) calloc(n, sizeof(long long));
+	if (!st->tree || !st->lazy) {
+		printf("Memory allocation failed: couldn't allocate memory for a segment tree of %zu elements\n", n);
+		exit(1);
+	}
+
+	st->n = n;
+	st->op = op;
+	st->height = 0;
+	while (((size_t)1 << st->height) <= n) st->height++;
+	return st;
+}
+
+
+segment_tree* seg_create(size_t n, seg_op op) {
+	// Validate input parameter: n
+	if (n == 0) {
+		printf("Requested size must be > 0\n");
+		return NULL;
+	}
+	return seg_alloc(n, op);
+}
+
+
+segment_tree* seg_create_from_array(static_array* arr, seg_op op) {
+	// Validate input parameter: arr
+	if (!arr || sa_size(arr) == 0) {
+		printf("seg_create_from_array: NULL or empty array\n");
+		return NULL;
+	}
+
+	size_t n = sa_size(arr);
+	const int* data = sa_const_data(arr);
+	segment_tree* st = seg_alloc(n, op);
+
+	// Leaves straight from the array buffer, then every internal node once, bottom-up - O(n)
+	for (size_t i = 0; i < n; i++) st->tree[n + i] = data[i];
+	for (size_t p = n - 1; p > 0; p--) st->tree[p] = seg_combine(op, st->tree[2 * p], st->tree[2 * p + 1]);
+	return st;
+}
+
+
+int seg_set(segment_tree* st, size_t index, long long val) {
+	// Validate input parameters: st and index
+	if (!st || index >= st->n) {
+		printf("seg_set: index %zu out of range or NULL tree\n", index);
+		return -1;
+	}
+
+	size_t p = index + st->n;
+	seg_push(st, p);
+	st->tree[p] = val;
+	seg_rebuild(st, p);
+	return 0;
+}
+
+
+int seg_range_add(segment_tree* st, size_t lo, size_t hi, long long delta) {
+	// Validate input parameters: st and range
+	if (!st || lo > hi || hi >= st->n) {
+		printf("seg_range_add: invalid range [%zu, %zu] or NULL tree\n", lo, hi);
+		return -1;
+	}
+
+	size_t l = lo + st->n, r = hi + 1 + st->n;
+	size_t l0 = l, r0 = r;
+	for (size_t k = 1; l < r; l >>= 1, r >>= 1, k <<= 1) {
+		if (l & 1) seg_apply(st, l++, delta, k);
+		if (r & 1) seg_apply(st, --r, delta, k);
+	}
+	seg_rebuild(st, l0);
+	seg_rebuild(st, r0 - 1);
+	return 0;
+}
+
+
+long long seg_query(segment_tree* st, size_t lo, size_t hi) {
+	// Validate input parameters: st and range
+	if (!st || lo > hi || hi >= st->n) {
+		printf("seg_query: invalid range [%zu, %zu] or NULL tree\n", lo, hi);
+		return 0;
+	}
+
+	size_t l = lo + st->n, r = hi + 1 + st->n;
+	seg_push(st, l);
+	seg_push(st, r - 1);
+
+	// Left and right partial results are kept apart so the walk works for any associative op
+	int has_left = 0, has_right = 0;
+	long long left = 0, right = 0;
+	for (; l < r; l >>= 1, r >>= 1) {
+		if (l & 1) {
+			left = has_left ? seg_combine(st->op, left, st->tree[l]) : st->tree[l];
+			has_left = 1;
+			l++;
+		}
+		if (r & 1) {
+			--r;
+			right = has_right ? seg_combine(st->op, st->tree[r], right) : st->tree[r];
+			has_right = 1;
+		}
+	}
+	if (!has_left) return right;
+	if (!has_right) return left;
+	return seg_combine(st->op, left, right);
+}
+
+
+long long seg_get(segment_tree* st, size_t index) {
+	// Validate input parameters: st and index
+	if (!st || index >= st->n) {
+		printf("seg_get: index %zu out of range or NULL tree\n", index);
+		return 0;
+	}
+
+	size_t p = index + st->n;
+	seg_push(st, p);
+	return st->tree[p];
+}
+
+
+size_t seg_size(const segment_tree* st) {
+	return st ? st->n : 0;
+}
+
+
+void seg_free(segment_tree* st) {
+	// Validate input parameter: st
+	if (!st) return;
+	free(st->tree);
+	free(st->lazy);
+	free(st);
+}
@@ -0,0 +1,53 @@
+#ifndef DSA_SEGMENT_TREE_H
+#define DSA_SEGMENT_TREE_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Iterative (bottom-up) segment tree over n values for range sum, min or max queries,
+* with point assignment and lazy range add. The n leaves sit at tree[n, 2n) and node i
+* combines nodes 2i and 2i + 1, so there is no recursion and no padding to a power of two.
+* Values and results are long long. Indices are 0-based and ranges inclusive, like static_array.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct segment_tree segment_tree;
+
+// Aggregate answered by seg_query
+typedef enum { SEG_SUM, SEG_MIN, SEG_MAX } seg_op;
+
+// Create a tree over n zeros
+segment_tree* seg_create(size_t n, seg_op op);
+
+// Create a tree over the elements of arr (built in O(n))
+segment_tree* seg_create_from_array(static_array* arr, seg_op op);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Set the element at index to val (the counterpart of sa_modify_at). Returns 0 on success else -1
+int seg_set(segment_tree* st, size_t index, long long val);
+
+// Add delta to every element at indices lo..hi (inclusive), O(log n). Returns 0 on success else -1
+int seg_range_add(segment_tree* st, size_t lo, size_t hi, long long delta);
+
+// Sum / min / max of the elements at indices lo..hi (inclusive). 0 with a message if the range is invalid
+long long seg_query(segment_tree* st, size_t lo, size_t hi);
+
+// Get the element at index (0 with a message if out of range)
+long long seg_get(segment_tree* st, size_t index);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the no. of elements
+size_t seg_size(const segment_tree* st);
+
+// Delete the tree
+void seg_free(segment_tree* st);
+
+
+#endif /* DSA_SEGMENT_TREE_H */
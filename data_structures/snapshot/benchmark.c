@@ -0,0 +1,170 @@
+/*
+Snapshot benchmark: sa_save / sa_load / sa_load_mmap and ll_save / ll_load vs raw I/O and text round trips.
+
+    Build: gcc -O2 -pthread benchmark.c snapshot.c ../arrays/static_array.c ../linked_list/linked_list.c ../allocator/allocator.c -o snap_bench
+    Usage: ./snap_bench [max_elements=100000000] [dir=/tmp]
+
+For n = 1M, 10M, ... up to max_elements random ints, reports MB/s (n * 4 bytes per second) for:
+  - text:  writing "v, " per element with fprintf and parsing it back with fscanf + sa_insert_last, the
+           display-and-parse round trip the snapshots replace (only up to 10M elements)
+  - raw:   one fwrite / fread of the bare buffer, the bandwidth the snapshot paths should get close to
+  - sa_save / sa_load, and sa_load_mmap followed by one pass over the elements (so the pages are read)
+  - ll_save / ll_load of a list with the same values, nodes loaded into an arena
+Every load is compared with the original. Files are written to `dir` and read back while they are
+still in the page cache; drop the cache between the runs to measure a cold disk.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "snapshot.h"
+
+#define TEXT_MAX 10000000
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static double mb_per_s(size_t n, double seconds) {
+    return (double)n * sizeof(int) / seconds / 1e6;
+}
+
+static int same_array(static_array* arr, const int* values, size_t n) {
+    return arr && sa_size(arr) == n && memcmp(sa_const_data(arr), values, n * sizeof(int)) == 0;
+}
+
+static int same_list(ll_node* head, const int* values, size_t n) {
+    for (size_t i = 0; i < n; i++, head = ll_next(head)) {
+        if (!head || ll_get_data(head) != values[i]) return 0;
+    }
+    return head == NULL;
+}
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000000;
+    const char* dir = argc > 2 ? argv[2] : "/tmp";
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/snap_bench.bin", dir);
+
+    int* values = (int*) malloc(max_elements * sizeof(int));
+    if (!values) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    printf("static_array (MB/s)\n");
+    printf("%11s %10s %10s %10s %10s %10s %10s %10s %6s\n", "elements", "text save", "text load",
+           "raw write", "raw read", "sa_save", "sa_load", "mmap+scan", "check");
+    for (size_t n = 1000000; n <= max_elements; n *= 10) {
+        static_array* arr = sa_create_array(n);
+        for (size_t i = 0; i < n; i++) sa_insert_last(arr, (int)next_random());
+        memcpy(values, sa_const_data(arr), n * sizeof(int));
+        int ok = 1;
+
+        // Text round trip
+        char text_save[16] = "-", text_load[16] = "-";
+        if (n <= TEXT_MAX) {
+            remove(path);
+            double t0 = now_seconds();
+            FILE* f = fopen(path, "w");
+            for (size_t i = 0; f && i < n; i++) fprintf(f, "%d, ", values[i]);
+            if (f) fclose(f);
+            snprintf(text_save, sizeof(text_save), "%.0f", mb_per_s(n, now_seconds() - t0));
+
+            t0 = now_seconds();
+            static_array* parsed = sa_create_array(n);
+            f = fopen(path, "r");
+            int v;
+            while (f && fscanf(f, "%d,", &v) == 1) sa_insert_last(parsed, v);
+            if (f) fclose(f);
+            snprintf(text_load, sizeof(text_load), "%.0f", mb_per_s(n, now_seconds() - t0));
+            ok &= same_array(parsed, values, n);
+            sa_free(parsed);
+        }
+
+        // Raw buffer I/O (every timed write starts from a removed file, so no run pays for truncating the last one)
+        remove(path);
+        double t0 = now_seconds();
+        FILE* f = fopen(path, "wb");
+        ok &= f && fwrite(values, sizeof(int), n, f) == n;
+        if (f) fclose(f);
+        double raw_write = mb_per_s(n, now_seconds() - t0);
+
+        int* raw = (int*) malloc(n * sizeof(int));
+        t0 = now_seconds();
+        f = fopen(path, "rb");
+        ok &= raw && f && fread(raw, sizeof(int), n, f) == n;
+        if (f) fclose(f);
+        double raw_read = mb_per_s(n, now_seconds() - t0);
+        ok &= raw && memcmp(raw, values, n * sizeof(int)) == 0;
+        free(raw);
+
+        // Snapshots
+        remove(path);
+        t0 = now_seconds();
+        ok &= sa_save(arr, path) == 0;
+        double save = mb_per_s(n, now_seconds() - t0);
+
+        t0 = now_seconds();
+        static_array* loaded = sa_load(path);
+        double load = mb_per_s(n, now_seconds() - t0);
+        ok &= same_array(loaded, values, n);
+        sa_free(loaded);
+
+        t0 = now_seconds();
+        static_array* mapped = sa_load_mmap(path, 0);
+        int64_t sum = 0;
+        const int* data = mapped ? sa_const_data(mapped) : NULL;
+        for (size_t i = 0; data && i < n; i++) sum += data[i];
+        double mmap_scan = mb_per_s(n, now_seconds() - t0);
+        ok &= same_array(mapped, values, n) && sum != 0x7FFFFFFFFFFFFFFFll;
+        sa_free(mapped);
+
+        printf("%11zu %10s %10s %10.0f %10.0f %10.0f %10.0f %10.0f %6s\n", n, text_save, text_load,
+               raw_write, raw_read, save, load, mmap_scan, ok ? "ok" : "MISMATCH");
+        sa_free(arr);
+    }
+
+    printf("\nlinked list (MB/s of values)\n");
+    printf("%11s %10s %10s %6s\n", "elements", "ll_save", "ll_load", "check");
+    for (size_t n = 1000000; n <= max_elements; n *= 10) {
+        for (size_t i = 0; i < n; i++) values[i] = (int)next_random();
+        ll_node* head = ll_from_array(values, n);
+
+        remove(path);
+        double t0 = now_seconds();
+        int ok = ll_save(head, path) == 0;
+        double save = mb_per_s(n, now_seconds() - t0);
+        ll_free_list_with_allocator(&head, NULL);
+
+        // Nodes go into an arena with large chunks: few chunks, nodes in traversal order
+        arena* nodes = arena_create((size_t)64 << 20);
+        ll_node* loaded = NULL;
+        t0 = now_seconds();
+        ok &= ll_load(path, &loaded, arena_allocator(nodes)) == 0;
+        double load = mb_per_s(n, now_seconds() - t0);
+        ok &= same_list(loaded, values, n);
+        arena_free(nodes);
+
+        printf("%11zu %10.0f %10.0f %6s\n", n, save, load, ok ? "ok" : "MISMATCH");
+    }
+
+    remove(path);
+    free(values);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include "snapshot.h"
+
+int main(void) {
+
+    printf("\n\n============================| SNAPSHOT EXAMPLE |============================\n\n");
+
+    const char* array_path = "example_array.snap";
+    const char* list_path = "example_list.snap";
+
+    // static_array: save, then load back by reading and by mapping the file
+    static_array* arr = sa_create_array(8);
+    for (int i = 1; i <= 5; i++) sa_insert_last(arr, i * 11);
+    sa_save(arr, array_path);
+
+    snapshot_info info;
+    if (snapshot_read_info(array_path, &info) == 0)
+        printf("Header: version %u, type %d, %u-byte elements, count %llu, capacity %llu\n", info.version,
+               (int)info.type, info.element_size, (unsigned long long)info.count, (unsigned long long)info.capacity);
+
+    static_array* loaded = sa_load(array_path);
+    printf("sa_load:      ");
+    sa_display(loaded);
+
+    static_array* mapped = sa_load_mmap(array_path, 1);
+    sa_modify_at(mapped, 0, -1);   // Private mapping: the file keeps 11
+    printf("sa_load_mmap: ");
+    sa_display(mapped);
+
+    // Loading a file of the wrong type fails with a message
+    ll_node* head = NULL;
+    if (ll_load(array_path, &head, NULL) != 0) printf("ll_load of an array snapshot was rejected\n");
+
+    // Linked list round trip
+    for (int i = 5; i >= 1; i--) ll_push_front(&head, i);
+    ll_save(head, list_path);
+    ll_free_list_with_allocator(&head, NULL);
+
+    ll_load(list_path, &head, NULL);
+    printf("ll_load: ");
+    ll_display(head);
+
+    ll_free_list_with_allocator(&head, NULL);
+    sa_free(arr);
+    sa_free(loaded);
+    sa_free(mapped);
+    remove(array_path);
+    remove(list_path);
+    return 0;
+}
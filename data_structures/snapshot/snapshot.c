@@ -0,0 +1,442 @@
+#define _POSIX_C_SOURCE 200809L     // fileno, mmap
+
+#include "snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SNAP_MAGIC "DSASNAP"          // 8 bytes with the terminating 0
+#define SNAP_BYTE_ORDER 0x01020304u
+#define SNAP_CHUNK ((size_t)1 << 18)  // Elements per read / write / checksum step (1 MB of ints, a multiple of 4)
+
+// On-disk header, 64 bytes so the elements start cache-line aligned (also in a mapping)
+typedef struct snap_header {
+	char magic[8];
+	uint32_t byte_order;     // SNAP_BYTE_ORDER as stored by the writer
+	uint32_t version;
+	uint32_t type;
+	uint32_t element_size;
+	uint64_t count;
+	uint64_t capacity;
+	uint64_t checksum;
+	uint8_t reserved[16];    // Zero
+} snap_header;
+
+_Static_assert(sizeof(snap_header) == 64, "snapshot header must be 64 bytes");
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Checksum
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Fletcher-style sums in 4 independent lanes (word i goes to lane i % 4), so the loop vectorizes
+typedef struct snap_sum {
+	uint64_t a[4];
+	uint64_t b[4];
+} snap_sum;
+
+// Add n words; every call but the last must pass a multiple of 4 words to keep the lanes aligned
+static void snap_sum_update(snap_sum* s, const int* words, size_t n) {
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		for (int j = 0; j < 4; j++) {
+			s->a[j] += (uint32_t)words[i + j];
+			s->b[j] += s->a[j];
+		}
+	}
+	for (int j = 0; i < n; i++, j++) {
+		s->a[j] += (uint32_t)words[i];
+		s->b[j] += s->a[j];
+	}
+}
+
+static uint64_t snap_sum_final(const snap_sum* s, uint64_t count) {
+	uint64_t h = count ^ 0x9E3779B97F4A7C15ull;
+	for (int j = 0; j < 4; j++) {
+		h = (h ^ s->a[j]) * 0x100000001B3ull;
+		h = (h ^ s->b[j]) * 0x100000001B3ull;
+		h ^= h >> 29;
+	}
+	return h;
+}
+
+static uint64_t snap_checksum(const int* data, size_t count) {
+	snap_sum s = { { 0 }, { 0 } };
+	snap_sum_update(&s, data, count);
+	return snap_sum_final(&s, count);
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Header and file helpers
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+static void snap_fill_header(snap_header* h, snapshot_type type, size_t count, size_t capacity, uint64_t checksum) {
+	memset(h, 0, sizeof(*h));
+	memcpy(h->magic, SNAP_MAGIC, sizeof(h->magic));
+	h->byte_order = SNAP_BYTE_ORDER;
+	h->version = SNAPSHOT_VERSION;
+	h->type = (uint32_t)type;
+	h->element_size = sizeof(int);
+	h->count = count;
+	h->capacity = capacity;
+	h->checksum = checksum;
+}
+
+// Check a header against the file size and the expected type (0 = any) - returns 0 if usable else -1
+static int snap_check_header(const snap_header* h, uint64_t file_size, uint32_t type, const char* caller, const char* path) {
+	if (memcmp(h->magic, SNAP_MAGIC, sizeof(h->magic)) != 0) {
+		printf("%s: %s is not a snapshot file\n", caller, path);
+		return -1;
+	}
+	if (h->byte_order != SNAP_BYTE_ORDER) {
+		printf("%s: %s was saved with a different byte order\n", caller, path);
+		return -1;
+	}
+	if (h->version != SNAPSHOT_VERSION) {
+		printf("%s: %s has format version %u, expected %d\n", caller, path, h->version, SNAPSHOT_VERSION);
+		return -1;
+	}
+	if (h->element_size != sizeof(int)) {
+		printf("%s: %s stores %u-byte elements, expected %zu\n", caller, path, h->element_size, sizeof(int));
+		return -1;
+	}
+	if (type != 0 && h->type != type) {
+		printf("%s: %s holds a snapshot of another container type (%u)\n", caller, path, h->type);
+		return -1;
+	}
+	if (file_size < sizeof(snap_header) || h->count != (file_size - sizeof(snap_header)) / sizeof(int)
+	    || (file_size - sizeof(snap_header)) % sizeof(int) != 0 || h->capacity < h->count
+	    || h->capacity > SIZE_MAX / sizeof(int)) {
+		printf("%s: %s is truncated or has an inconsistent header\n", caller, path);
+		return -1;
+	}
+	return 0;
+}
+
+// Open a snapshot for reading and validate its header - returns NULL on error
+static FILE* snap_open(const char* path, uint32_t type, snap_header* h, const char* caller) {
+	FILE* f = fopen(path, "rb");
+	if (!f) {
+		printf("%s: couldn't open %s\n", caller, path);
+		return NULL;
+	}
+
+	struct stat info;
+	if (fstat(fileno(f), &info) != 0 || fread(h, sizeof(*h), 1, f) != 1) {
+		printf("%s: %s is too short for a snapshot header\n", caller, path);
+		fclose(f);
+		return NULL;
+	}
+	if (snap_check_header(h, (uint64_t)info.st_size, type, caller, path) != 0) {
+		fclose(f);
+		return NULL;
+	}
+	return f;
+}
+
+// Read count elements into dst in chunks, checksumming each chunk while it is in cache - returns 0 or -1
+static int snap_read_elements(FILE* f, int* dst, size_t count, uint64_t expected, const char* caller, const char* path) {
+	snap_sum s = { { 0 }, { 0 } };
+	for (size_t done = 0; done < count; ) {
+		size_t n = count - done < SNAP_CHUNK ? count - done : SNAP_CHUNK;
+		if (fread(dst + done, sizeof(int), n, f) != n) {
+			printf("%s: read error in %s\n", caller, path);
+			return -1;
+		}
+		snap_sum_update(&s, dst + done, n);
+		done += n;
+	}
+	if (snap_sum_final(&s, count) != expected) {
+		printf("%s: checksum mismatch in %s (file corrupted)\n", caller, path);
+		return -1;
+	}
+	return 0;
+}
+
+// Finish a written file - returns 0 if every write reached the file else -1
+static int snap_close_written(FILE* f, int status, const char* caller, const char* path) {
+	if (fclose(f) != 0) status = -1;
+	if (status != 0) printf("%s: write error in %s\n", caller, path);
+	return status;
+}
+
+
+int snapshot_read_info(const char* path, snapshot_info* out) {
+	// Validate input parameters: path and out
+	if (!path || !out) {
+		printf("snapshot_read_info: NULL pointer\n");
+		return -1;
+	}
+
+	snap_header h;
+	FILE* f = snap_open(path, 0, &h, "snapshot_read_info");
+	if (!f) return -1;
+	fclose(f);
+
+	out->version = h.version;
+	out->type = (snapshot_type)h.type;
+	out->element_size = h.element_size;
+	out->count = h.count;
+	out->capacity = h.capacity;
+	out->checksum = h.checksum;
+	return 0;
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// static_array
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+int sa_save(static_array* arr, const char* path) {
+	// Validate input parameters: arr and path
+	if (!arr || !path) {
+		printf("sa_save: NULL pointer\n");
+		return -1;
+	}
+
+	// The checksum pass runs at memory speed; then the whole buffer goes out in one write
+	const int* data = sa_const_data(arr);
+	size_t count = sa_size(arr);
+	snap_header h;
+	snap_fill_header(&h, SNAPSHOT_STATIC_ARRAY, count, sa_capacity(arr), snap_checksum(data, count));
+
+	FILE* f = fopen(path, "wb");
+	if (!f) {
+		printf("sa_save: couldn't create %s\n", path);
+		return -1;
+	}
+	int status = fwrite(&h, sizeof(h), 1, f) == 1 && fwrite(data, sizeof(int), count, f) == count ? 0 : -1;
+	return snap_close_written(f, status, "sa_save", path);
+}
+
+
+static_array* sa_load(const char* path) {
+	// Validate input parameter: path
+	if (!path) {
+		printf("sa_load: NULL path\n");
+		return NULL;
+	}
+
+	snap_header h;
+	FILE* f = snap_open(path, SNAPSHOT_STATIC_ARRAY, &h, "sa_load");
+	if (!f) return NULL;
+
+	// Memory allocation: a buffer for the elements the file actually holds, filled by the reads. The header
+	// (and so the capacity) isn't covered by the checksum: the buffer grows to it only after the elements
+	// checked out, and a capacity that can't be allocated fails the load instead of exiting
+	size_t count = (size_t)h.count;
+	size_t held = count > 0 ? count : 1;
+	const dsa_allocator* libc = dsa_default_allocator();
+	int* buffer = (int*) libc->alloc(libc->ctx, sizeof(int) * held, 0);
+	if (!buffer) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu integers in the array\n", held);
+		exit(1);
+	}
+
+	int status = snap_read_elements(f, buffer, count, h.checksum, "sa_load", path);
+	fclose(f);
+	if (status != 0) {
+		libc->free(libc->ctx, buffer, sizeof(int) * held);
+		return NULL;
+	}
+
+	size_t capacity = h.capacity > held ? (size_t)h.capacity : held;
+	if (capacity > held) {
+		int* grown = (int*) libc->realloc(libc->ctx, buffer, sizeof(int) * held, sizeof(int) * capacity);
+		if (!grown) {
+			printf("sa_load: %s asks for a capacity of %zu integers, which can't be allocated\n", path, capacity);
+			libc->free(libc->ctx, buffer, sizeof(int) * held);
+			return NULL;
+		}
+		buffer = grown;
+	}
+	return sa_create_array_from_buffer(buffer, capacity, count, libc);
+}
+
+
+/*
+* Allocator of an mmap-loaded array: the mapped elements are one of its blocks (freeing them unmaps the
+* file), everything else the array allocates (struct, share count, copies, clones) comes from libc.
+* It lives until the last of its blocks is freed.
+*/
+typedef struct snap_mapping {
+	dsa_allocator allocator;   // ctx points back to the mapping
+	void* base;
+	size_t length;
+	int* data;                 // Elements inside the mapping
+	size_t blocks;             // Outstanding blocks, the mapped elements included
+} snap_mapping;
+
+static void* snap_mapping_alloc(void* ctx, size_t size, size_t alignment) {
+	snap_mapping* m = (snap_mapping*) ctx;
+	void* ptr = dsa_libc_alloc(NULL, size, alignment);
+	if (ptr) m->blocks++;
+	return ptr;
+}
+
+static void* snap_mapping_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size) {
+	snap_mapping* m = (snap_mapping*) ctx;
+	if (!ptr) return snap_mapping_alloc(ctx, new_size, 0);
+	if (ptr != m->data) return dsa_libc_realloc(NULL, ptr, old_size, new_size);
+
+	// The mapped block moves to the heap
+	void* moved = dsa_libc_alloc(NULL, new_size, 0);
+	if (!moved) return NULL;
+	memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+	munmap(m->base, m->length);
+	m->data = NULL;
+	return moved;
+}
+
+static void snap_mapping_free(void* ctx, void* ptr, size_t size) {
+	snap_mapping* m = (snap_mapping*) ctx;
+	if (!ptr) return;
+	if (ptr == m->data) {
+		munmap(m->base, m->length);
+		m->data = NULL;
+	} else {
+		dsa_libc_free(NULL, ptr, size);
+	}
+	if (--m->blocks == 0) free(m);
+}
+
+
+static_array* sa_load_mmap(const char* path, int verify) {
+	// Validate input parameter: path
+	if (!path) {
+		printf("sa_load_mmap: NULL path\n");
+		return NULL;
+	}
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("sa_load_mmap: couldn't open %s\n", path);
+		return NULL;
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(snap_header)) {
+		printf("sa_load_mmap: %s is too short for a snapshot header\n", path);
+		close(fd);
+		return NULL;
+	}
+
+	// Private writable mapping: writes go to private copies of the pages, never to the file
+	size_t length = (size_t)info.st_size;
+	void* base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) {
+		printf("sa_load_mmap: couldn't map %s\n", path);
+		return NULL;
+	}
+
+	const snap_header* h = (const snap_header*) base;
+	int* data = (int*)((char*)base + sizeof(snap_header));
+	if (snap_check_header(h, length, SNAPSHOT_STATIC_ARRAY, "sa_load_mmap", path) != 0) {
+		munmap(base, length);
+		return NULL;
+	}
+	if (verify && snap_checksum(data, (size_t)h->count) != h->checksum) {
+		printf("sa_load_mmap: checksum mismatch in %s (file corrupted)\n", path);
+		munmap(base, length);
+		return NULL;
+	}
+
+	// An empty snapshot has nothing to map (the array needs capacity > 0): load it normally
+	if (h->count == 0) {
+		munmap(base, length);
+		return sa_load(path);
+	}
+
+	// Memory allocation: the mapping's allocator, owning the mapped elements as its first block
+	snap_mapping* m = (snap_mapping*) malloc(sizeof(snap_mapping));
+	if (!m) {
+		printf("Memory allocation failed: couldn't allocate memory for the mapping of %s\n", path);
+		exit(1);
+	}
+	m->allocator.alloc = snap_mapping_alloc;
+	m->allocator.realloc = snap_mapping_realloc;
+	m->allocator.free = snap_mapping_free;
+	m->allocator.ctx = m;
+	m->base = base;
+	m->length = length;
+	m->data = data;
+	m->blocks = 1;
+	return sa_create_array_from_buffer(data, (size_t)h->count, (size_t)h->count, &m->allocator);
+}
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+// Linked list
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+int ll_save(ll_node* head, const char* path) {
+	// Validate input parameter: path
+	if (!path) {
+		printf("ll_save: NULL path\n");
+		return -1;
+	}
+
+	FILE* f = fopen(path, "wb");
+	if (!f) {
+		printf("ll_save: couldn't create %s\n", path);
+		return -1;
+	}
+
+	// Memory allocation: one chunk of values gathered from the nodes per write
+	int* chunk = (int*) malloc(sizeof(int) * SNAP_CHUNK);
+	if (!chunk) {
+		printf("Memory allocation failed: couldn't allocate the ll_save buffer\n");
+		exit(1);
+	}
+
+	// Single traversal: the header goes first as a placeholder and is rewritten once count and checksum are known
+	snap_header h;
+	snap_fill_header(&h, SNAPSHOT_LINKED_LIST, 0, 0, 0);
+	int status = fwrite(&h, sizeof(h), 1, f) == 1 ? 0 : -1;
+	snap_sum s = { { 0 }, { 0 } };
+	size_t count = 0;
+	for (ll_node* node = head; node != NULL && status == 0; ) {
+		size_t n = 0;
+		for (; node != NULL && n < SNAP_CHUNK; node = ll_next(node)) chunk[n++] = ll_get_data(node);
+		snap_sum_update(&s, chunk, n);
+		if (fwrite(chunk, sizeof(int), n, f) != n) status = -1;
+		count += n;
+	}
+	free(chunk);
+
+	if (status == 0) {
+		snap_fill_header(&h, SNAPSHOT_LINKED_LIST, count, count, snap_sum_final(&s, count));
+		if (fseek(f, 0, SEEK_SET) != 0 || fwrite(&h, sizeof(h), 1, f) != 1) status = -1;
+	}
+	return snap_close_written(f, status, "ll_save", path);
+}
+
+
+int ll_load(const char* path, ll_node** headRef, const dsa_allocator* allocator) {
+	// Validate input parameters: path and headRef
+	if (!path || !headRef) {
+		printf("ll_load: NULL pointer\n");
+		return -1;
+	}
+
+	snap_header h;
+	FILE* f = snap_open(path, SNAPSHOT_LINKED_LIST, &h, "ll_load");
+	if (!f) return -1;
+
+	// Memory allocation: all values in one buffer, so nothing is linked before the checksum is verified
+	size_t count = (size_t)h.count;
+	int* values = (int*) malloc(sizeof(int) * (count > 0 ? count : 1));
+	if (!values) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu list values\n", count);
+		exit(1);
+	}
+
+	int status = snap_read_elements(f, values, count, h.checksum, "ll_load", path);
+	fclose(f);
+	if (status == 0) *headRef = ll_from_array_with_allocator(values, count, allocator);
+	free(values);
+	return status;
+}
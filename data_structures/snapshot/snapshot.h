@@ -0,0 +1,72 @@
+#ifndef DSA_SNAPSHOT_H
+#define DSA_SNAPSHOT_H
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+
+/*
+* Binary snapshots of static_array and linked lists, replacing display-and-parse round trips.
+*
+* File layout (native byte order, version SNAPSHOT_VERSION):
+*   [64-byte header][count elements of element_size bytes]
+* The header holds a magic string, a byte-order mark, the version, the container type, the element width,
+* the element count, the static_array capacity at save time, and a checksum of the element bytes.
+* Files written on a machine with another byte order or int width are rejected, not converted.
+*
+* Save writes the element buffer with one large write; load reads it straight into the new array's
+* buffer (or into one buffer that is then linked into nodes, for lists) and verifies the checksum.
+* sa_load_mmap maps the file instead: the array uses the mapped pages directly (private mapping,
+* so writes never reach the file) and pages are only read from disk when first touched.
+*
+* The checksum is a 4-lane Fletcher-style sum over 32-bit words - it catches truncation and corruption,
+* it is not a cryptographic hash.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+#define SNAPSHOT_VERSION 1
+
+typedef enum { SNAPSHOT_STATIC_ARRAY = 1, SNAPSHOT_LINKED_LIST = 2 } snapshot_type;
+
+// Header fields of a snapshot file
+typedef struct snapshot_info {
+	uint32_t version;
+	snapshot_type type;
+	uint32_t element_size;   // Bytes per element (sizeof(int) of the writer)
+	uint64_t count;          // No. of elements stored
+	uint64_t capacity;       // static_array capacity at save time (count for lists)
+	uint64_t checksum;       // Checksum of the element bytes
+} snapshot_info;
+
+// Read and validate the header of a snapshot file without loading it - returns 0 on success else -1
+int snapshot_read_info(const char* path, snapshot_info* out);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Save the elements (and the capacity) of an array to path, replacing the file - returns 0 on success else -1
+int sa_save(static_array* arr, const char* path);
+
+// Load an array saved by sa_save, with the capacity it had - returns NULL on error (bad file, checksum mismatch,
+// a capacity that can't be allocated)
+static_array* sa_load(const char* path);
+
+// Load an array by mapping the file. Its capacity is the element count. verify != 0 checks the checksum,
+// which reads the whole file; otherwise pages are read when first touched - returns NULL on error
+static_array* sa_load_mmap(const char* path, int verify);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Save the values of a list to path in list order, replacing the file - returns 0 on success else -1
+int ll_save(ll_node* head, const char* path);
+
+// Load a list saved by ll_save into *headRef (the previous list is not freed). Nodes come from allocator
+// (NULL = libc) in list order; with an arena they are packed in traversal order - returns 0 on success else -1
+int ll_load(const char* path, ll_node** headRef, const dsa_allocator* allocator);
+
+
+#endif /* DSA_SNAPSHOT_H */
@@ -0,0 +1,145 @@
+/*
+Crossover benchmark: random-position edits on tiered_vector vs static_array vs linked list.
+
+    Build: gcc -O2 benchmark.c tiered_vector.c ../arrays/static_array.c ../linked_list/linked_list.c -o tv_bench
+    Usage: ./tv_bench [max_elements=10000000]
+
+For n = 100, 1K, 10K, ... up to max_elements elements, every structure gets the same sequence of
+edits at random positions (an insert followed by a remove, so n stays constant):
+    edit   : tv_insert_at + tv_remove_at vs sa_insert_at + sa_remove_at vs ll_insert_at + ll_delete_at
+             (ns per edit; the list walks to the position, a memmove shifts the array)
+    get    : random tv_get_element vs sa_get_element (ns per access)
+    scan   : sum of all elements over tv_span runs vs over sa_data (ns per element)
+The array and list baselines get a bounded budget of moved / visited elements per size.
+The list runs a shorter prefix of the same edits. After the edits the tiered vector must match the
+array and the list must match a clone of the array that replayed its prefix; the last column reports it.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "tiered_vector.h"
+#include "../arrays/static_array.h"
+#include "../linked_list/linked_list.h"
+
+#define EDITS        200000
+#define GETS         1000000
+#define MOVE_BUDGET  1000000000ull   // Elements moved / visited allowed for one baseline measurement
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static size_t edits_for(size_t n) {
+    size_t e = MOVE_BUDGET / n;
+    return e < EDITS ? (e ? e : 1) : EDITS;
+}
+
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+
+    printf("%10s %6s %9s %10s %10s %10s %8s %8s %9s %9s %8s\n", "n", "chunk", "edits", "tv edit",
+           "sa edit", "ll edit", "tv get", "sa get", "tv scan", "sa scan", "check");
+    for (size_t n = 100; n <= max_n; n *= 10) {
+        static_array* arr = sa_create_array(n + 1);
+        for (size_t i = 0; i < n; i++) sa_insert_last(arr, (int)(next_random() >> 40));
+        tiered_vector* tv = tv_create_from_array(arr);
+        static_array* list_ref = sa_clone(arr);     // Replays the list's shorter edit sequence for the check
+        ll_node* head = NULL;
+        for (size_t i = n; i-- > 0; ) ll_push_front(&head, sa_get_element(arr, i));
+
+        // Same edit positions for all three
+        size_t edits = edits_for(n);
+        size_t* pos = (size_t*) malloc(sizeof(size_t) * 2 * edits);
+        if (!pos) {
+            printf("Memory allocation failed!\n");
+            return 1;
+        }
+        for (size_t e = 0; e < edits; e++) {
+            pos[2 * e] = (size_t)(next_random() % (n + 1));
+            pos[2 * e + 1] = (size_t)(next_random() % (n + 1));
+        }
+
+        double t0 = now_seconds();
+        for (size_t e = 0; e < edits; e++) {
+            tv_insert_at(tv, pos[2 * e], (int)e);
+            tv_remove_at(tv, pos[2 * e + 1]);
+        }
+        double tv_ns = (now_seconds() - t0) * 1e9 / (double)edits;
+
+        t0 = now_seconds();
+        for (size_t e = 0; e < edits; e++) {
+            sa_insert_at(arr, pos[2 * e], (int)e);
+            sa_remove_at(arr, pos[2 * e + 1]);
+        }
+        double sa_ns = (now_seconds() - t0) * 1e9 / (double)edits;
+
+        // The list walks half the list on average per operation: fewer edits, same prefix of the sequence
+        size_t ll_edits = edits / 4 ? edits / 4 : 1;
+        t0 = now_seconds();
+        for (size_t e = 0; e < ll_edits; e++) {
+            ll_insert_at(&head, (int)e, (int)pos[2 * e] + 1);
+            ll_delete_at(&head, (int)pos[2 * e + 1] + 1);
+        }
+        double ll_ns = (now_seconds() - t0) * 1e9 / (double)ll_edits;
+        for (size_t e = 0; e < ll_edits; e++) {
+            sa_insert_at(list_ref, pos[2 * e], (int)e);
+            sa_remove_at(list_ref, pos[2 * e + 1]);
+        }
+
+        // Random access
+        long long sink = 0;
+        size_t gets = 2 * edits < GETS ? 2 * edits : GETS;
+        for (size_t g = 0; g < gets; g++) pos[g] = (size_t)(next_random() % n);
+        t0 = now_seconds();
+        for (size_t g = 0; g < gets; g++) sink += tv_get_element(tv, pos[g]);
+        double tv_get = (now_seconds() - t0) * 1e9 / (double)gets;
+        t0 = now_seconds();
+        for (size_t g = 0; g < gets; g++) sink += sa_get_element(arr, pos[g]);
+        double sa_get = (now_seconds() - t0) * 1e9 / (double)gets;
+
+        // Scans
+        long long tv_sum = 0, sa_sum = 0;
+        const int* span;
+        t0 = now_seconds();
+        for (size_t i = 0, len; (len = tv_span(tv, i, &span)) != 0; i += len) {
+            for (size_t k = 0; k < len; k++) tv_sum += span[k];
+        }
+        double tv_scan = (now_seconds() - t0) * 1e9 / (double)n;
+        const int* d = sa_const_data(arr);
+        t0 = now_seconds();
+        for (size_t i = 0; i < n; i++) sa_sum += d[i];
+        double sa_scan = (now_seconds() - t0) * 1e9 / (double)n;
+
+        int ok = tv_sum == sa_sum && tv_size(tv) == sa_size(arr);
+        for (size_t i = 0; ok && i < n; i++) ok = tv_get_element(tv, i) == d[i];
+        const ll_node* node = head;
+        for (size_t i = 0; ok && i < n; i++, node = ll_next(node)) ok = node && ll_get_data(node) == sa_get_element(list_ref, i);
+
+        printf("%10zu %6zu %9zu %10.1f %10.1f %10.1f %8.1f %8.1f %9.2f %9.2f %8s\n", n, tv_chunk_size(tv), edits,
+               tv_ns, sa_ns, ll_ns, tv_get, sa_get, tv_scan, sa_scan, ok ? "ok" : "MISMATCH");
+        if (sink == 42) printf(" ");
+
+        free(pos);
+        tv_free(tv);
+        sa_free(arr);
+        sa_free(list_ref);
+        while (head) ll_pop_front(&head);
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include "tiered_vector.h"
+
+int main(void) {
+
+    printf("\n\n============================| TIERED VECTOR EXAMPLE |============================\n\n");
+
+    // Same calls as static_array
+    tiered_vector* tv = tv_create(100);
+    for (int i = 0; i < 40; i++) tv_insert_last(tv, i);
+    printf("Chunk size for capacity 100: %zu\n", tv_chunk_size(tv));
+
+    tv_insert_at(tv, 5, 500);
+    tv_insert_first(tv, -1);
+    tv_remove_at(tv, 20);
+    tv_modify_at(tv, 0, -2);
+    printf("After edits: ");
+    tv_display(tv);
+    printf("First %d, last %d, element 6: %d, index of 500: %d\n",
+           tv_get_first(tv), tv_get_last(tv), tv_get_element(tv, 6), tv_find_val(tv, 500));
+
+    // Scan contiguous spans instead of calling tv_get_element per index
+    long sum = 0;
+    size_t spans = 0;
+    const int* span;
+    for (size_t i = 0, len; (len = tv_span(tv, i, &span)) != 0; i += len) {
+        for (size_t k = 0; k < len; k++) sum += span[k];
+        spans++;
+    }
+    printf("Sum %ld over %zu spans\n", sum, spans);
+
+    // From a static_array
+    static_array* arr = sa_create_array(10);
+    for (int i = 0; i < 5; i++) sa_insert_last(arr, i * i);
+    tiered_vector* copy = tv_create_from_array(arr);
+    tv_remove_first(copy);
+    printf("From static_array, first removed: ");
+    tv_display(copy);
+
+    sa_free(arr);
+    tv_free(copy);
+    tv_free(tv);
+
+    return 0;
+}
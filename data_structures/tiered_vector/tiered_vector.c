@@ -0,0 +1,356 @@
+#include "tiered_vector.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TV_MIN_CHUNK 16
+#define TV_MAX_CHUNK 65536
+#define TV_ALIGN 64                 // Chunk storage alignment in bytes (one cache line)
+
+/*
+* Chunk c owns slots data[c * C .. c * C + C - 1]; its k-th element is in slot (heads[c] + k) & mask.
+* Chunks 0 .. size / C - 1 are full, chunk size / C holds the remaining size % C elements.
+*/
+
+typedef struct tiered_vector {
+	int* data;          // nchunks * C slots, 64-byte aligned
+	size_t* heads;      // Offset of the first element of every chunk
+	size_t capacity;
+	size_t size;
+	size_t nchunks;
+	size_t shift;       // log2(C)
+	size_t mask;        // C - 1
+} tiered_vector;
+
+
+static inline int* tv_slot(tiered_vector* tv, size_t c, size_t k) {
+	return &tv->data[(c << tv->shift) + ((tv->heads[c] + k) & tv->mask)];
+}
+
+// No. of elements in chunk c (c must hold at least one element)
+static inline size_t tv_chunk_len(const tiered_vector* tv, size_t c) {
+	size_t start = c << tv->shift;
+	return tv->size - start < tv->mask + 1 ? tv->size - start : tv->mask + 1;
+}
+
+
+tiered_vector* tv_create(size_t capacity) {
+	// Validate input parameter: capacity
+	if (capacity == 0) {
+		printf("Requested capacity must be > 0\n");
+		return NULL;
+	}
+
+	// Memory allocation: tiered_vector struct
+	tiered_vector* tv = (tiered_vector*) malloc(sizeof(tiered_vector));
+	if (!tv) {
+		printf("Memory allocation failed: couldn't allocate memory for the struct tiered_vector!\n");
+		exit(1);
+	}
+
+	// Chunk size: power of two around 2 * sqrt(capacity) - moving elements inside a chunk is a sequential
+	// scan, while every chunk passed costs a cache miss, so chunks a bit larger than sqrt(n) balance better
+	size_t chunk = TV_MIN_CHUNK;
+	tv->shift = 4;
+	while (chunk < TV_MAX_CHUNK && (chunk / 2) * (chunk / 2) < capacity) {
+		chunk <<= 1;
+		tv->shift++;
+	}
+	tv->mask = chunk - 1;
+	tv->nchunks = (capacity + chunk - 1) / chunk;
+	tv->capacity = capacity;
+	tv->size = 0;
+
+	// Memory allocation: chunk storage and offsets
+	tv->data = (int*) aligned_alloc(TV_ALIGN, sizeof(int) * chunk * tv->nchunks);
+	tv->heads = (size_t*) calloc(tv->nchunks, sizeof(size_t));
+	if (!tv->data || !tv->heads) {
+		printf("Memory allocation failed: couldn't allocate memory for %zu integers in the vector\n", capacity);
+		exit(1);
+	}
+	return tv;
+}
+
+
+tiered_vector* tv_create_from_array(static_array* src) {
+	// Validate input parameter: src
+	if (!src) {
+		printf("tv_create_from_array: NULL array pointer\n");
+		return NULL;
+	}
+
+	// All offsets are 0, so the elements keep their order in the chunk storage
+	tiered_vector* tv = tv_create(sa_capacity(src));
+	if (!tv) return NULL;
+	tv->size = sa_size(src);
+	memcpy(tv->data, sa_const_data(src), sizeof(int) * tv->size);
+	return tv;
+}
+
+
+int tv_insert_at(tiered_vector* tv, size_t index, int val) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_insert_at: NULL vector pointer\n");
+		return -1;
+	}
+
+	// Validate input parameter: index
+	if (index > tv->size) {
+		printf("tv_insert_at: index out of range (index=%zu, size=%zu)\n", index, tv->size);
+		return -1;
+	}
+
+	// Check if vector is full
+	if (tv->size >= tv->capacity) {
+		printf("tv_insert_at: vector is full (capacity=%zu)\n", tv->capacity);
+		return -1;
+	}
+
+	size_t c = index >> tv->shift;
+	size_t last = tv->size >> tv->shift;     // Chunk that receives the extra element
+
+	// Make room in chunk c: the last element of every full chunk before `last` moves to the front of the next
+	for (size_t j = last; j > c; j--) {
+		int moved = *tv_slot(tv, j - 1, tv->mask);
+		tv->heads[j] = (tv->heads[j] - 1) & tv->mask;
+		*tv_slot(tv, j, 0) = moved;
+	}
+
+	// Shift the shorter side of chunk c by one slot
+	size_t p = index & tv->mask;
+	size_t len = c < last ? tv->mask : tv->size - (c << tv->shift);
+	if (p < len - p) {
+		tv->heads[c] = (tv->heads[c] - 1) & tv->mask;
+		for (size_t k = 0; k < p; k++) *tv_slot(tv, c, k) = *tv_slot(tv, c, k + 1);
+	} else {
+		for (size_t k = len; k > p; k--) *tv_slot(tv, c, k) = *tv_slot(tv, c, k - 1);
+	}
+	*tv_slot(tv, c, p) = val;
+	tv->size++;
+	return 0;
+}
+
+
+int tv_insert_first(tiered_vector* tv, int val) {
+	// Insert value at the first position
+	return tv_insert_at(tv, 0, val);
+}
+
+
+int tv_insert_last(tiered_vector* tv, int val) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_insert_last: NULL vector pointer\n");
+		return -1;
+	}
+
+	// Insert value at the last position (no chunk moves needed)
+	return tv_insert_at(tv, tv->size, val);
+}
+
+
+int tv_modify_at(tiered_vector* tv, size_t index, int val) {
+	// Validate input parameters: tv and index
+	if (!tv || index >= tv->size) {
+		printf("tv_modify_at: index out of range or NULL vector\n");
+		return -1;
+	}
+
+	*tv_slot(tv, index >> tv->shift, index & tv->mask) = val;
+	return 0;
+}
+
+
+int tv_remove_at(tiered_vector* tv, size_t index) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_remove_at: NULL vector pointer\n");
+		return -1;
+	}
+
+	// Validate input parameter: index
+	if (index >= tv->size) {
+		printf("tv_remove_at: index out of range (index=%zu, size=%zu)\n", index, tv->size);
+		return -1;
+	}
+
+	size_t c = index >> tv->shift;
+	size_t last = (tv->size - 1) >> tv->shift;
+
+	// Close the gap in chunk c from the shorter side
+	size_t p = index & tv->mask;
+	size_t len = tv_chunk_len(tv, c);
+	if (p < len - 1 - p) {
+		for (size_t k = p; k > 0; k--) *tv_slot(tv, c, k) = *tv_slot(tv, c, k - 1);
+		tv->heads[c] = (tv->heads[c] + 1) & tv->mask;
+	} else {
+		for (size_t k = p; k + 1 < len; k++) *tv_slot(tv, c, k) = *tv_slot(tv, c, k + 1);
+	}
+
+	// Refill: the first element of every following chunk moves to the back of the previous one
+	for (size_t j = c + 1; j <= last; j++) {
+		int moved = *tv_slot(tv, j, 0);
+		tv->heads[j] = (tv->heads[j] + 1) & tv->mask;
+		*tv_slot(tv, j - 1, tv->mask) = moved;
+	}
+	tv->size--;
+	return 0;
+}
+
+
+int tv_remove_first(tiered_vector* tv) {
+	// Validate input parameter: tv and check if vector is empty
+	if (!tv || tv->size == 0) {
+		printf("tv_remove_first: vector is empty or NULL\n");
+		return -1;
+	}
+
+	return tv_remove_at(tv, 0);
+}
+
+
+int tv_remove_last(tiered_vector* tv) {
+	// Validate input parameter: tv and check if vector is empty
+	if (!tv || tv->size == 0) {
+		printf("tv_remove_last: vector is empty or NULL\n");
+		return -1;
+	}
+
+	// The last element is at the end of the last chunk: nothing to move
+	tv->size--;
+	return 0;
+}
+
+
+int tv_get_first(tiered_vector* tv) {
+	// Validate input parameter: tv and check if vector is empty
+	if (!tv || tv->size == 0) {
+		printf("tv_get_first: vector is empty or NULL\n");
+		return -1;
+	}
+
+	return *tv_slot(tv, 0, 0);
+}
+
+
+int tv_get_last(tiered_vector* tv) {
+	// Validate input parameter: tv and check if vector is empty
+	if (!tv || tv->size == 0) {
+		printf("tv_get_last: vector is empty or NULL\n");
+		return -1;
+	}
+
+	size_t i = tv->size - 1;
+	return *tv_slot(tv, i >> tv->shift, i & tv->mask);
+}
+
+
+int tv_get_element(tiered_vector* tv, size_t index) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_get_element: NULL vector pointer\n");
+		return -1;
+	}
+
+	// Validate input parameter: index
+	if (index >= tv->size) {
+		printf("tv_get_element: index out of range (index=%zu, size=%zu)\n", index, tv->size);
+		return -1;
+	}
+
+	return *tv_slot(tv, index >> tv->shift, index & tv->mask);
+}
+
+
+size_t tv_span(tiered_vector* tv, size_t index, const int** span) {
+	// Validate input parameters: tv, span and index
+	if (!tv || !span || index >= tv->size) return 0;
+
+	// Up to the end of the chunk's elements or the wrap of its circular buffer, whichever is first
+	size_t c = index >> tv->shift, k = index & tv->mask;
+	size_t phys = (tv->heads[c] + k) & tv->mask;
+	size_t to_wrap = tv->mask + 1 - phys;
+	size_t to_end = tv_chunk_len(tv, c) - k;
+	*span = &tv->data[(c << tv->shift) + phys];
+	return to_wrap < to_end ? to_wrap : to_end;
+}
+
+
+int tv_find_val(tiered_vector* tv, int val) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_find_val: NULL vector pointer\n");
+		return -1;
+	}
+
+	// Search span by span
+	const int* span;
+	for (size_t i = 0, len; (len = tv_span(tv, i, &span)) != 0; i += len) {
+		for (size_t k = 0; k < len; k++) {
+			if (span[k] == val) return (int)(i + k);
+		}
+	}
+
+	// Value not found
+	return -1;
+}
+
+
+int tv_count_elements(tiered_vector* tv, int val) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_count_elements: NULL vector pointer\n");
+		return 0;
+	}
+
+	int count = 0;
+	const int* span;
+	for (size_t i = 0, len; (len = tv_span(tv, i, &span)) != 0; i += len) {
+		for (size_t k = 0; k < len; k++) count += span[k] == val;
+	}
+	return count;
+}
+
+
+size_t tv_size(tiered_vector* tv) {
+	return tv ? tv->size : 0;
+}
+
+
+size_t tv_capacity(tiered_vector* tv) {
+	return tv ? tv->capacity : 0;
+}
+
+
+size_t tv_chunk_size(tiered_vector* tv) {
+	return tv ? tv->mask + 1 : 0;
+}
+
+
+void tv_display(tiered_vector* tv) {
+	// Validate input parameter: tv
+	if (!tv) {
+		printf("tv_display: NULL vector pointer\n");
+		return;
+	}
+
+	// Display vector elements
+	printf("[");
+	for (size_t i = 0; i < tv->size; ++i) {
+		printf("%d", *tv_slot(tv, i >> tv->shift, i & tv->mask));
+		if (i + 1 < tv->size) printf(", ");
+	}
+	printf("] (size=%zu, capacity=%zu, chunk=%zu)\n", tv->size, tv->capacity, tv->mask + 1);
+}
+
+
+void tv_free(tiered_vector* tv) {
+	// Validate input parameter: tv
+	if (!tv) return;
+
+	free(tv->data);
+	free(tv->heads);
+	free(tv);
+}
@@ -0,0 +1,98 @@
+#ifndef DSA_TIERED_VECTOR_H
+#define DSA_TIERED_VECTOR_H
+
+
+#include <stddef.h>
+#include "../arrays/static_array.h"
+
+
+/*
+* Tiered vector: fixed-capacity int sequence with the static_array API, built for edits in the middle.
+* Elements live in chunks of C slots (C a power of two near sqrt(capacity)), each chunk a circular
+* buffer with its own start offset. Every chunk except the last is full, so element i is in chunk
+* i / C: indexed access stays O(1) (one extra load for the offset).
+*
+* Insert / remove at position i shifts elements inside one chunk (O(C)) and then moves one element
+* between each pair of following chunks by adjusting their offsets (O(1) per chunk), O(sqrt(n)) in
+* total, where static_array memmoves O(n) elements.
+*
+* A chunk's elements are contiguous except where its circular buffer wraps; tv_span hands out those
+* contiguous runs so scans can loop over plain arrays.
+*
+* Conventions follow static_array: informative prints on error, functions return int status
+* where appropriate, and allocation failures exit the program.
+*/
+
+typedef struct tiered_vector tiered_vector;
+
+// Create a tiered vector of a given capacity (chunk size picked from the capacity)
+tiered_vector* tv_create(size_t capacity);
+
+// Create a tiered vector holding the elements of src, with src's capacity
+tiered_vector* tv_create_from_array(static_array* src);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Insert element at a location - returns 0 if inserted successfully else -1
+int tv_insert_at(tiered_vector* tv, size_t index, int val);
+
+// Insert element at the beginning - returns 0 if inserted successfully else -1
+int tv_insert_first(tiered_vector* tv, int val);
+
+// Insert element at the end - returns 0 if inserted successfully else -1
+int tv_insert_last(tiered_vector* tv, int val);
+
+// Modify element - return 0 if operation performed successfully else return -1
+int tv_modify_at(tiered_vector* tv, size_t index, int val);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Remove element at a specific location - return 0 if operation performed successfully else return -1
+int tv_remove_at(tiered_vector* tv, size_t index);
+
+// Remove first element - return 0 if operation performed successfully else return -1
+int tv_remove_first(tiered_vector* tv);
+
+// Remove last element - return 0 if operation performed successfully else return -1
+int tv_remove_last(tiered_vector* tv);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get first element (-1 with a message if the vector is empty)
+int tv_get_first(tiered_vector* tv);
+
+// Get last element (-1 with a message if the vector is empty)
+int tv_get_last(tiered_vector* tv);
+
+// Get specific element (-1 with a message if index is out of range)
+int tv_get_element(tiered_vector* tv, size_t index);
+
+// Find specific element - returns index of that element (-1 if element not found)
+int tv_find_val(tiered_vector* tv, int val);
+
+// Count the occurrences of val
+int tv_count_elements(tiered_vector* tv, int val);
+
+// Contiguous run starting at index: stores its first element in *span and returns its length
+// (0 if index is out of range). Valid until the next insert / remove
+size_t tv_span(tiered_vector* tv, size_t index, const int** span);
+
+// =--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=--=
+
+// Get the current no. of elements
+size_t tv_size(tiered_vector* tv);
+
+// Get the capacity (maximum no. of elements)
+size_t tv_capacity(tiered_vector* tv);
+
+// Get the chunk size
+size_t tv_chunk_size(tiered_vector* tv);
+
+// Display the vector
+void tv_display(tiered_vector* tv);
+
+// Delete the vector
+void tv_free(tiered_vector* tv);
+
+
+#endif /* DSA_TIERED_VECTOR_H */